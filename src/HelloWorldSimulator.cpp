@@ -20,6 +20,7 @@
  */
 
 #include "HelloWorldPubSubTypes.hpp"
+#include "PlainPayloadPubSubTypes.hpp"
 
 #include <atomic>
 #include <chrono>
@@ -37,6 +38,8 @@
 
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/DomainParticipantListener.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
 #include <fastdds/dds/publisher/DataWriterListener.hpp>
 #include <fastdds/dds/publisher/Publisher.hpp>
@@ -45,8 +48,23 @@
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/dds/xtypes/type_representation/ITypeObjectRegistry.hpp>
+#include <fastdds/dds/xtypes/type_representation/TypeObject.hpp>
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/LibrarySettings.hpp>
 #include <fastdds/rtps/common/SerializedPayload.hpp>
+#include <fastdds/rtps/transport/ChainingTransport.hpp>
+#include <fastdds/rtps/transport/ChainingTransportDescriptor.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.hpp>
+#include <cstdio>
 #include <cstring> // for memcpy
+#include <algorithm>
+#include <array>
+#include <ctime>
+#include <fstream>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 // UDPTransportInterface에서 구현된 데이터 구조체 선언
 namespace eprosima {
@@ -590,8 +608,3348 @@ public:
     }
 };
 
+// plain 타입 송수신 벤치마크
+// 같은 plain 타입을 두 경로로 보내고 받아 샘플 한 개의 왕복 시간을 비교한다.
+//  - 직렬화 경로: DataSharing 을 끄고 write(&sample) / take_next_sample(&sample) 로 복사
+//  - zero-copy 경로: DataSharing 을 켜고 loan_sample / write, take(LoanableSequence) / return_loan
+template<uint32_t N>
+class PlainPayloadBenchmark
+{
+private:
+    typedef PlainPayload<N> SampleType;
+
+    bool zero_copy_;
+    DomainParticipant* participant_;
+    Publisher* publisher_;
+    Subscriber* subscriber_;
+    Topic* topic_;
+    DataWriter* writer_;
+    DataReader* reader_;
+    TypeSupport type_;
+    SampleType* sample_;
+
+public:
+    explicit PlainPayloadBenchmark(bool zero_copy)
+        : zero_copy_(zero_copy)
+        , participant_(nullptr)
+        , publisher_(nullptr)
+        , subscriber_(nullptr)
+        , topic_(nullptr)
+        , writer_(nullptr)
+        , reader_(nullptr)
+        , type_(new PlainPayloadPubSubType<N>())
+        , sample_(nullptr)
+    {
+    }
+
+    ~PlainPayloadBenchmark()
+    {
+        if (sample_ != nullptr) type_.delete_data(sample_);
+        if (reader_ != nullptr) subscriber_->delete_datareader(reader_);
+        if (writer_ != nullptr) publisher_->delete_datawriter(writer_);
+        if (subscriber_ != nullptr) participant_->delete_subscriber(subscriber_);
+        if (publisher_ != nullptr) participant_->delete_publisher(publisher_);
+        if (topic_ != nullptr) participant_->delete_topic(topic_);
+        if (participant_ != nullptr) DomainParticipantFactory::get_instance()->delete_participant(participant_);
+    }
+
+    bool init()
+    {
+        participant_ = DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+        if (participant_ == nullptr) return false;
+
+        type_.register_type(participant_);
+
+        topic_ = participant_->create_topic(type_.get_type_name() + (zero_copy_ ? "_Loan" : "_Copy"),
+                        type_.get_type_name(), TOPIC_QOS_DEFAULT);
+        if (topic_ == nullptr) return false;
+
+        publisher_ = participant_->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+        subscriber_ = participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT, nullptr);
+        if (publisher_ == nullptr || subscriber_ == nullptr) return false;
+
+        // 큰 샘플도 다룰 수 있도록 히스토리를 작게 잡고 메모리는 미리 할당한다
+        DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+        wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        wqos.history().kind = KEEP_LAST_HISTORY_QOS;
+        wqos.history().depth = 1;
+        wqos.resource_limits().max_instances = 1;
+        wqos.resource_limits().max_samples = 2;
+        wqos.resource_limits().max_samples_per_instance = 2;
+        wqos.resource_limits().allocated_samples = 2;
+        wqos.endpoint().history_memory_policy = PREALLOCATED_MEMORY_MODE;
+
+        DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+        rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        rqos.history().kind = KEEP_LAST_HISTORY_QOS;
+        rqos.history().depth = 1;
+        rqos.resource_limits().max_instances = 1;
+        rqos.resource_limits().max_samples = 2;
+        rqos.resource_limits().max_samples_per_instance = 2;
+        rqos.resource_limits().allocated_samples = 2;
+        rqos.endpoint().history_memory_policy = PREALLOCATED_MEMORY_MODE;
+
+        if (zero_copy_)
+        {
+            wqos.data_sharing().automatic();
+            rqos.data_sharing().automatic();
+        }
+        else
+        {
+            wqos.data_sharing().off();
+            rqos.data_sharing().off();
+        }
+
+        writer_ = publisher_->create_datawriter(topic_, wqos, nullptr);
+        reader_ = subscriber_->create_datareader(topic_, rqos, nullptr);
+        if (writer_ == nullptr || reader_ == nullptr) return false;
+
+        sample_ = static_cast<SampleType*>(type_.create_data());
+        return true;
+    }
+
+    // 매칭될 때까지 최대 5초 대기
+    bool wait_for_matching()
+    {
+        for (int i = 0; i < 500; ++i)
+        {
+            PublicationMatchedStatus pub_status;
+            SubscriptionMatchedStatus sub_status;
+            writer_->get_publication_matched_status(pub_status);
+            reader_->get_subscription_matched_status(sub_status);
+            if (pub_status.current_count > 0 && sub_status.current_count > 0) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+    // 샘플 한 개를 보내고 받을 때까지의 시간을 측정한다. 실패하면 음수를 반환한다.
+    double round_trip_us(uint32_t index)
+    {
+        uint8_t fill = static_cast<uint8_t>(index);
+        auto start = std::chrono::steady_clock::now();
+
+        // 두 경로 모두 송신 버퍼를 새 데이터로 채운다
+        if (zero_copy_)
+        {
+            void* loaned = nullptr;
+            if (writer_->loan_sample(loaned) != RETCODE_OK) return -1.0;
+            SampleType* sample = static_cast<SampleType*>(loaned);
+            sample->index = index;
+            sample->size = N;
+            memset(sample->data, fill, N);
+            if (writer_->write(sample) != RETCODE_OK)
+            {
+                writer_->discard_loan(loaned);
+                return -1.0;
+            }
+        }
+        else
+        {
+            sample_->index = index;
+            sample_->size = N;
+            memset(sample_->data, fill, N);
+            if (writer_->write(sample_) != RETCODE_OK) return -1.0;
+        }
+
+        if (!reader_->wait_for_unread_message(eprosima::fastdds::dds::Duration_t(5, 0))) return -1.0;
+
+        bool valid = false;
+        if (zero_copy_)
+        {
+            LoanableSequence<SampleType> data;
+            SampleInfoSeq infos;
+            if (reader_->take(data, infos, 1) == RETCODE_OK)
+            {
+                const SampleType& received = data[0];
+                valid = infos[0].valid_data && received.index == index &&
+                        received.data[0] == fill && received.data[N - 1] == fill;
+                reader_->return_loan(data, infos);
+            }
+        }
+        else
+        {
+            SampleInfo info;
+            if (reader_->take_next_sample(sample_, &info) == RETCODE_OK)
+            {
+                valid = info.valid_data && sample_->index == index &&
+                        sample_->data[0] == fill && sample_->data[N - 1] == fill;
+            }
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        return valid ? std::chrono::duration<double, std::micro>(end - start).count() : -1.0;
+    }
+
+    // 평균 왕복 시간 (us). 첫 샘플은 준비 단계로 보고 제외한다.
+    double run(uint32_t iterations, uint32_t& received)
+    {
+        received = 0;
+        if (!wait_for_matching() || round_trip_us(0) < 0) return -1.0;
+
+        double total_us = 0;
+        for (uint32_t i = 1; i <= iterations; ++i)
+        {
+            double us = round_trip_us(i);
+            if (us < 0) continue;
+            total_us += us;
+            ++received;
+        }
+        return received > 0 ? total_us / received : -1.0;
+    }
+};
+
+// 한 크기에 대해 두 경로를 측정하고 결과를 출력한다
+template<uint32_t N>
+void run_plain_benchmark_size(uint32_t iterations)
+{
+    double results[2] = {-1.0, -1.0};
+    uint32_t received[2] = {0, 0};
+
+    for (int zero_copy = 0; zero_copy < 2; ++zero_copy)
+    {
+        PlainPayloadBenchmark<N> bench(zero_copy != 0);
+        if (!bench.init())
+        {
+            std::cerr << "벤치마크 초기화 실패 (크기: " << N << " 바이트, "
+                      << (zero_copy ? "zero-copy" : "직렬화") << ")" << std::endl;
+            continue;
+        }
+        results[zero_copy] = bench.run(iterations, received[zero_copy]);
+    }
+
+    std::cout << std::setw(10) << N << " | "
+              << std::setw(12) << std::fixed << std::setprecision(1) << results[0] << " (" << received[0] << ") | "
+              << std::setw(12) << results[1] << " (" << received[1] << ") | ";
+    if (results[0] > 0 && results[1] > 0)
+    {
+        std::cout << std::setprecision(2) << results[0] / results[1] << "x";
+    }
+    else
+    {
+        std::cout << "-";
+    }
+    std::cout << std::endl;
+}
+
+// 1KB ~ 16MB plain 샘플에 대해 직렬화 경로와 zero-copy 경로를 비교한다
+void run_plain_benchmark(uint32_t iterations)
+{
+    // 같은 프로세스 안의 리더도 DataSharing / 전송 계층을 거치도록 intraprocess 전달을 끈다
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    DomainParticipantFactory::get_instance()->set_library_settings(settings);
+
+    std::cout << "=== plain 타입 벤치마크 (샘플당 평균 왕복 시간 us, 반복: " << iterations << ") ===" << std::endl;
+    std::cout << "  크기(B) |  직렬화 경로 (수신) | zero-copy 경로 (수신) | 배율" << std::endl;
+
+    run_plain_benchmark_size<1024>(iterations);
+    run_plain_benchmark_size<4 * 1024>(iterations);
+    run_plain_benchmark_size<16 * 1024>(iterations);
+    run_plain_benchmark_size<64 * 1024>(iterations);
+    run_plain_benchmark_size<256 * 1024>(iterations);
+    run_plain_benchmark_size<1024 * 1024>(iterations);
+    run_plain_benchmark_size<4 * 1024 * 1024>(iterations);
+    run_plain_benchmark_size<16 * 1024 * 1024>(iterations);
+
+    std::cout << "=== plain 타입 벤치마크 종료 ===" << std::endl;
+}
+
+// 현재 스레드의 CPU 시간 (us)
+static double thread_cpu_us()
+{
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// 프로세스 전체 CPU 시간 (us)
+static double process_cpu_us()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1e6 + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+// 프로세스 RSS (바이트)
+static size_t resident_memory_bytes()
+{
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    statm >> total_pages >> resident_pages;
+    return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+// 프로세스의 스레드 수
+static size_t thread_count()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 8, "Threads:") == 0)
+        {
+            return static_cast<size_t>(std::stoul(line.substr(8)));
+        }
+    }
+    return 0;
+}
+
+// 깊은 히스토리 벤치마크
+// KEEP_ALL 신뢰성 writer 하나가 depth 개의 샘플을 한 번에 쓰고, 여러 reader 가 모두 확인할 때까지의 시간을 잰다.
+// writer 쪽 ReaderProxy 가 reader 마다 depth 개의 변경을 들고 있으므로 ACKNACK 처리, NACK 표시,
+// 다음 미전송 변경 찾기 비용이 그대로 드러난다.
+class HistoryDepthBenchmark
+{
+private:
+    uint32_t depth_;
+    DomainParticipant* writer_participant_;
+    DomainParticipant* reader_participant_;
+    Publisher* publisher_;
+    Subscriber* subscriber_;
+    Topic* writer_topic_;
+    Topic* reader_topic_;
+    DataWriter* writer_;
+    std::vector<DataReader*> readers_;
+    TypeSupport type_;
+
+public:
+    explicit HistoryDepthBenchmark(uint32_t depth)
+        : depth_(depth)
+        , writer_participant_(nullptr)
+        , reader_participant_(nullptr)
+        , publisher_(nullptr)
+        , subscriber_(nullptr)
+        , writer_topic_(nullptr)
+        , reader_topic_(nullptr)
+        , writer_(nullptr)
+        , type_(new HelloWorldPubSubType())
+    {
+    }
+
+    ~HistoryDepthBenchmark()
+    {
+        for (DataReader* reader : readers_) subscriber_->delete_datareader(reader);
+        if (writer_ != nullptr) publisher_->delete_datawriter(writer_);
+        if (subscriber_ != nullptr) reader_participant_->delete_subscriber(subscriber_);
+        if (publisher_ != nullptr) writer_participant_->delete_publisher(publisher_);
+        if (reader_topic_ != nullptr) reader_participant_->delete_topic(reader_topic_);
+        if (writer_topic_ != nullptr) writer_participant_->delete_topic(writer_topic_);
+        if (reader_participant_ != nullptr)
+            DomainParticipantFactory::get_instance()->delete_participant(reader_participant_);
+        if (writer_participant_ != nullptr)
+            DomainParticipantFactory::get_instance()->delete_participant(writer_participant_);
+    }
+
+    bool init(uint32_t num_readers)
+    {
+        writer_participant_ = DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+        reader_participant_ = DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+        if (writer_participant_ == nullptr || reader_participant_ == nullptr) return false;
+
+        type_.register_type(writer_participant_);
+        type_.register_type(reader_participant_);
+
+        writer_topic_ = writer_participant_->create_topic("HistoryDepthTopic", type_.get_type_name(),
+                        TOPIC_QOS_DEFAULT);
+        reader_topic_ = reader_participant_->create_topic("HistoryDepthTopic", type_.get_type_name(),
+                        TOPIC_QOS_DEFAULT);
+        if (writer_topic_ == nullptr || reader_topic_ == nullptr) return false;
+
+        publisher_ = writer_participant_->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+        subscriber_ = reader_participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT, nullptr);
+        if (publisher_ == nullptr || subscriber_ == nullptr) return false;
+
+        // 샘플이 모두 확인될 때까지 writer 히스토리에 남도록 KEEP_ALL 로 depth 개를 받는다
+        DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+        wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        wqos.reliability().max_blocking_time = eprosima::fastdds::dds::Duration_t(10, 0);
+        wqos.history().kind = KEEP_ALL_HISTORY_QOS;
+        wqos.resource_limits().max_samples = static_cast<int32_t>(depth_);
+        wqos.resource_limits().max_samples_per_instance = static_cast<int32_t>(depth_);
+        wqos.reliable_writer_qos().times.heartbeat_period = eprosima::fastdds::dds::Duration_t(0, 100000000);
+        wqos.data_sharing().off();
+
+        DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+        rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        rqos.history().kind = KEEP_ALL_HISTORY_QOS;
+        rqos.resource_limits().max_samples = static_cast<int32_t>(depth_);
+        rqos.resource_limits().max_samples_per_instance = static_cast<int32_t>(depth_);
+        rqos.data_sharing().off();
+
+        writer_ = publisher_->create_datawriter(writer_topic_, wqos, nullptr);
+        if (writer_ == nullptr) return false;
+        for (uint32_t i = 0; i < num_readers; ++i)
+        {
+            DataReader* reader = subscriber_->create_datareader(reader_topic_, rqos, nullptr);
+            if (reader == nullptr) return false;
+            readers_.push_back(reader);
+        }
+
+        // 매칭될 때까지 최대 5초 대기
+        for (int i = 0; i < 500; ++i)
+        {
+            PublicationMatchedStatus status;
+            writer_->get_publication_matched_status(status);
+            if (status.current_count >= static_cast<int32_t>(num_readers)) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+    // depth 개를 쓰는 시간과 모두 확인될 때까지의 시간 (ms), 그 동안의 프로세스 CPU 시간 (ms)
+    bool run(double& write_ms, double& ack_ms, double& cpu_ms)
+    {
+        HelloWorld sample;
+        sample.message("history depth");
+
+        double start_cpu = process_cpu_us();
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < depth_; ++i)
+        {
+            sample.index(i);
+            if (writer_->write(&sample) != RETCODE_OK) return false;
+        }
+        auto written = std::chrono::steady_clock::now();
+        bool acked = writer_->wait_for_acknowledgments(eprosima::fastdds::dds::Duration_t(60, 0)) == RETCODE_OK;
+        auto end = std::chrono::steady_clock::now();
+
+        write_ms = std::chrono::duration<double, std::milli>(written - start).count();
+        ack_ms = std::chrono::duration<double, std::milli>(end - start).count();
+        cpu_ms = (process_cpu_us() - start_cpu) / 1000.0;
+        return acked;
+    }
+};
+
+// 히스토리 깊이별로 측정한다. 이전 빌드와 같은 인자로 돌려 ReaderProxy 변경 전후를 비교한다.
+void run_history_benchmark(uint32_t max_depth, uint32_t num_readers)
+{
+    // 같은 프로세스 안의 reader 도 UDP 와 ACKNACK 를 거치도록 intraprocess 전달을 끈다
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    DomainParticipantFactory::get_instance()->set_library_settings(settings);
+
+    std::cout << "=== 깊은 히스토리 벤치마크 (reader: " << num_readers << ") ===" << std::endl;
+    std::cout << "    깊이 |   쓰기(ms) | 전체 확인(ms) |  CPU(ms) | 샘플당 CPU(us)" << std::endl;
+
+    for (uint32_t depth = 100; depth <= max_depth; depth *= 10)
+    {
+        HistoryDepthBenchmark bench(depth);
+        double write_ms = 0;
+        double ack_ms = 0;
+        double cpu_ms = 0;
+        if (!bench.init(num_readers) || !bench.run(write_ms, ack_ms, cpu_ms))
+        {
+            std::cerr << "벤치마크 실패 (깊이: " << depth << ")" << std::endl;
+            continue;
+        }
+        std::cout << std::setw(8) << depth << " | " << std::fixed << std::setprecision(1)
+                  << std::setw(10) << write_ms << " | " << std::setw(13) << ack_ms << " | "
+                  << std::setw(8) << cpu_ms << " | " << std::setprecision(2)
+                  << std::setw(10) << cpu_ms * 1000.0 / depth << std::endl;
+    }
+
+    std::cout << "=== 깊은 히스토리 벤치마크 종료 ===" << std::endl;
+}
+
+// 타이머 부하 벤치마크
+// 참여자 하나에 deadline 과 lifespan QoS 를 가진 writer 를 여러 개 만든다. writer 마다 이벤트 스레드의 타이머가
+// 두 개씩 생기고, deadline 타이머는 주기마다 만료되어 다시 예약된다.
+//  - 주기 단계: 샘플을 한 번씩만 쓰고 기다리며 주기 타이머를 처리하는 프로세스 CPU 를 잰다
+//  - 재시작 단계: writer 를 돌아가며 계속 쓴다. 쓸 때마다 deadline 타이머가 취소 후 재시작되고
+//    lifespan 타이머가 재시작된다
+class TimerLoadBenchmark
+{
+private:
+    class DeadlineListener : public DataWriterListener
+    {
+    public:
+        std::atomic<uint64_t> missed {0};
+
+        void on_offered_deadline_missed(
+                DataWriter*,
+                const OfferedDeadlineMissedStatus&) override
+        {
+            ++missed;
+        }
+    };
+
+    uint32_t num_writers_;
+    uint32_t period_ms_;
+    DomainParticipant* participant_;
+    Publisher* publisher_;
+    Topic* topic_;
+    std::vector<DataWriter*> writers_;
+    DeadlineListener listener_;
+    TypeSupport type_;
+
+public:
+    TimerLoadBenchmark(uint32_t num_writers, uint32_t period_ms)
+        : num_writers_(num_writers)
+        , period_ms_(period_ms)
+        , participant_(nullptr)
+        , publisher_(nullptr)
+        , topic_(nullptr)
+        , type_(new HelloWorldPubSubType())
+    {
+    }
+
+    ~TimerLoadBenchmark()
+    {
+        for (DataWriter* writer : writers_) publisher_->delete_datawriter(writer);
+        if (publisher_ != nullptr) participant_->delete_publisher(publisher_);
+        if (topic_ != nullptr) participant_->delete_topic(topic_);
+        if (participant_ != nullptr) DomainParticipantFactory::get_instance()->delete_participant(participant_);
+    }
+
+    bool init()
+    {
+        participant_ = DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+        if (participant_ == nullptr) return false;
+
+        type_.register_type(participant_);
+        topic_ = participant_->create_topic("TimerLoadTopic", type_.get_type_name(), TOPIC_QOS_DEFAULT);
+        publisher_ = participant_->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+        if (topic_ == nullptr || publisher_ == nullptr) return false;
+
+        // reader 가 없으므로 신뢰성 타이머는 돌지 않고 deadline / lifespan 타이머만 남는다
+        DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+        wqos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+        wqos.durability().kind = VOLATILE_DURABILITY_QOS;
+        wqos.history().kind = KEEP_LAST_HISTORY_QOS;
+        wqos.history().depth = 1;
+        wqos.deadline().period = eprosima::fastdds::dds::Duration_t(0, period_ms_ * 1000000u);
+        wqos.lifespan().duration = eprosima::fastdds::dds::Duration_t(10, 0);
+        wqos.data_sharing().off();
+
+        writers_.reserve(num_writers_);
+        for (uint32_t i = 0; i < num_writers_; ++i)
+        {
+            DataWriter* writer = publisher_->create_datawriter(topic_, wqos, &listener_,
+                            StatusMask::offered_deadline_missed());
+            if (writer == nullptr) return false;
+            writers_.push_back(writer);
+        }
+        return true;
+    }
+
+    // 샘플을 한 번씩 써서 타이머를 시작하고 seconds 동안 기다린다. 만료 횟수와 프로세스 CPU (ms)
+    void run_periodic(uint32_t seconds, uint64_t& expirations, double& cpu_ms)
+    {
+        HelloWorld sample;
+        sample.message("timer load");
+        for (DataWriter* writer : writers_) writer->write(&sample);
+
+        // 첫 만료가 지나 타이머들이 주기에 고르게 퍼질 때까지 기다린다
+        std::this_thread::sleep_for(std::chrono::milliseconds(2 * period_ms_));
+
+        uint64_t start_missed = listener_.missed.load();
+        double start_cpu = process_cpu_us();
+        std::this_thread::sleep_for(std::chrono::seconds(seconds));
+        cpu_ms = (process_cpu_us() - start_cpu) / 1000.0;
+        expirations = listener_.missed.load() - start_missed;
+    }
+
+    // seconds 동안 writer 를 돌아가며 쓴다. 쓴 횟수와 프로세스 CPU (ms)
+    void run_restart_storm(uint32_t seconds, uint64_t& writes, double& cpu_ms)
+    {
+        HelloWorld sample;
+        sample.message("timer load");
+        writes = 0;
+
+        double start_cpu = process_cpu_us();
+        auto end = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+        while (std::chrono::steady_clock::now() < end)
+        {
+            for (uint32_t i = 0; i < 1000; ++i)
+            {
+                sample.index(static_cast<uint32_t>(writes));
+                writers_[writes % writers_.size()]->write(&sample);
+                ++writes;
+            }
+        }
+        cpu_ms = (process_cpu_us() - start_cpu) / 1000.0;
+    }
+};
+
+// 주기 타이머 처리 비용과 타이머 재시작 비용을 잰다. 같은 인자로 이전 빌드와 비교한다.
+void run_timer_benchmark(uint32_t num_writers, uint32_t period_ms, uint32_t seconds)
+{
+    std::cout << "=== 타이머 부하 벤치마크 (writer: " << num_writers << ", 타이머: " << 2 * num_writers
+              << ", deadline 주기: " << period_ms << " ms, 측정: " << seconds << " s) ===" << std::endl;
+
+    TimerLoadBenchmark bench(num_writers, period_ms);
+    if (!bench.init())
+    {
+        std::cerr << "벤치마크 초기화 실패" << std::endl;
+        return;
+    }
+
+    uint64_t expirations = 0;
+    double periodic_cpu_ms = 0;
+    bench.run_periodic(seconds, expirations, periodic_cpu_ms);
+    double expected = static_cast<double>(num_writers) * seconds * 1000.0 / period_ms;
+    std::cout << std::fixed << std::setprecision(1)
+              << "  주기 단계:   만료 " << expirations << "회 (예상 " << expected << "회), CPU " << periodic_cpu_ms
+              << " ms, 만료당 CPU " << std::setprecision(2)
+              << (expirations > 0 ? periodic_cpu_ms * 1000.0 / expirations : 0.0) << " us" << std::endl;
+
+    uint64_t writes = 0;
+    double storm_cpu_ms = 0;
+    bench.run_restart_storm(seconds, writes, storm_cpu_ms);
+    std::cout << std::setprecision(1)
+              << "  재시작 단계: 쓰기 " << writes << "회 (" << writes / std::max(seconds, 1u) << "회/s), CPU "
+              << storm_cpu_ms << " ms, 쓰기당 CPU " << std::setprecision(2)
+              << (writes > 0 ? storm_cpu_ms * 1000.0 / writes : 0.0) << " us" << std::endl;
+
+    std::cout << "=== 타이머 부하 벤치마크 종료 ===" << std::endl;
+}
+
+// 디스커버리 부하 시뮬레이션
+// 실제 DomainParticipant 몇 개를 수천 개의 가벼운 가상 원격 참여자와 디스커버리시킨다.
+// 가상 참여자는 DomainParticipant 를 만들지 않고, 미리 인코딩해 둔 SPDP/SEDP 메시지를
+// 시뮬레이터 안의 모의 네트워크로 보내며 HEARTBEAT / ACKNACK 에 응답만 한다.
+//  - 실제 참여자는 UDPv4 를 감싼 ChainingTransport 를 사용하고, 송신한 데이터그램은 소켓 대신
+//    모의 네트워크 큐로 들어간다. 큐는 스레드 하나가 포트별로 수신자 또는 가상 참여자에게 전달한다.
+//  - 완전 매칭 시간, 원격 참여자당 메모리, 실제 참여자의 디스커버리 CPU 비용을 출력한다.
+
+// RTPS 상수 (DDSI-RTPS 2.3)
+const uint8_t RTPS_INFO_DST = 0x0e;
+const uint8_t RTPS_DATA = 0x15;
+const uint8_t RTPS_HEARTBEAT = 0x07;
+const uint8_t RTPS_ACKNACK = 0x06;
+
+const uint8_t RTPS_FLAG_LE = 0x01;
+const uint8_t RTPS_FLAG_FINAL = 0x02;
+const uint8_t RTPS_FLAG_INLINE_QOS = 0x02;
+const uint8_t RTPS_FLAG_DATA = 0x04;
+
+const uint32_t ENTITY_SPDP_WRITER = 0x000100c2;
+const uint32_t ENTITY_SPDP_READER = 0x000100c7;
+const uint32_t ENTITY_SEDP_PUB_WRITER = 0x000003c2;
+const uint32_t ENTITY_SEDP_PUB_READER = 0x000003c7;
+const uint32_t ENTITY_SEDP_SUB_WRITER = 0x000004c2;
+const uint32_t ENTITY_SEDP_SUB_READER = 0x000004c7;
+const uint32_t ENTITY_PARTICIPANT = 0x000001c1;
+
+const uint16_t PID_PAD_ID = 0x0000;
+const uint16_t PID_SENTINEL_ID = 0x0001;
+const uint16_t PID_PARTICIPANT_LEASE_DURATION_ID = 0x0002;
+const uint16_t PID_TOPIC_NAME_ID = 0x0005;
+const uint16_t PID_TYPE_NAME_ID = 0x0007;
+const uint16_t PID_DOMAIN_ID_ID = 0x000f;
+const uint16_t PID_PROTOCOL_VERSION_ID = 0x0015;
+const uint16_t PID_VENDORID_ID = 0x0016;
+const uint16_t PID_RELIABILITY_ID = 0x001a;
+const uint16_t PID_DEFAULT_UNICAST_LOCATOR_ID = 0x0031;
+const uint16_t PID_METATRAFFIC_UNICAST_LOCATOR_ID = 0x0032;
+const uint16_t PID_PARTICIPANT_GUID_ID = 0x0050;
+const uint16_t PID_BUILTIN_ENDPOINT_SET_ID = 0x0058;
+const uint16_t PID_ENDPOINT_GUID_ID = 0x005a;
+
+// SPDP/SEDP 의 announcer/detector 만 제공한다 (WLP, TypeLookup 없음)
+const uint32_t VIRTUAL_BUILTIN_ENDPOINTS = 0x0000003f;
+
+// 도메인 0 의 메타트래픽 멀티캐스트 포트
+const uint32_t METATRAFFIC_MULTICAST_PORT = 7400;
+
+// 가상 참여자 i 는 FIRST_VIRTUAL_PORT + 2i (메타트래픽), + 2i + 1 (사용자 데이터) 포트를 쓴다
+const uint32_t FIRST_VIRTUAL_PORT = 20000;
+const uint32_t MAX_VIRTUAL_PARTICIPANTS = 20000;
+
+const char* const DISCOVERY_LOAD_TOPIC_PREFIX = "DiscoveryLoadTopic_";
+const uint32_t DISCOVERY_LOAD_TOPICS = 10;
+
+typedef std::array<uint8_t, 12> RtpsGuidPrefix;
+
+// 리틀 엔디안 RTPS 메시지 작성기
+class RtpsMessageBuilder
+{
+public:
+    explicit RtpsMessageBuilder(std::vector<uint8_t>& out)
+        : out_(out)
+    {
+    }
+
+    void u8(uint8_t value)
+    {
+        out_.push_back(value);
+    }
+
+    void u16(uint16_t value)
+    {
+        out_.push_back(static_cast<uint8_t>(value));
+        out_.push_back(static_cast<uint8_t>(value >> 8));
+    }
+
+    void u32(uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i) out_.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+
+    // 엔티티 ID 는 바이트 배열이므로 항상 빅 엔디안 순서로 쓴다
+    void entity_id(uint32_t value)
+    {
+        for (int i = 3; i >= 0; --i) out_.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+
+    void sequence_number(uint64_t value)
+    {
+        u32(static_cast<uint32_t>(value >> 32));
+        u32(static_cast<uint32_t>(value));
+    }
+
+    void bytes(const uint8_t* data, size_t size)
+    {
+        out_.insert(out_.end(), data, data + size);
+    }
+
+    void prefix(const RtpsGuidPrefix& value)
+    {
+        bytes(value.data(), value.size());
+    }
+
+    void header(const RtpsGuidPrefix& source)
+    {
+        const uint8_t magic[] = {'R', 'T', 'P', 'S', 2, 3, 0x01, 0x0f};
+        bytes(magic, sizeof(magic));
+        prefix(source);
+    }
+
+    void info_dst(const RtpsGuidPrefix& destination)
+    {
+        u8(RTPS_INFO_DST);
+        u8(RTPS_FLAG_LE);
+        u16(12);
+        prefix(destination);
+    }
+
+    void heartbeat(uint32_t reader_id, uint32_t writer_id, uint64_t first, uint64_t last, uint32_t count)
+    {
+        u8(RTPS_HEARTBEAT);
+        u8(RTPS_FLAG_LE);
+        u16(28);
+        entity_id(reader_id);
+        entity_id(writer_id);
+        sequence_number(first);
+        sequence_number(last);
+        u32(count);
+    }
+
+    // 비트맵 없이 base 이전을 모두 받았다고 알리는 ACKNACK
+    void acknack(uint32_t reader_id, uint32_t writer_id, uint64_t base, uint32_t count)
+    {
+        u8(RTPS_ACKNACK);
+        u8(RTPS_FLAG_LE | RTPS_FLAG_FINAL);
+        u16(24);
+        entity_id(reader_id);
+        entity_id(writer_id);
+        sequence_number(base);
+        u32(0);
+        u32(count);
+    }
+
+    // 파라미터 리스트 페이로드를 가진 DATA 서브메시지. 길이는 end_data 에서 채운다.
+    size_t begin_data(uint32_t reader_id, uint32_t writer_id, uint64_t sequence_number)
+    {
+        size_t start = out_.size();
+        u8(RTPS_DATA);
+        u8(RTPS_FLAG_LE | RTPS_FLAG_DATA);
+        u16(0);
+        u16(0);
+        u16(16);
+        entity_id(reader_id);
+        entity_id(writer_id);
+        this->sequence_number(sequence_number);
+        // PL_CDR_LE 캡슐화
+        const uint8_t encapsulation[] = {0x00, 0x03, 0x00, 0x00};
+        bytes(encapsulation, sizeof(encapsulation));
+        return start;
+    }
+
+    void end_data(size_t start)
+    {
+        parameter_header(PID_SENTINEL_ID, 0);
+        uint16_t length = static_cast<uint16_t>(out_.size() - start - 4);
+        out_[start + 2] = static_cast<uint8_t>(length);
+        out_[start + 3] = static_cast<uint8_t>(length >> 8);
+    }
+
+    void parameter_header(uint16_t pid, uint16_t length)
+    {
+        u16(pid);
+        u16(length);
+    }
+
+    void parameter_guid(uint16_t pid, const RtpsGuidPrefix& guid_prefix, uint32_t entity)
+    {
+        parameter_header(pid, 16);
+        prefix(guid_prefix);
+        entity_id(entity);
+    }
+
+    void parameter_locator(uint16_t pid, uint32_t port)
+    {
+        const uint8_t loopback[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 0, 0, 1};
+        parameter_header(pid, 24);
+        u32(LOCATOR_KIND_UDPv4);
+        u32(port);
+        bytes(loopback, sizeof(loopback));
+    }
+
+    void parameter_string(uint16_t pid, const std::string& value)
+    {
+        uint32_t length = static_cast<uint32_t>(value.size() + 1);
+        uint32_t padded = (length + 3) & ~3u;
+        parameter_header(pid, static_cast<uint16_t>(4 + padded));
+        u32(length);
+        bytes(reinterpret_cast<const uint8_t*>(value.c_str()), length);
+        for (uint32_t i = length; i < padded; ++i) u8(0);
+    }
+
+    void parameter_u32(uint16_t pid, uint32_t value)
+    {
+        parameter_header(pid, 4);
+        u32(value);
+    }
+
+private:
+    std::vector<uint8_t>& out_;
+};
+
+// 수신한 RTPS 메시지 읽기 도우미 (서브메시지마다 엔디안 플래그를 따른다)
+static uint16_t rtps_read_u16(const uint8_t* p, bool le)
+{
+    return le ? static_cast<uint16_t>(p[0] | (p[1] << 8)) : static_cast<uint16_t>((p[0] << 8) | p[1]);
+}
+
+static uint32_t rtps_read_u32(const uint8_t* p, bool le)
+{
+    return le ? (static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24)) :
+           ((static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+           (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]));
+}
+
+static uint32_t rtps_read_entity_id(const uint8_t* p)
+{
+    return rtps_read_u32(p, false);
+}
+
+static uint64_t rtps_read_sequence_number(const uint8_t* p, bool le)
+{
+    return (static_cast<uint64_t>(rtps_read_u32(p, le)) << 32) | rtps_read_u32(p + 4, le);
+}
+
+class DiscoveryLoadEmulator;
+class DiscoveryLoadTransport;
+
+// 모의 네트워크: 포트별로 실제 참여자의 수신자를 등록하고, 데이터그램을 스레드 하나에서 전달한다
+class DiscoveryLoadNetwork
+{
+private:
+    struct Channel
+    {
+        const DiscoveryLoadTransport* transport;
+        Locator_t locator;
+        TransportReceiverInterface* receiver;
+    };
+
+    struct Datagram
+    {
+        std::shared_ptr<const std::vector<uint8_t>> data;
+        Locator_t destination;
+        Locator_t source;
+        bool from_virtual;
+    };
+
+    std::mutex channels_mutex_;
+    std::unordered_map<uint32_t, std::vector<Channel>> channels_;
+
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    std::deque<Datagram> queue_;
+
+    DiscoveryLoadEmulator* emulator_;
+    std::atomic<bool> running_;
+    std::atomic<bool> announce_now_;
+    std::thread thread_;
+
+    // 통계
+    std::atomic<uint64_t> to_virtual_;
+    std::atomic<uint64_t> from_virtual_;
+    // 측정 중에도 읽을 수 있도록 나노초 단위 원자 변수로 쌓는다
+    std::atomic<uint64_t> emulator_cpu_ns_;
+
+    static bool is_multicast(const Locator_t& locator)
+    {
+        return locator.kind == LOCATOR_KIND_UDPv4 && locator.address[12] >= 224 && locator.address[12] <= 239;
+    }
+
+    void add_emulator_cpu(double start_us)
+    {
+        emulator_cpu_ns_ += static_cast<uint64_t>((thread_cpu_us() - start_us) * 1000.0);
+    }
+
+    void deliver(const Datagram& datagram);
+
+    void run();
+
+public:
+    DiscoveryLoadNetwork()
+        : emulator_(nullptr)
+        , running_(false)
+        , announce_now_(false)
+        , to_virtual_(0)
+        , from_virtual_(0)
+        , emulator_cpu_ns_(0)
+    {
+    }
+
+    ~DiscoveryLoadNetwork()
+    {
+        stop();
+    }
+
+    void open(const DiscoveryLoadTransport* transport, const Locator_t& locator, TransportReceiverInterface* receiver)
+    {
+        std::lock_guard<std::mutex> lock(channels_mutex_);
+        std::vector<Channel>& channels = channels_[locator.port];
+        for (const Channel& channel : channels)
+        {
+            if (channel.transport == transport && channel.locator == locator) return;
+        }
+        channels.push_back({transport, locator, receiver});
+    }
+
+    bool is_open(const DiscoveryLoadTransport* transport, const Locator_t& locator)
+    {
+        std::lock_guard<std::mutex> lock(channels_mutex_);
+        auto it = channels_.find(locator.port);
+        if (it == channels_.end()) return false;
+        for (const Channel& channel : it->second)
+        {
+            if (channel.transport == transport && channel.locator == locator) return true;
+        }
+        return false;
+    }
+
+    bool close(const DiscoveryLoadTransport* transport, const Locator_t& locator)
+    {
+        std::lock_guard<std::mutex> lock(channels_mutex_);
+        auto it = channels_.find(locator.port);
+        if (it == channels_.end()) return false;
+        std::vector<Channel>& channels = it->second;
+        for (auto channel = channels.begin(); channel != channels.end(); ++channel)
+        {
+            if (channel->transport == transport && channel->locator == locator)
+            {
+                channels.erase(channel);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void close_all(const DiscoveryLoadTransport* transport)
+    {
+        std::lock_guard<std::mutex> lock(channels_mutex_);
+        for (auto& port : channels_)
+        {
+            std::vector<Channel>& channels = port.second;
+            for (auto channel = channels.begin(); channel != channels.end();)
+            {
+                channel = channel->transport == transport ? channels.erase(channel) : channel + 1;
+            }
+        }
+    }
+
+    void send(std::shared_ptr<const std::vector<uint8_t>> data, const Locator_t& destination,
+            const Locator_t& source, bool from_virtual)
+    {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            queue_.push_back({std::move(data), destination, source, from_virtual});
+        }
+        queue_cv_.notify_one();
+    }
+
+    void start(DiscoveryLoadEmulator* emulator)
+    {
+        emulator_ = emulator;
+        running_ = true;
+        thread_ = std::thread(&DiscoveryLoadNetwork::run, this);
+    }
+
+    // 다음 주기를 기다리지 않고 가상 참여자들이 바로 알림을 보내게 한다
+    void announce_now()
+    {
+        announce_now_ = true;
+        queue_cv_.notify_one();
+    }
+
+    // 전달 스레드를 멈추고 남은 데이터그램을 버린다. 참여자를 지우기 전에 호출해야 한다.
+    void stop()
+    {
+        running_ = false;
+        queue_cv_.notify_one();
+        if (thread_.joinable()) thread_.join();
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        queue_.clear();
+        emulator_ = nullptr;
+    }
+
+    uint64_t datagrams_to_virtual() const
+    {
+        return to_virtual_;
+    }
+
+    uint64_t datagrams_from_virtual() const
+    {
+        return from_virtual_;
+    }
+
+    // 전달 스레드에서 가상 참여자가 사용한 CPU 시간
+    double emulator_cpu_us() const
+    {
+        return static_cast<double>(emulator_cpu_ns_) / 1000.0;
+    }
+};
+
+DiscoveryLoadNetwork& discovery_load_network()
+{
+    static DiscoveryLoadNetwork network;
+    return network;
+}
+
+// 실제 참여자가 사용하는 전송 계층. 입력 채널은 모의 네트워크에 등록하고, 송신은 모의 네트워크 큐로 보낸다.
+// 로케이터 관련 동작은 하위 UDPv4 전송 계층을 그대로 따른다.
+class DiscoveryLoadTransportDescriptor : public ChainingTransportDescriptor
+{
+public:
+    DiscoveryLoadTransportDescriptor()
+        : ChainingTransportDescriptor(std::make_shared<UDPv4TransportDescriptor>())
+    {
+    }
+
+    TransportInterface* create_transport() const override;
+};
+
+class DiscoveryLoadTransport : public ChainingTransport
+{
+private:
+    DiscoveryLoadTransportDescriptor descriptor_;
+
+public:
+    explicit DiscoveryLoadTransport(const DiscoveryLoadTransportDescriptor& descriptor)
+        : ChainingTransport(descriptor)
+        , descriptor_(descriptor)
+    {
+    }
+
+    ~DiscoveryLoadTransport() override
+    {
+        discovery_load_network().close_all(this);
+    }
+
+    TransportDescriptorInterface* get_configuration() override
+    {
+        return &descriptor_;
+    }
+
+    bool IsInputChannelOpen(const Locator_t& locator) const override
+    {
+        return discovery_load_network().is_open(this, locator);
+    }
+
+    // 하위 전송 계층의 소켓과 수신 스레드는 만들지 않는다
+    bool OpenInputChannel(const Locator_t& locator, TransportReceiverInterface* receiver, uint32_t) override
+    {
+        discovery_load_network().open(this, locator, receiver);
+        return true;
+    }
+
+    bool CloseInputChannel(const Locator_t& locator) override
+    {
+        return discovery_load_network().close(this, locator);
+    }
+
+    bool send(
+            SenderResource*,
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point&) override
+    {
+        std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+        data->reserve(total_bytes);
+        for (const NetworkBuffer& buffer : buffers)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(buffer.buffer);
+            data->insert(data->end(), bytes, bytes + buffer.size);
+        }
+
+        Locator_t source;
+        LocatorsIterator& it = *destination_locators_begin;
+        while (it != *destination_locators_end)
+        {
+            discovery_load_network().send(data, *it, source, false);
+            ++it;
+        }
+        return true;
+    }
+
+    void receive(
+            TransportReceiverInterface* next_receiver,
+            const octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            const Locator_t& local_locator,
+            const Locator_t& remote_locator) override
+    {
+        next_receiver->OnDataReceived(receive_buffer, receive_buffer_size, local_locator, remote_locator);
+    }
+};
+
+TransportInterface* DiscoveryLoadTransportDescriptor::create_transport() const
+{
+    return new DiscoveryLoadTransport(*this);
+}
+
+// 가상 원격 참여자들. 모든 처리는 모의 네트워크의 전달 스레드에서 이루어진다.
+class DiscoveryLoadEmulator
+{
+private:
+    struct VirtualParticipant
+    {
+        RtpsGuidPrefix prefix;
+        uint32_t metatraffic_port;
+        // 미리 인코딩한 DATA 서브메시지
+        std::vector<uint8_t> participant_data;
+        std::vector<std::vector<uint8_t>> writer_data;
+        std::vector<std::vector<uint8_t>> reader_data;
+        // writer_data[0] / reader_data[0] 의 시퀀스 번호. 엔드포인트를 다시 알릴 때마다 늘어난다.
+        uint64_t first_writer_sn;
+        uint64_t first_reader_sn;
+        uint32_t heartbeat_count;
+        uint32_t acknack_count;
+        // 실제 참여자별로 SEDP 데이터가 모두 확인되었는지 (1: publications, 2: subscriptions)
+        std::vector<uint8_t> sedp_acked;
+    };
+
+    struct RealParticipant
+    {
+        RtpsGuidPrefix prefix;
+        uint32_t metatraffic_port;
+    };
+
+    DiscoveryLoadNetwork& network_;
+    std::vector<VirtualParticipant> participants_;
+    std::vector<RealParticipant> real_participants_;
+    std::atomic<bool> enabled_;
+    uint32_t lease_duration_s_;
+    // DATA(p) 의 시퀀스 번호. 다음 알림 때 미리 인코딩한 DATA(p) 에 반영한다.
+    std::atomic<uint64_t> participant_sequence_number_;
+    uint64_t encoded_participant_sequence_number_;
+    // 다음 알림에서 DATA(p) 대신 SEDP 데이터를 다시 보낼지와, 그때 SEDP DATA 의 PID_PAD 에 넣을 값
+    std::atomic<bool> reannounce_endpoints_;
+    std::atomic<uint32_t> endpoint_pad_;
+
+    Locator_t port_locator(uint32_t port) const
+    {
+        Locator_t locator;
+        locator.kind = LOCATOR_KIND_UDPv4;
+        locator.port = port;
+        locator.address[12] = 127;
+        locator.address[15] = 1;
+        return locator;
+    }
+
+    void send(const VirtualParticipant& participant, std::vector<uint8_t>&& message, uint32_t port)
+    {
+        network_.send(std::make_shared<const std::vector<uint8_t>>(std::move(message)), port_locator(port),
+                port_locator(participant.metatraffic_port), true);
+    }
+
+    // SEDP writer 의 DATA 를 [first, last] 범위에서 골라 HEARTBEAT 와 함께 보낸다
+    void send_sedp(VirtualParticipant& participant, const RealParticipant& real, bool publications,
+            const std::vector<uint64_t>& sequence_numbers)
+    {
+        const std::vector<std::vector<uint8_t>>& data = publications ? participant.writer_data : participant.reader_data;
+        uint64_t first = publications ? participant.first_writer_sn : participant.first_reader_sn;
+        std::vector<uint8_t> message;
+        RtpsMessageBuilder builder(message);
+        builder.header(participant.prefix);
+        builder.info_dst(real.prefix);
+        for (uint64_t sn : sequence_numbers)
+        {
+            if (sn >= first && sn - first < data.size())
+            {
+                builder.bytes(data[sn - first].data(), data[sn - first].size());
+            }
+        }
+        builder.heartbeat(publications ? ENTITY_SEDP_PUB_READER : ENTITY_SEDP_SUB_READER,
+                publications ? ENTITY_SEDP_PUB_WRITER : ENTITY_SEDP_SUB_WRITER,
+                first, first + data.size() - 1, ++participant.heartbeat_count);
+        send(participant, std::move(message), real.metatraffic_port);
+    }
+
+    // 미리 인코딩한 SEDP DATA 의 시퀀스 번호를 first 부터 다시 매기고 PID_PAD 값을 바꾼다
+    static void renumber_sedp_data(std::vector<std::vector<uint8_t>>& data, uint64_t first, uint32_t pad)
+    {
+        std::vector<uint8_t> encoded;
+        RtpsMessageBuilder builder(encoded);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            encoded.clear();
+            builder.sequence_number(first + i);
+            builder.u32(pad);
+            // DATA 서브메시지의 writerSN 은 16 바이트, 첫 파라미터인 PID_PAD 의 값은 32 바이트 위치에 있다
+            std::copy(encoded.begin(), encoded.begin() + 8, data[i].begin() + 16);
+            std::copy(encoded.begin() + 8, encoded.end(), data[i].begin() + 32);
+        }
+    }
+
+    // 모든 가상 참여자의 DATA(w)/DATA(r) 을 새 시퀀스 번호로 실제 참여자들에게 다시 보낸다
+    void resend_endpoint_data(uint32_t pad)
+    {
+        std::vector<uint64_t> sequence_numbers;
+        for (VirtualParticipant& participant : participants_)
+        {
+            participant.first_writer_sn += participant.writer_data.size();
+            participant.first_reader_sn += participant.reader_data.size();
+            renumber_sedp_data(participant.writer_data, participant.first_writer_sn, pad);
+            renumber_sedp_data(participant.reader_data, participant.first_reader_sn, pad);
+            for (size_t real = 0; real < real_participants_.size(); ++real)
+            {
+                // 새 데이터가 확인될 때까지 주기적인 HEARTBEAT 를 다시 보낸다
+                participant.sedp_acked[real] = 0;
+                for (int publications = 1; publications >= 0; --publications)
+                {
+                    uint64_t first = publications ? participant.first_writer_sn : participant.first_reader_sn;
+                    size_t count = publications ? participant.writer_data.size() : participant.reader_data.size();
+                    sequence_numbers.clear();
+                    for (size_t i = 0; i < count; ++i) sequence_numbers.push_back(first + i);
+                    send_sedp(participant, real_participants_[real], publications != 0, sequence_numbers);
+                }
+            }
+        }
+    }
+
+    void send_participant_data(const VirtualParticipant& participant, const RealParticipant* real)
+    {
+        std::vector<uint8_t> message;
+        RtpsMessageBuilder builder(message);
+        builder.header(participant.prefix);
+        if (real != nullptr) builder.info_dst(real->prefix);
+        builder.bytes(participant.participant_data.data(), participant.participant_data.size());
+        send(participant, std::move(message), real != nullptr ? real->metatraffic_port : METATRAFFIC_MULTICAST_PORT);
+    }
+
+    // SPDP DATA(p) 페이로드에서 참여자 GUID 와 메타트래픽 유니캐스트 포트를 읽는다
+    void on_participant_data(const uint8_t* payload, size_t size)
+    {
+        if (size < 4 || payload[0] != 0x00 || (payload[1] != 0x02 && payload[1] != 0x03)) return;
+        bool le = payload[1] == 0x03;
+
+        RealParticipant real;
+        bool has_guid = false;
+        bool has_port = false;
+        size_t pos = 4;
+        while (pos + 4 <= size)
+        {
+            uint16_t pid = rtps_read_u16(payload + pos, le);
+            uint16_t length = rtps_read_u16(payload + pos + 2, le);
+            pos += 4;
+            if (pid == PID_SENTINEL_ID || pos + length > size) break;
+            if (pid == PID_PARTICIPANT_GUID_ID && length >= 16)
+            {
+                memcpy(real.prefix.data(), payload + pos, 12);
+                has_guid = true;
+            }
+            else if (pid == PID_METATRAFFIC_UNICAST_LOCATOR_ID && length >= 24 && !has_port &&
+                    static_cast<int32_t>(rtps_read_u32(payload + pos, le)) == LOCATOR_KIND_UDPv4)
+            {
+                real.metatraffic_port = rtps_read_u32(payload + pos + 4, le);
+                has_port = true;
+            }
+            pos += length;
+        }
+        if (!has_guid || !has_port) return;
+
+        for (const RealParticipant& known : real_participants_)
+        {
+            if (known.prefix == real.prefix) return;
+        }
+
+        // 새로 알게 된 실제 참여자에게 모든 가상 참여자를 바로 알린다
+        real_participants_.push_back(real);
+        for (VirtualParticipant& participant : participants_)
+        {
+            participant.sedp_acked.push_back(0);
+            send_participant_data(participant, &real_participants_.back());
+        }
+    }
+
+    int find_real(const RtpsGuidPrefix& prefix) const
+    {
+        for (size_t i = 0; i < real_participants_.size(); ++i)
+        {
+            if (real_participants_[i].prefix == prefix) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    // 실제 참여자의 SEDP writer 가 보낸 HEARTBEAT 에는 모두 받았다고 응답한다
+    void on_heartbeat(VirtualParticipant& participant, int real, uint32_t writer_id, uint64_t last)
+    {
+        uint32_t reader_id = 0;
+        if (writer_id == ENTITY_SEDP_PUB_WRITER) reader_id = ENTITY_SEDP_PUB_READER;
+        else if (writer_id == ENTITY_SEDP_SUB_WRITER) reader_id = ENTITY_SEDP_SUB_READER;
+        if (reader_id == 0 || real < 0) return;
+
+        const RealParticipant& destination = real_participants_[real];
+        std::vector<uint8_t> message;
+        RtpsMessageBuilder builder(message);
+        builder.header(participant.prefix);
+        builder.info_dst(destination.prefix);
+        builder.acknack(reader_id, writer_id, last + 1, ++participant.acknack_count);
+        send(participant, std::move(message), destination.metatraffic_port);
+    }
+
+    // 실제 참여자의 SEDP reader 가 보낸 ACKNACK 에는 빠진 DATA 를 다시 보낸다
+    void on_acknack(VirtualParticipant& participant, int real, uint32_t writer_id, uint64_t base,
+            uint32_t num_bits, const uint8_t* bitmap, bool le)
+    {
+        bool publications = writer_id == ENTITY_SEDP_PUB_WRITER;
+        if ((!publications && writer_id != ENTITY_SEDP_SUB_WRITER) || real < 0) return;
+
+        uint64_t last = publications ? participant.first_writer_sn + participant.writer_data.size() - 1 :
+                participant.first_reader_sn + participant.reader_data.size() - 1;
+        uint8_t acked_flag = publications ? 1 : 2;
+        if (num_bits == 0 && base > last)
+        {
+            participant.sedp_acked[real] |= acked_flag;
+            return;
+        }
+
+        std::vector<uint64_t> missing;
+        if (num_bits == 0)
+        {
+            for (uint64_t sn = base; sn <= last; ++sn) missing.push_back(sn);
+        }
+        else
+        {
+            for (uint32_t bit = 0; bit < num_bits; ++bit)
+            {
+                uint32_t word = rtps_read_u32(bitmap + 4 * (bit / 32), le);
+                if (word & (0x80000000u >> (bit % 32))) missing.push_back(base + bit);
+            }
+        }
+        send_sedp(participant, real_participants_[real], publications, missing);
+    }
+
+public:
+    DiscoveryLoadEmulator(DiscoveryLoadNetwork& network)
+        : network_(network)
+        , enabled_(false)
+        , lease_duration_s_(20)
+        , participant_sequence_number_(1)
+        , encoded_participant_sequence_number_(1)
+        , reannounce_endpoints_(false)
+        , endpoint_pad_(0)
+    {
+    }
+
+    // 가상 참여자와 엔드포인트의 SPDP/SEDP 데이터를 미리 인코딩한다.
+    // 엔드포인트의 절반은 writer (RELIABLE), 나머지는 reader (BEST_EFFORT) 이며 토픽은 돌아가며 배정한다.
+    void build(uint32_t num_participants, uint32_t endpoints_per_participant, const std::string& type_name)
+    {
+        participants_.resize(num_participants);
+        for (uint32_t i = 0; i < num_participants; ++i)
+        {
+            VirtualParticipant& participant = participants_[i];
+            participant.prefix = {0x01, 0x0f, 0x5d, 0x15,
+                                  static_cast<uint8_t>(i >> 24), static_cast<uint8_t>(i >> 16),
+                                  static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i), 0, 0, 0, 1};
+            participant.metatraffic_port = FIRST_VIRTUAL_PORT + 2 * i;
+            participant.first_writer_sn = 1;
+            participant.first_reader_sn = 1;
+            participant.heartbeat_count = 0;
+            participant.acknack_count = 0;
+
+            RtpsMessageBuilder spdp(participant.participant_data);
+            size_t start = spdp.begin_data(ENTITY_SPDP_READER, ENTITY_SPDP_WRITER, 1);
+            spdp.parameter_header(PID_PROTOCOL_VERSION_ID, 4);
+            const uint8_t protocol_version[] = {2, 3, 0, 0};
+            spdp.bytes(protocol_version, sizeof(protocol_version));
+            spdp.parameter_header(PID_VENDORID_ID, 4);
+            const uint8_t vendor_id[] = {0x01, 0x0f, 0, 0};
+            spdp.bytes(vendor_id, sizeof(vendor_id));
+            spdp.parameter_u32(PID_DOMAIN_ID_ID, 0);
+            spdp.parameter_guid(PID_PARTICIPANT_GUID_ID, participant.prefix, ENTITY_PARTICIPANT);
+            spdp.parameter_locator(PID_METATRAFFIC_UNICAST_LOCATOR_ID, participant.metatraffic_port);
+            spdp.parameter_locator(PID_DEFAULT_UNICAST_LOCATOR_ID, participant.metatraffic_port + 1);
+            spdp.parameter_header(PID_PARTICIPANT_LEASE_DURATION_ID, 8);
+            spdp.u32(lease_duration_s_);
+            spdp.u32(0);
+            spdp.parameter_u32(PID_BUILTIN_ENDPOINT_SET_ID, VIRTUAL_BUILTIN_ENDPOINTS);
+            spdp.end_data(start);
+
+            for (uint32_t j = 0; j < endpoints_per_participant; ++j)
+            {
+                bool is_writer = (j % 2) == 0;
+                std::vector<std::vector<uint8_t>>& list = is_writer ? participant.writer_data : participant.reader_data;
+                list.emplace_back();
+                RtpsMessageBuilder sedp(list.back());
+                // 키가 없는 토픽의 사용자 writer(0x03) / reader(0x04)
+                uint32_t entity = ((j + 1) << 8) | (is_writer ? 0x03 : 0x04);
+                start = sedp.begin_data(is_writer ? ENTITY_SEDP_PUB_READER : ENTITY_SEDP_SUB_READER,
+                                is_writer ? ENTITY_SEDP_PUB_WRITER : ENTITY_SEDP_SUB_WRITER, list.size());
+                // 수신 측은 무시하지만, 값을 바꾸면 마지막으로 처리한 DATA 와 내용이 달라진다
+                sedp.parameter_u32(PID_PAD_ID, 0);
+                sedp.parameter_guid(PID_ENDPOINT_GUID_ID, participant.prefix, entity);
+                sedp.parameter_guid(PID_PARTICIPANT_GUID_ID, participant.prefix, ENTITY_PARTICIPANT);
+                sedp.parameter_string(PID_TOPIC_NAME_ID, topic_of(i, j));
+                sedp.parameter_string(PID_TYPE_NAME_ID, type_name);
+                sedp.parameter_header(PID_RELIABILITY_ID, 12);
+                sedp.u32(is_writer ? 2 : 1);
+                sedp.u32(0);
+                sedp.u32(0);
+                sedp.end_data(start);
+            }
+        }
+    }
+
+    static std::string topic_of(uint32_t participant, uint32_t endpoint)
+    {
+        return DISCOVERY_LOAD_TOPIC_PREFIX + std::to_string((participant + endpoint) % DISCOVERY_LOAD_TOPICS);
+    }
+
+    void enable()
+    {
+        enabled_ = true;
+    }
+
+    bool owns_port(uint32_t port) const
+    {
+        return port >= FIRST_VIRTUAL_PORT && port < FIRST_VIRTUAL_PORT + 2 * participants_.size();
+    }
+
+    // 실제 참여자가 가상 참여자의 포트나 멀티캐스트로 보낸 데이터그램 처리
+    void on_datagram(const uint8_t* data, size_t size, uint32_t port, bool multicast)
+    {
+        if (!enabled_ || size < 20 || memcmp(data, "RTPS", 4) != 0) return;
+
+        RtpsGuidPrefix source;
+        memcpy(source.data(), data + 8, 12);
+        VirtualParticipant* participant = multicast ? nullptr :
+                &participants_[(port - FIRST_VIRTUAL_PORT) / 2];
+        int real = find_real(source);
+
+        size_t pos = 20;
+        while (pos + 4 <= size)
+        {
+            uint8_t id = data[pos];
+            uint8_t flags = data[pos + 1];
+            bool le = (flags & RTPS_FLAG_LE) != 0;
+            size_t length = rtps_read_u16(data + pos + 2, le);
+            const uint8_t* body = data + pos + 4;
+            if (length == 0) length = size - pos - 4;
+            if (pos + 4 + length > size) break;
+
+            if (id == RTPS_DATA && length >= 20 && (flags & RTPS_FLAG_DATA) &&
+                    rtps_read_entity_id(body + 8) == ENTITY_SPDP_WRITER)
+            {
+                // 인라인 QoS 가 있으면 건너뛴다
+                size_t offset = 4 + rtps_read_u16(body + 2, le);
+                if (flags & RTPS_FLAG_INLINE_QOS)
+                {
+                    while (offset + 4 <= length)
+                    {
+                        uint16_t pid = rtps_read_u16(body + offset, le);
+                        offset += 4 + rtps_read_u16(body + offset + 2, le);
+                        if (pid == PID_SENTINEL_ID) break;
+                    }
+                }
+                if (offset < length)
+                {
+                    on_participant_data(body + offset, length - offset);
+                    real = find_real(source);
+                }
+            }
+            else if (id == RTPS_HEARTBEAT && length >= 28 && participant != nullptr)
+            {
+                on_heartbeat(*participant, real, rtps_read_entity_id(body + 4),
+                        rtps_read_sequence_number(body + 16, le));
+            }
+            else if (id == RTPS_ACKNACK && length >= 24 && participant != nullptr)
+            {
+                uint32_t num_bits = rtps_read_u32(body + 16, le);
+                if (length >= 24 + 4 * ((num_bits + 31) / 32))
+                {
+                    on_acknack(*participant, real, rtps_read_entity_id(body + 4),
+                            rtps_read_sequence_number(body + 8, le), num_bits, body + 20, le);
+                }
+            }
+            pos += 4 + length;
+        }
+    }
+
+    // 다음 알림부터 DATA(p) 를 내용은 그대로 두고 새 시퀀스 번호로 보낸다
+    void set_participant_sequence_number(uint64_t sequence_number)
+    {
+        participant_sequence_number_ = sequence_number;
+    }
+
+    // 다음 알림에서는 DATA(p) 대신 모든 DATA(w)/DATA(r) 을 새 시퀀스 번호로 다시 보낸다.
+    // change_content 이면 PID_PAD 값도 바꿔서, 마지막으로 처리한 DATA 와 비교해 건너뛸 수 없게 한다.
+    void reannounce_endpoints(bool change_content)
+    {
+        if (change_content) ++endpoint_pad_;
+        reannounce_endpoints_ = true;
+    }
+
+    // 주기적인 SPDP 알림과, 아직 확인되지 않은 SEDP 데이터의 HEARTBEAT
+    void announce()
+    {
+        if (!enabled_) return;
+
+        if (reannounce_endpoints_.exchange(false))
+        {
+            resend_endpoint_data(endpoint_pad_);
+            return;
+        }
+
+        uint64_t sequence_number = participant_sequence_number_;
+        if (sequence_number != encoded_participant_sequence_number_)
+        {
+            // DATA 서브메시지의 writerSN 은 16 바이트 위치에 있다
+            std::vector<uint8_t> encoded;
+            RtpsMessageBuilder builder(encoded);
+            builder.sequence_number(sequence_number);
+            for (VirtualParticipant& participant : participants_)
+            {
+                std::copy(encoded.begin(), encoded.end(), participant.participant_data.begin() + 16);
+            }
+            encoded_participant_sequence_number_ = sequence_number;
+        }
+
+        static const std::vector<uint64_t> no_data;
+        for (VirtualParticipant& participant : participants_)
+        {
+            send_participant_data(participant, nullptr);
+            for (size_t real = 0; real < real_participants_.size(); ++real)
+            {
+                if (!(participant.sedp_acked[real] & 1)) send_sedp(participant, real_participants_[real], true, no_data);
+                if (!(participant.sedp_acked[real] & 2)) send_sedp(participant, real_participants_[real], false, no_data);
+            }
+        }
+    }
+
+    uint32_t announcement_period_ms() const
+    {
+        return lease_duration_s_ * 1000 / 4;
+    }
+
+    // 토픽 0 에 있는 가상 writer / reader 수
+    static void count_topic_endpoints(uint32_t num_participants, uint32_t endpoints_per_participant,
+            uint32_t& writers, uint32_t& readers)
+    {
+        writers = 0;
+        readers = 0;
+        std::string topic = topic_of(0, 0);
+        for (uint32_t i = 0; i < num_participants; ++i)
+        {
+            for (uint32_t j = 0; j < endpoints_per_participant; ++j)
+            {
+                if (topic_of(i, j) != topic) continue;
+                if ((j % 2) == 0) ++writers;
+                else ++readers;
+            }
+        }
+    }
+};
+
+void DiscoveryLoadNetwork::deliver(const Datagram& datagram)
+{
+    const std::vector<uint8_t>& data = *datagram.data;
+    uint32_t port = datagram.destination.port;
+    bool multicast = is_multicast(datagram.destination);
+
+    {
+        std::lock_guard<std::mutex> lock(channels_mutex_);
+        auto it = channels_.find(port);
+        if (it != channels_.end())
+        {
+            for (const Channel& channel : it->second)
+            {
+                channel.receiver->OnDataReceived(data.data(), static_cast<uint32_t>(data.size()),
+                        channel.locator, datagram.source);
+            }
+        }
+    }
+
+    if (datagram.from_virtual)
+    {
+        ++from_virtual_;
+    }
+    else if (emulator_ != nullptr && (multicast || emulator_->owns_port(port)))
+    {
+        ++to_virtual_;
+        double start = thread_cpu_us();
+        emulator_->on_datagram(data.data(), data.size(), port, multicast);
+        add_emulator_cpu(start);
+    }
+}
+
+void DiscoveryLoadNetwork::run()
+{
+    auto next_announcement = std::chrono::steady_clock::now();
+    std::deque<Datagram> batch;
+    while (running_)
+    {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            queue_cv_.wait_until(lock, next_announcement, [&]()
+                    {
+                        return !queue_.empty() || !running_ || announce_now_;
+                    });
+            batch.swap(queue_);
+        }
+
+        for (const Datagram& datagram : batch)
+        {
+            if (!running_) break;
+            deliver(datagram);
+        }
+        batch.clear();
+
+        auto now = std::chrono::steady_clock::now();
+        if (announce_now_.exchange(false) || now >= next_announcement)
+        {
+            double start = thread_cpu_us();
+            emulator_->announce();
+            add_emulator_cpu(start);
+            next_announcement = now + std::chrono::milliseconds(emulator_->announcement_period_ms());
+        }
+    }
+}
+
+// 디스커버리를 측정할 실제 참여자. 토픽 0 에 writer 와 reader 를 하나씩 만든다.
+class DiscoveryLoadParticipant
+{
+private:
+    class ParticipantListener : public DomainParticipantListener
+    {
+    public:
+        ParticipantListener()
+            : discovered_(0)
+        {
+        }
+
+        void on_participant_discovery(
+                DomainParticipant*,
+                ParticipantDiscoveryStatus reason,
+                const ParticipantBuiltinTopicData&,
+                bool&) override
+        {
+            if (reason == ParticipantDiscoveryStatus::DISCOVERED_PARTICIPANT)
+            {
+                ++discovered_;
+            }
+            else if (reason == ParticipantDiscoveryStatus::REMOVED_PARTICIPANT ||
+                    reason == ParticipantDiscoveryStatus::DROPPED_PARTICIPANT)
+            {
+                --discovered_;
+            }
+        }
+
+        std::atomic<int> discovered_;
+    } listener_;
+
+    DomainParticipant* participant_;
+    Publisher* publisher_;
+    Subscriber* subscriber_;
+    Topic* topic_;
+    DataWriter* writer_;
+    DataReader* reader_;
+    TypeSupport type_;
+
+public:
+    DiscoveryLoadParticipant()
+        : participant_(nullptr)
+        , publisher_(nullptr)
+        , subscriber_(nullptr)
+        , topic_(nullptr)
+        , writer_(nullptr)
+        , reader_(nullptr)
+        , type_(new HelloWorldPubSubType())
+    {
+    }
+
+    ~DiscoveryLoadParticipant()
+    {
+        if (reader_ != nullptr) subscriber_->delete_datareader(reader_);
+        if (writer_ != nullptr) publisher_->delete_datawriter(writer_);
+        if (subscriber_ != nullptr) participant_->delete_subscriber(subscriber_);
+        if (publisher_ != nullptr) participant_->delete_publisher(publisher_);
+        if (topic_ != nullptr) participant_->delete_topic(topic_);
+        if (participant_ != nullptr) DomainParticipantFactory::get_instance()->delete_participant(participant_);
+    }
+
+    bool init()
+    {
+        // 기본 전송 계층 대신 모의 네트워크를 쓴다
+        DomainParticipantQos qos = PARTICIPANT_QOS_DEFAULT;
+        qos.transport().use_builtin_transports = false;
+        qos.transport().user_transports.push_back(std::make_shared<DiscoveryLoadTransportDescriptor>());
+
+        participant_ = DomainParticipantFactory::get_instance()->create_participant(0, qos, &listener_);
+        if (participant_ == nullptr) return false;
+
+        type_.register_type(participant_);
+
+        topic_ = participant_->create_topic(DiscoveryLoadEmulator::topic_of(0, 0), type_.get_type_name(),
+                        TOPIC_QOS_DEFAULT);
+        if (topic_ == nullptr) return false;
+
+        publisher_ = participant_->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+        subscriber_ = participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT, nullptr);
+        if (publisher_ == nullptr || subscriber_ == nullptr) return false;
+
+        writer_ = publisher_->create_datawriter(topic_, DATAWRITER_QOS_DEFAULT, nullptr);
+        reader_ = subscriber_->create_datareader(topic_, DATAREADER_QOS_DEFAULT, nullptr);
+        return writer_ != nullptr && reader_ != nullptr;
+    }
+
+    int discovered_participants() const
+    {
+        return listener_.discovered_;
+    }
+
+    int writer_matches() const
+    {
+        PublicationMatchedStatus status;
+        writer_->get_publication_matched_status(status);
+        return status.current_count;
+    }
+
+    int reader_matches() const
+    {
+        SubscriptionMatchedStatus status;
+        reader_->get_subscription_matched_status(status);
+        return status.current_count;
+    }
+};
+
+// 가상 참여자 수천 개와 실제 참여자 몇 개의 디스커버리를 측정한다
+void run_discovery_load(uint32_t num_virtual, uint32_t endpoints_per_participant, uint32_t num_real,
+        uint32_t timeout_s)
+{
+    num_virtual = std::min(num_virtual, MAX_VIRTUAL_PARTICIPANTS);
+    std::cout << "=== 디스커버리 부하 시뮬레이션 (가상 참여자: " << num_virtual << ", 참여자당 엔드포인트: "
+              << endpoints_per_participant << ", 실제 참여자: " << num_real << ") ===" << std::endl;
+
+    DiscoveryLoadNetwork& network = discovery_load_network();
+    DiscoveryLoadEmulator emulator(network);
+    {
+        HelloWorldPubSubType type;
+        emulator.build(num_virtual, endpoints_per_participant, type.get_name());
+    }
+    network.start(&emulator);
+
+    std::vector<std::unique_ptr<DiscoveryLoadParticipant>> participants;
+    for (uint32_t i = 0; i < num_real; ++i)
+    {
+        participants.emplace_back(new DiscoveryLoadParticipant());
+        if (!participants.back()->init())
+        {
+            std::cerr << "실제 참여자 초기화 실패" << std::endl;
+            network.stop();
+            return;
+        }
+    }
+
+    // 실제 참여자끼리의 디스커버리가 끝난 뒤를 기준점으로 삼는다
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    uint32_t virtual_writers = 0;
+    uint32_t virtual_readers = 0;
+    DiscoveryLoadEmulator::count_topic_endpoints(num_virtual, endpoints_per_participant, virtual_writers,
+            virtual_readers);
+    int expected_participants = static_cast<int>(num_virtual + num_real - 1);
+    int expected_writer_matches = static_cast<int>(virtual_readers + num_real);
+    int expected_reader_matches = static_cast<int>(virtual_writers + num_real);
+
+    size_t start_memory = resident_memory_bytes();
+    double start_cpu = process_cpu_us();
+    auto start = std::chrono::steady_clock::now();
+    emulator.enable();
+    network.announce_now();
+
+    bool matched = false;
+    auto deadline = start + std::chrono::seconds(timeout_s);
+    while (!matched && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        matched = true;
+        for (const auto& participant : participants)
+        {
+            if (participant->discovered_participants() < expected_participants ||
+                    participant->writer_matches() < expected_writer_matches ||
+                    participant->reader_matches() < expected_reader_matches)
+            {
+                matched = false;
+                break;
+            }
+        }
+    }
+
+    double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    double total_cpu_us = process_cpu_us() - start_cpu;
+    size_t end_memory = resident_memory_bytes();
+
+    // 참여자를 지우기 전에 전달을 멈춘다
+    network.stop();
+    double emulator_cpu_us = network.emulator_cpu_us();
+
+    if (matched)
+    {
+        std::cout << "완전 매칭까지 걸린 시간: " << std::fixed << std::setprecision(1) << elapsed_ms << " ms" << std::endl;
+    }
+    else
+    {
+        std::cout << "제한 시간(" << timeout_s << "s) 안에 완전 매칭되지 않음" << std::endl;
+    }
+    for (size_t i = 0; i < participants.size(); ++i)
+    {
+        std::cout << "  실제 참여자 #" << i << ": 발견한 참여자 " << participants[i]->discovered_participants()
+                  << "/" << expected_participants << ", writer 매칭 " << participants[i]->writer_matches()
+                  << "/" << expected_writer_matches << ", reader 매칭 " << participants[i]->reader_matches()
+                  << "/" << expected_reader_matches << std::endl;
+    }
+
+    double proxies = static_cast<double>(num_real) * num_virtual;
+    double memory_delta = end_memory > start_memory ? static_cast<double>(end_memory - start_memory) : 0.0;
+    double real_cpu_us = std::max(0.0, total_cpu_us - emulator_cpu_us);
+    std::cout << "메모리 증가: " << std::setprecision(1) << memory_delta / 1024.0 << " KB, 원격 참여자 프록시당 "
+              << std::setprecision(0) << memory_delta / proxies << " 바이트 (엔드포인트 "
+              << endpoints_per_participant << "개 포함)" << std::endl;
+    std::cout << "CPU 시간: 전체 " << std::setprecision(1) << total_cpu_us / 1000.0 << " ms, 가상 참여자 "
+              << emulator_cpu_us / 1000.0 << " ms, 실제 참여자 " << real_cpu_us / 1000.0 << " ms (원격 참여자당 "
+              << std::setprecision(2) << real_cpu_us / proxies << " us)" << std::endl;
+    std::cout << "데이터그램: 가상 -> 실제 " << network.datagrams_from_virtual() << ", 실제 -> 가상 "
+              << network.datagrams_to_virtual() << std::endl;
+
+    participants.clear();
+    std::cout << "=== 디스커버리 부하 시뮬레이션 종료 ===" << std::endl;
+}
+
+// 반복 알림 처리 벤치마크
+// 디스커버리가 끝난 뒤 가상 참여자들이 같은 DATA(p) 를 다시 보낼 때 실제 참여자가 쓰는 CPU 를 잰다.
+// 시퀀스 번호까지 같은 알림과, 내용은 같고 시퀀스 번호만 바뀐 알림(마지막으로 처리한 DATA 와 비교해 건너뜀)을
+// 따로 측정하고, 마지막으로 처리한 DATA 를 보관하는 데 드는 메모리도 함께 출력한다.
+// 이어서 모든 DATA(w)/DATA(r) 을 새 시퀀스 번호로 다시 보내, 내용이 같아 건너뛰는 경우와
+// PID_PAD 값만 바꿔 비교가 실패하는 경우(처리한 DATA 비교가 없을 때처럼 모두 다시 처리)를 비교한다.
+void run_reannounce_benchmark(uint32_t num_virtual, uint32_t endpoints_per_participant, uint32_t rounds)
+{
+    num_virtual = std::min(num_virtual, MAX_VIRTUAL_PARTICIPANTS);
+    std::cout << "=== 반복 알림 처리 벤치마크 (가상 참여자: " << num_virtual << ", 참여자당 엔드포인트: "
+              << endpoints_per_participant << ", 알림 횟수: " << rounds << ") ===" << std::endl;
+
+    DiscoveryLoadNetwork& network = discovery_load_network();
+    DiscoveryLoadEmulator emulator(network);
+    {
+        HelloWorldPubSubType type;
+        emulator.build(num_virtual, endpoints_per_participant, type.get_name());
+    }
+    network.start(&emulator);
+
+    std::unique_ptr<DiscoveryLoadParticipant> participant(new DiscoveryLoadParticipant());
+    if (!participant->init())
+    {
+        std::cerr << "실제 참여자 초기화 실패" << std::endl;
+        network.stop();
+        return;
+    }
+
+    uint32_t virtual_writers = 0;
+    uint32_t virtual_readers = 0;
+    DiscoveryLoadEmulator::count_topic_endpoints(num_virtual, endpoints_per_participant, virtual_writers,
+            virtual_readers);
+    size_t start_memory = resident_memory_bytes();
+    emulator.enable();
+    network.announce_now();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(120);
+    while (std::chrono::steady_clock::now() < deadline &&
+            (participant->discovered_participants() < static_cast<int>(num_virtual) ||
+            participant->writer_matches() < static_cast<int>(virtual_readers + 1) ||
+            participant->reader_matches() < static_cast<int>(virtual_writers + 1)))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    if (participant->discovered_participants() < static_cast<int>(num_virtual))
+    {
+        std::cerr << "제한 시간 안에 디스커버리가 끝나지 않음" << std::endl;
+        network.stop();
+        return;
+    }
+    size_t discovered_memory = resident_memory_bytes();
+
+    // 알림 한 번을 보내고, 가상 참여자마다 DATA(p) 하나가 전달될 때까지 기다린다
+    auto run_rounds = [&](bool new_sequence_numbers, uint64_t first_sequence_number)
+            {
+                double start_cpu = process_cpu_us();
+                double start_emulator_cpu = network.emulator_cpu_us();
+                for (uint32_t round = 0; round < rounds; ++round)
+                {
+                    if (new_sequence_numbers) emulator.set_participant_sequence_number(first_sequence_number + round);
+                    uint64_t expected = network.datagrams_from_virtual() + num_virtual;
+                    network.announce_now();
+                    auto round_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+                    while (network.datagrams_from_virtual() < expected &&
+                            std::chrono::steady_clock::now() < round_deadline)
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+                double real_cpu_us = (process_cpu_us() - start_cpu) - (network.emulator_cpu_us() - start_emulator_cpu);
+                return std::max(0.0, real_cpu_us) / (static_cast<double>(rounds) * num_virtual);
+            };
+
+    double same_us = run_rounds(false, 0);
+    double renumbered_us = run_rounds(true, 2);
+    size_t end_memory = resident_memory_bytes();
+
+    // 엔드포인트 알림 한 번을 보내고, 가상 참여자마다 SEDP 메시지 두 개가 전달될 때까지 기다린다
+    auto run_endpoint_rounds = [&](bool change_content)
+            {
+                double start_cpu = process_cpu_us();
+                double start_emulator_cpu = network.emulator_cpu_us();
+                for (uint32_t round = 0; round < rounds; ++round)
+                {
+                    emulator.reannounce_endpoints(change_content);
+                    uint64_t expected = network.datagrams_from_virtual() + 2 * num_virtual;
+                    network.announce_now();
+                    auto round_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+                    while (network.datagrams_from_virtual() < expected &&
+                            std::chrono::steady_clock::now() < round_deadline)
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+                double real_cpu_us = (process_cpu_us() - start_cpu) - (network.emulator_cpu_us() - start_emulator_cpu);
+                return std::max(0.0, real_cpu_us) /
+                       (static_cast<double>(rounds) * num_virtual * endpoints_per_participant);
+            };
+
+    double skipped_endpoint_us = 0.0;
+    double processed_endpoint_us = 0.0;
+    if (endpoints_per_participant > 0)
+    {
+        skipped_endpoint_us = run_endpoint_rounds(false);
+        processed_endpoint_us = run_endpoint_rounds(true);
+    }
+
+    network.stop();
+
+    double discovered_delta = discovered_memory > start_memory ?
+            static_cast<double>(discovered_memory - start_memory) : 0.0;
+    double processed_delta = end_memory > discovered_memory ? static_cast<double>(end_memory - discovered_memory) : 0.0;
+    std::cout << std::fixed << std::setprecision(2)
+              << "DATA(p) 하나당 실제 참여자 CPU: 같은 알림 " << same_us << " us, 시퀀스 번호만 바뀐 알림 "
+              << renumbered_us << " us" << std::endl;
+    if (endpoints_per_participant > 0)
+    {
+        std::cout << "DATA(w)/DATA(r) 하나당 실제 참여자 CPU (엔드포인트 " << num_virtual * endpoints_per_participant
+                  << "개): 내용이 같아 건너뜀 " << skipped_endpoint_us << " us, 내용이 바뀌어 다시 처리 "
+                  << processed_endpoint_us << " us" << std::endl;
+    }
+    std::cout << std::setprecision(0) << "메모리: 디스커버리 " << discovered_delta / num_virtual
+              << " 바이트/참여자, 처리한 DATA(p) 보관 " << processed_delta / num_virtual << " 바이트/참여자"
+              << std::endl;
+
+    participant.reset();
+    std::cout << "=== 반복 알림 처리 벤치마크 종료 ===" << std::endl;
+}
+
+// 디스커버리 서버 매칭 처리량 벤치마크
+// 서버 하나와 클라이언트 여러 개를 만들고, 클라이언트들이 엔드포인트를 한꺼번에 만든 뒤
+// 서버가 모든 엔드포인트를 발견할 때까지와 클라이언트들이 완전히 매칭될 때까지의 시간을 잰다.
+// 클라이언트는 서버를 거쳐서만 다른 클라이언트의 엔드포인트를 알게 되므로 서버 디스커버리 데이터베이스의
+// 매칭 처리량이 드러난다. 매칭 스레드 설정은 서버의 discovery_server_thread 를 따른다.
+const uint32_t DISCOVERY_SERVER_BENCH_PORT = 11811;
+
+class DiscoveryServerBenchmark
+{
+private:
+    class ServerListener : public DomainParticipantListener
+    {
+    public:
+        std::atomic<uint32_t> participants {0};
+        std::atomic<uint32_t> endpoints {0};
+
+        void on_participant_discovery(
+                DomainParticipant*,
+                ParticipantDiscoveryStatus reason,
+                const ParticipantBuiltinTopicData&,
+                bool&) override
+        {
+            if (reason == ParticipantDiscoveryStatus::DISCOVERED_PARTICIPANT) ++participants;
+        }
+
+        void on_data_reader_discovery(
+                DomainParticipant*,
+                ReaderDiscoveryStatus reason,
+                const SubscriptionBuiltinTopicData&,
+                bool&) override
+        {
+            if (reason == ReaderDiscoveryStatus::DISCOVERED_READER) ++endpoints;
+        }
+
+        void on_data_writer_discovery(
+                DomainParticipant*,
+                WriterDiscoveryStatus reason,
+                const PublicationBuiltinTopicData&,
+                bool&) override
+        {
+            if (reason == WriterDiscoveryStatus::DISCOVERED_WRITER) ++endpoints;
+        }
+    };
+
+    struct Client
+    {
+        DomainParticipant* participant = nullptr;
+        Publisher* publisher = nullptr;
+        Subscriber* subscriber = nullptr;
+        std::vector<Topic*> topics;
+        std::vector<DataWriter*> writers;
+        std::vector<DataReader*> readers;
+    };
+
+    uint32_t num_clients_;
+    uint32_t endpoints_per_client_;
+    uint32_t num_topics_;
+    DomainParticipant* server_;
+    ServerListener listener_;
+    std::vector<Client> clients_;
+    TypeSupport type_;
+
+    static Locator_t server_locator()
+    {
+        Locator_t locator;
+        locator.kind = LOCATOR_KIND_UDPv4;
+        locator.port = DISCOVERY_SERVER_BENCH_PORT;
+        locator.address[12] = 127;
+        locator.address[15] = 1;
+        return locator;
+    }
+
+    // 클라이언트 c 의 엔드포인트 j 는 토픽 (c + j) % num_topics_ 에 있고, 짝수 번째는 writer 이다
+    uint32_t topic_of(uint32_t client, uint32_t endpoint) const
+    {
+        return (client + endpoint) % num_topics_;
+    }
+
+public:
+    DiscoveryServerBenchmark(uint32_t num_clients, uint32_t endpoints_per_client, uint32_t num_topics)
+        : num_clients_(num_clients)
+        , endpoints_per_client_(endpoints_per_client)
+        , num_topics_(num_topics)
+        , server_(nullptr)
+        , clients_(num_clients)
+        , type_(new HelloWorldPubSubType())
+    {
+    }
+
+    ~DiscoveryServerBenchmark()
+    {
+        for (Client& client : clients_)
+        {
+            if (client.participant == nullptr) continue;
+            client.participant->delete_contained_entities();
+            DomainParticipantFactory::get_instance()->delete_participant(client.participant);
+        }
+        if (server_ != nullptr) DomainParticipantFactory::get_instance()->delete_participant(server_);
+    }
+
+    // 서버와 클라이언트 참여자를 만들고 서버가 모든 클라이언트를 발견할 때까지 기다린다
+    bool init()
+    {
+        DomainParticipantQos server_qos = PARTICIPANT_QOS_DEFAULT;
+        server_qos.wire_protocol().builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::SERVER;
+        server_qos.wire_protocol().builtin.metatrafficUnicastLocatorList.push_back(server_locator());
+        server_ = DomainParticipantFactory::get_instance()->create_participant(0, server_qos, &listener_);
+        if (server_ == nullptr) return false;
+
+        DomainParticipantQos client_qos = PARTICIPANT_QOS_DEFAULT;
+        client_qos.wire_protocol().builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::CLIENT;
+        client_qos.wire_protocol().builtin.discovery_config.m_DiscoveryServers.push_back(server_locator());
+        for (Client& client : clients_)
+        {
+            client.participant = DomainParticipantFactory::get_instance()->create_participant(0, client_qos);
+            if (client.participant == nullptr) return false;
+            type_.register_type(client.participant);
+            client.publisher = client.participant->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+            client.subscriber = client.participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT, nullptr);
+            if (client.publisher == nullptr || client.subscriber == nullptr) return false;
+            client.topics.assign(num_topics_, nullptr);
+        }
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (listener_.participants < num_clients_ && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return listener_.participants >= num_clients_;
+    }
+
+    // 모든 클라이언트의 엔드포인트를 한꺼번에 만든다
+    bool create_endpoints()
+    {
+        DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+        wqos.data_sharing().off();
+        DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+        rqos.data_sharing().off();
+
+        for (uint32_t c = 0; c < num_clients_; ++c)
+        {
+            Client& client = clients_[c];
+            for (uint32_t j = 0; j < endpoints_per_client_; ++j)
+            {
+                uint32_t t = topic_of(c, j);
+                if (client.topics[t] == nullptr)
+                {
+                    client.topics[t] = client.participant->create_topic("DiscoveryServerTopic_" + std::to_string(t),
+                                    type_.get_type_name(), TOPIC_QOS_DEFAULT);
+                    if (client.topics[t] == nullptr) return false;
+                }
+
+                if ((j % 2) == 0)
+                {
+                    DataWriter* writer = client.publisher->create_datawriter(client.topics[t], wqos, nullptr);
+                    if (writer == nullptr) return false;
+                    client.writers.push_back(writer);
+                }
+                else
+                {
+                    DataReader* reader = client.subscriber->create_datareader(client.topics[t], rqos, nullptr);
+                    if (reader == nullptr) return false;
+                    client.readers.push_back(reader);
+                }
+            }
+        }
+        return true;
+    }
+
+    uint32_t server_discovered_endpoints() const
+    {
+        return listener_.endpoints;
+    }
+
+    // 토픽마다 writer 수 x reader 수를 더한 값. writer 쪽과 reader 쪽 매칭 수가 각각 이만큼이 되어야 한다.
+    uint64_t expected_matches() const
+    {
+        std::vector<uint64_t> writers(num_topics_, 0);
+        std::vector<uint64_t> readers(num_topics_, 0);
+        for (uint32_t c = 0; c < num_clients_; ++c)
+        {
+            for (uint32_t j = 0; j < endpoints_per_client_; ++j)
+            {
+                if ((j % 2) == 0) ++writers[topic_of(c, j)];
+                else ++readers[topic_of(c, j)];
+            }
+        }
+        uint64_t matches = 0;
+        for (uint32_t t = 0; t < num_topics_; ++t) matches += writers[t] * readers[t];
+        return matches;
+    }
+
+    // writer 쪽과 reader 쪽 중 작은 매칭 수
+    uint64_t current_matches() const
+    {
+        uint64_t writer_matches = 0;
+        uint64_t reader_matches = 0;
+        for (const Client& client : clients_)
+        {
+            for (DataWriter* writer : client.writers)
+            {
+                PublicationMatchedStatus status;
+                writer->get_publication_matched_status(status);
+                writer_matches += static_cast<uint64_t>(status.current_count);
+            }
+            for (DataReader* reader : client.readers)
+            {
+                SubscriptionMatchedStatus status;
+                reader->get_subscription_matched_status(status);
+                reader_matches += static_cast<uint64_t>(status.current_count);
+            }
+        }
+        return std::min(writer_matches, reader_matches);
+    }
+};
+
+void run_discovery_server_benchmark(uint32_t num_clients, uint32_t endpoints_per_client, uint32_t num_topics,
+        uint32_t timeout_s)
+{
+    uint32_t total_endpoints = num_clients * endpoints_per_client;
+    std::cout << "=== 디스커버리 서버 매칭 처리량 벤치마크 (클라이언트: " << num_clients << ", 클라이언트당 엔드포인트: "
+              << endpoints_per_client << ", 토픽: " << num_topics << ") ===" << std::endl;
+
+    DiscoveryServerBenchmark bench(num_clients, endpoints_per_client, num_topics);
+    if (!bench.init())
+    {
+        std::cerr << "서버 또는 클라이언트 초기화 실패" << std::endl;
+        return;
+    }
+
+    uint64_t expected_matches = bench.expected_matches();
+    double start_cpu = process_cpu_us();
+    auto start = std::chrono::steady_clock::now();
+    if (!bench.create_endpoints())
+    {
+        std::cerr << "엔드포인트 생성 실패" << std::endl;
+        return;
+    }
+    double create_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    double server_ms = -1.0;
+    double matched_ms = -1.0;
+    auto deadline = start + std::chrono::seconds(timeout_s);
+    while (matched_ms < 0.0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        double elapsed_ms =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (server_ms < 0.0 && bench.server_discovered_endpoints() >= total_endpoints) server_ms = elapsed_ms;
+        if (server_ms >= 0.0 && bench.current_matches() >= expected_matches) matched_ms = elapsed_ms;
+    }
+    double cpu_ms = (process_cpu_us() - start_cpu) / 1000.0;
+
+    std::cout << std::fixed << std::setprecision(1) << "엔드포인트 생성: " << create_ms << " ms" << std::endl;
+    if (server_ms >= 0.0)
+    {
+        std::cout << "서버가 엔드포인트 " << total_endpoints << "개를 발견: " << server_ms << " ms ("
+                  << total_endpoints * 1000.0 / std::max(server_ms, 1.0) << " 엔드포인트/s)" << std::endl;
+    }
+    if (matched_ms >= 0.0)
+    {
+        std::cout << "완전 매칭 (writer-reader 쌍 " << expected_matches << "개): " << matched_ms << " ms ("
+                  << expected_matches * 1000.0 / std::max(matched_ms, 1.0) << " 매칭/s)" << std::endl;
+    }
+    else
+    {
+        std::cout << "제한 시간(" << timeout_s << "s) 안에 완전 매칭되지 않음 (발견 " << bench.server_discovered_endpoints()
+                  << "/" << total_endpoints << ", 매칭 " << bench.current_matches() << "/" << expected_matches << ")"
+                  << std::endl;
+    }
+    std::cout << "프로세스 CPU: " << cpu_ms << " ms" << std::endl;
+    std::cout << "=== 디스커버리 서버 매칭 처리량 벤치마크 종료 ===" << std::endl;
+}
+
+// 백업 서버 복원 시간 벤치마크
+// BACKUP 서버가 남기는 바이너리 스냅숏(<접두사>.ddb)과 저널(<접두사>_queue.ddb)을 직접 만들고,
+// 그 파일로 서버를 시작하는 시간을 파일 없이 시작하는 시간과 비교한다.
+// 스냅숏의 참여자는 모두 서버의 로컬 클라이언트이고, 저널에는 스냅숏 이후에 도착한 클라이언트의 DATA(p) 가 있다.
+const uint32_t BACKUP_SNAPSHOT_MAGIC = 0x42444446;
+const uint32_t BACKUP_JOURNAL_MAGIC = 0x4A444446;
+const uint32_t BACKUP_VERSION = 1;
+const uint16_t PID_PROPERTY_LIST_ID = 0x0059;
+
+class BackupRestoreBenchmark
+{
+private:
+    class ServerListener : public DomainParticipantListener
+    {
+    public:
+        std::atomic<uint32_t> participants {0};
+        std::atomic<uint32_t> endpoints {0};
+
+        void on_participant_discovery(
+                DomainParticipant*,
+                ParticipantDiscoveryStatus reason,
+                const ParticipantBuiltinTopicData&,
+                bool&) override
+        {
+            if (reason == ParticipantDiscoveryStatus::DISCOVERED_PARTICIPANT) ++participants;
+        }
+
+        void on_data_reader_discovery(
+                DomainParticipant*,
+                ReaderDiscoveryStatus reason,
+                const SubscriptionBuiltinTopicData&,
+                bool&) override
+        {
+            if (reason == ReaderDiscoveryStatus::DISCOVERED_READER) ++endpoints;
+        }
+
+        void on_data_writer_discovery(
+                DomainParticipant*,
+                WriterDiscoveryStatus reason,
+                const PublicationBuiltinTopicData&,
+                bool&) override
+        {
+            if (reason == WriterDiscoveryStatus::DISCOVERED_WRITER) ++endpoints;
+        }
+    };
+
+    uint32_t num_participants_;
+    uint32_t endpoints_per_participant_;
+    uint32_t journal_participants_;
+    GuidPrefix_t server_prefix_;
+    std::string file_prefix_;
+
+    RtpsGuidPrefix client_prefix(uint32_t i) const
+    {
+        return {0x01, 0x0f, 0x8b, 0x0c,
+                static_cast<uint8_t>(i >> 24), static_cast<uint8_t>(i >> 16),
+                static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i), 0, 0, 0, 1};
+    }
+
+    static Locator_t server_locator()
+    {
+        Locator_t locator;
+        locator.kind = LOCATOR_KIND_UDPv4;
+        locator.port = DISCOVERY_SERVER_BENCH_PORT;
+        locator.address[12] = 127;
+        locator.address[15] = 1;
+        return locator;
+    }
+
+    static void cdr_string(RtpsMessageBuilder& out, const std::string& value)
+    {
+        uint32_t length = static_cast<uint32_t>(value.size() + 1);
+        out.u32(length);
+        out.bytes(reinterpret_cast<const uint8_t*>(value.c_str()), length);
+        for (uint32_t i = length; i < ((length + 3) & ~3u); ++i) out.u8(0);
+    }
+
+    // 클라이언트 i 의 DATA(p) 서브메시지. 디스커버리 서버는 PARTICIPANT_TYPE 속성으로 클라이언트를 구분한다.
+    std::vector<uint8_t> participant_data(uint32_t i) const
+    {
+        std::vector<uint8_t> data;
+        RtpsMessageBuilder spdp(data);
+        size_t start = spdp.begin_data(ENTITY_SPDP_READER, ENTITY_SPDP_WRITER, 1);
+        spdp.parameter_header(PID_PROTOCOL_VERSION_ID, 4);
+        const uint8_t protocol_version[] = {2, 3, 0, 0};
+        spdp.bytes(protocol_version, sizeof(protocol_version));
+        spdp.parameter_header(PID_VENDORID_ID, 4);
+        const uint8_t vendor_id[] = {0x01, 0x0f, 0, 0};
+        spdp.bytes(vendor_id, sizeof(vendor_id));
+        spdp.parameter_u32(PID_DOMAIN_ID_ID, 0);
+        spdp.parameter_guid(PID_PARTICIPANT_GUID_ID, client_prefix(i), ENTITY_PARTICIPANT);
+        spdp.parameter_locator(PID_METATRAFFIC_UNICAST_LOCATOR_ID, FIRST_VIRTUAL_PORT + 2 * i);
+        spdp.parameter_locator(PID_DEFAULT_UNICAST_LOCATOR_ID, FIRST_VIRTUAL_PORT + 2 * i + 1);
+        // 벤치마크 중에 임대 기간이 끝나지 않도록 길게 잡는다
+        spdp.parameter_header(PID_PARTICIPANT_LEASE_DURATION_ID, 8);
+        spdp.u32(600);
+        spdp.u32(0);
+        spdp.parameter_u32(PID_BUILTIN_ENDPOINT_SET_ID, VIRTUAL_BUILTIN_ENDPOINTS);
+        // "PARTICIPANT_TYPE" (17 바이트 -> 20) 과 "CLIENT" (7 바이트 -> 8)
+        spdp.parameter_header(PID_PROPERTY_LIST_ID, 4 + 4 + 20 + 4 + 8);
+        spdp.u32(1);
+        cdr_string(spdp, "PARTICIPANT_TYPE");
+        cdr_string(spdp, "CLIENT");
+        spdp.end_data(start);
+        return data;
+    }
+
+    // 클라이언트 i 의 엔드포인트 j 의 DATA(w|r) 서브메시지. 짝수 번째는 writer 이다.
+    std::vector<uint8_t> endpoint_data(uint32_t i, uint32_t j) const
+    {
+        bool is_writer = (j % 2) == 0;
+        std::vector<uint8_t> data;
+        RtpsMessageBuilder sedp(data);
+        size_t start = sedp.begin_data(is_writer ? ENTITY_SEDP_PUB_READER : ENTITY_SEDP_SUB_READER,
+                        is_writer ? ENTITY_SEDP_PUB_WRITER : ENTITY_SEDP_SUB_WRITER, j / 2 + 1);
+        sedp.parameter_guid(PID_ENDPOINT_GUID_ID, client_prefix(i), endpoint_entity(j));
+        sedp.parameter_guid(PID_PARTICIPANT_GUID_ID, client_prefix(i), ENTITY_PARTICIPANT);
+        sedp.parameter_string(PID_TOPIC_NAME_ID, "RestoreTopic_" + std::to_string(j % 100));
+        sedp.parameter_string(PID_TYPE_NAME_ID, "HelloWorld");
+        sedp.parameter_header(PID_RELIABILITY_ID, 12);
+        sedp.u32(is_writer ? 2 : 1);
+        sedp.u32(0);
+        sedp.u32(0);
+        sedp.end_data(start);
+        return data;
+    }
+
+    static uint32_t endpoint_entity(uint32_t j)
+    {
+        return ((j + 1) << 8) | ((j % 2) == 0 ? 0x03 : 0x04);
+    }
+
+    // BinaryBackupWriter::write_change 와 같은 형식으로 변경 하나를 쓴다.
+    // 페이로드는 DATA 서브메시지에서 헤더 24 바이트를 뺀 캡슐화부터이다.
+    static void write_change(RtpsMessageBuilder& out, const RtpsGuidPrefix& prefix, uint32_t writer_entity,
+            uint32_t instance_entity, uint64_t sequence_number, const std::vector<uint8_t>& submessage)
+    {
+        out.u8(0);
+        out.prefix(prefix);
+        out.entity_id(writer_entity);
+        out.u8(1);
+        out.prefix(prefix);
+        out.entity_id(instance_entity);
+        out.sequence_number(sequence_number);
+        out.u8(0);
+        for (int i = 0; i < 4; ++i) out.u32(0);
+        for (int i = 0; i < 2; ++i)
+        {
+            out.prefix(prefix);
+            out.entity_id(writer_entity);
+            out.sequence_number(sequence_number);
+        }
+        out.u8(0x01);
+        out.u8(0x0f);
+        out.u16(0x0003);
+        out.u32(static_cast<uint32_t>(submessage.size() - 24));
+        out.bytes(submessage.data() + 24, submessage.size() - 24);
+    }
+
+    // 스냅숏에 들어가는 엔드포인트 수 (writer 또는 reader)
+    uint32_t endpoints_of_kind(bool writers) const
+    {
+        return writers ? (endpoints_per_participant_ + 1) / 2 : endpoints_per_participant_ / 2;
+    }
+
+public:
+    BackupRestoreBenchmark(uint32_t num_participants, uint32_t endpoints_per_participant,
+            uint32_t journal_participants)
+        : num_participants_(num_participants)
+        , endpoints_per_participant_(endpoints_per_participant)
+        , journal_participants_(journal_participants)
+    {
+        const uint8_t prefix[] = {0x44, 0x53, 0x00, 0x5f, 0x45, 0x50, 0x52, 0x4f, 0x53, 0x49, 0x4d, 0x41};
+        memcpy(server_prefix_.value, prefix, sizeof(prefix));
+        std::ostringstream name;
+        name << "server-" << server_prefix_;
+        file_prefix_ = name.str();
+        std::replace(file_prefix_.begin(), file_prefix_.end(), '.', '-');
+    }
+
+    ~BackupRestoreBenchmark()
+    {
+        remove_files();
+    }
+
+    void remove_files()
+    {
+        std::remove((file_prefix_ + ".ddb").c_str());
+        std::remove((file_prefix_ + "_queue.ddb").c_str());
+        std::remove((file_prefix_ + ".json").c_str());
+    }
+
+    // 스냅숏과 저널을 쓰고 스냅숏 크기를 돌려준다
+    size_t write_files()
+    {
+        std::vector<uint8_t> snapshot;
+        RtpsMessageBuilder out(snapshot);
+        out.u32(BACKUP_SNAPSHOT_MAGIC);
+        out.u32(BACKUP_VERSION);
+
+        out.u32(num_participants_);
+        for (uint32_t i = 0; i < num_participants_; ++i)
+        {
+            out.prefix(client_prefix(i));
+            write_change(out, client_prefix(i), ENTITY_SPDP_WRITER, ENTITY_PARTICIPANT, 1, participant_data(i));
+            // 확인 상태 없음, 메타트래픽 유니캐스트 로케이터 하나, 로컬 클라이언트
+            out.u32(0);
+            out.u32(1);
+            out.u32(LOCATOR_KIND_UDPv4);
+            out.u32(FIRST_VIRTUAL_PORT + 2 * i);
+            const uint8_t loopback[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 0, 0, 1};
+            out.bytes(loopback, sizeof(loopback));
+            out.u32(0);
+            out.u8(1);
+            out.u8(0);
+            out.u8(1);
+        }
+
+        for (bool writers : {true, false})
+        {
+            out.u32(num_participants_ * endpoints_of_kind(writers));
+            for (uint32_t i = 0; i < num_participants_; ++i)
+            {
+                for (uint32_t j = writers ? 0 : 1; j < endpoints_per_participant_; j += 2)
+                {
+                    out.prefix(client_prefix(i));
+                    out.entity_id(endpoint_entity(j));
+                    write_change(out, client_prefix(i), writers ? ENTITY_SEDP_PUB_WRITER : ENTITY_SEDP_SUB_WRITER,
+                            endpoint_entity(j), j / 2 + 1, endpoint_data(i, j));
+                    out.u32(0);
+                    std::string topic = "RestoreTopic_" + std::to_string(j % 100);
+                    out.u32(static_cast<uint32_t>(topic.size()));
+                    out.bytes(reinterpret_cast<const uint8_t*>(topic.data()), topic.size());
+                }
+            }
+        }
+
+        // 저널: <길이> <변경> 레코드
+        std::vector<uint8_t> journal;
+        RtpsMessageBuilder journal_out(journal);
+        journal_out.u32(BACKUP_JOURNAL_MAGIC);
+        journal_out.u32(BACKUP_VERSION);
+        for (uint32_t i = num_participants_; i < num_participants_ + journal_participants_; ++i)
+        {
+            std::vector<uint8_t> record;
+            RtpsMessageBuilder record_out(record);
+            write_change(record_out, client_prefix(i), ENTITY_SPDP_WRITER, ENTITY_PARTICIPANT, 1, participant_data(i));
+            journal_out.u32(static_cast<uint32_t>(record.size()));
+            journal_out.bytes(record.data(), record.size());
+        }
+
+        std::ofstream snapshot_file(file_prefix_ + ".ddb", std::ios::binary | std::ios::trunc);
+        snapshot_file.write(reinterpret_cast<const char*>(snapshot.data()), snapshot.size());
+        std::ofstream journal_file(file_prefix_ + "_queue.ddb", std::ios::binary | std::ios::trunc);
+        journal_file.write(reinterpret_cast<const char*>(journal.data()), journal.size());
+        return snapshot_file && journal_file ? snapshot.size() : 0;
+    }
+
+    // BACKUP 서버를 만드는 시간과 비용을 재고 서버를 지운다. 백업 복원은 create_participant 안에서 끝난다.
+    bool start_server(double& create_ms, double& cpu_ms, size_t& memory_bytes, uint32_t& participants,
+            uint32_t& endpoints)
+    {
+        DomainParticipantQos qos = PARTICIPANT_QOS_DEFAULT;
+        qos.wire_protocol().prefix = server_prefix_;
+        qos.wire_protocol().builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::BACKUP;
+        qos.wire_protocol().builtin.metatrafficUnicastLocatorList.push_back(server_locator());
+
+        ServerListener listener;
+        size_t memory_before = resident_memory_bytes();
+        double cpu_before = process_cpu_us();
+        auto start = std::chrono::steady_clock::now();
+        DomainParticipant* server = DomainParticipantFactory::get_instance()->create_participant(0, qos, &listener);
+        create_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        cpu_ms = (process_cpu_us() - cpu_before) / 1000.0;
+        size_t memory_after = resident_memory_bytes();
+        memory_bytes = memory_after > memory_before ? memory_after - memory_before : 0;
+        if (server == nullptr) return false;
+
+        participants = listener.participants;
+        endpoints = listener.endpoints;
+        DomainParticipantFactory::get_instance()->delete_participant(server);
+        return true;
+    }
+};
+
+void run_restore_benchmark(uint32_t num_endpoints, uint32_t endpoints_per_participant, uint32_t journal_participants)
+{
+    uint32_t num_participants = std::max((num_endpoints + endpoints_per_participant - 1) / endpoints_per_participant,
+                    1u);
+    uint32_t total_endpoints = num_participants * endpoints_per_participant;
+    std::cout << "=== 백업 서버 복원 시간 벤치마크 (참여자: " << num_participants << ", 엔드포인트: " << total_endpoints
+              << ", 저널 참여자: " << journal_participants << ") ===" << std::endl;
+
+    BackupRestoreBenchmark bench(num_participants, endpoints_per_participant, journal_participants);
+
+    // 백업 파일 없이 시작하는 비용
+    double empty_ms = 0;
+    double empty_cpu_ms = 0;
+    size_t empty_memory = 0;
+    uint32_t participants = 0;
+    uint32_t endpoints = 0;
+    bench.remove_files();
+    if (!bench.start_server(empty_ms, empty_cpu_ms, empty_memory, participants, endpoints))
+    {
+        std::cerr << "서버 생성 실패" << std::endl;
+        return;
+    }
+    bench.remove_files();
+
+    auto write_start = std::chrono::steady_clock::now();
+    size_t snapshot_size = bench.write_files();
+    double write_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - write_start).count();
+    if (snapshot_size == 0)
+    {
+        std::cerr << "백업 파일 쓰기 실패" << std::endl;
+        return;
+    }
+
+    double restore_ms = 0;
+    double restore_cpu_ms = 0;
+    size_t restore_memory = 0;
+    if (!bench.start_server(restore_ms, restore_cpu_ms, restore_memory, participants, endpoints))
+    {
+        std::cerr << "백업으로 서버 생성 실패" << std::endl;
+        return;
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "스냅숏: " << snapshot_size / 1024.0 / 1024.0 << " MB (생성 " << write_ms << " ms)" << std::endl
+              << "백업 없이 시작: " << empty_ms << " ms (CPU " << empty_cpu_ms << " ms)" << std::endl
+              << "백업으로 시작: " << restore_ms << " ms (CPU " << restore_cpu_ms << " ms, 메모리 +"
+              << restore_memory / 1024.0 / 1024.0 << " MB)" << std::endl
+              << "복원 시간: " << restore_ms - empty_ms << " ms ("
+              << total_endpoints * 1000.0 / std::max(restore_ms - empty_ms, 1.0) << " 엔드포인트/s)" << std::endl
+              << "복원된 참여자: " << participants << "/" << num_participants + journal_participants
+              << " (저널 " << journal_participants << " 포함), 엔드포인트: " << endpoints << "/" << total_endpoints
+              << std::endl;
+    std::cout << "=== 백업 서버 복원 시간 벤치마크 종료 ===" << std::endl;
+}
+
+// 흐름 제어기 스케줄러 마감 시간 벤치마크
+// 대역폭을 제한한 흐름 제어기 하나를 두 writer 가 같이 쓴다. bulk writer 는 주기마다 두 주기 분량을 한꺼번에 쓰고,
+// urgent writer 는 그 직후에 짧은 마감 시간(latency budget)을 가진 샘플 몇 개를 쓴다.
+// FIFO 스케줄러는 urgent 샘플을 bulk 샘플 뒤에 보내고, EARLIEST_DEADLINE_FIRST 스케줄러는 마감 시간이 이른 것부터
+// 보낸다. 샘플마다 쓴 시각부터 받은 시각까지를 재고 writer 의 마감 시간을 넘긴 비율을 출력한다.
+class DeadlineSchedulingBenchmark
+{
+public:
+
+    typedef PlainPayload<4096> SampleType;
+
+    static constexpr uint32_t PERIOD_MS = 10;
+    static constexpr int32_t BYTES_PER_PERIOD = 100 * 1024;
+    static constexpr uint32_t ROUND_MS = 40;
+    static constexpr uint32_t BULK_PER_ROUND = 50;
+    static constexpr uint32_t URGENT_PER_ROUND = 5;
+    static constexpr uint32_t BULK_DEADLINE_MS = 100;
+    static constexpr uint32_t URGENT_DEADLINE_MS = 10;
+
+    // 받은 샘플마다 쓴 시각과 비교해 지연 시간을 기록한다
+    class LatencyListener : public DataReaderListener
+    {
+    public:
+
+        LatencyListener(const std::vector<std::chrono::steady_clock::time_point>& write_times, std::mutex& mutex)
+            : write_times_(write_times)
+            , mutex_(mutex)
+        {
+        }
+
+        void on_data_available(DataReader* reader) override
+        {
+            SampleType sample;
+            SampleInfo info;
+            while (reader->take_next_sample(&sample, &info) == RETCODE_OK)
+            {
+                auto now = std::chrono::steady_clock::now();
+                if (!info.valid_data) continue;
+                std::lock_guard<std::mutex> guard(mutex_);
+                if (sample.index < write_times_.size())
+                {
+                    latencies_ms.push_back(std::chrono::duration<double, std::milli>(
+                                now - write_times_[sample.index]).count());
+                }
+            }
+        }
+
+        std::vector<double> latencies_ms;
+
+    private:
+
+        const std::vector<std::chrono::steady_clock::time_point>& write_times_;
+        std::mutex& mutex_;
+    };
+
+    DeadlineSchedulingBenchmark(FlowControllerSchedulerPolicy scheduler, uint32_t rounds)
+        : scheduler_(scheduler)
+        , rounds_(rounds)
+        , bulk_times_(rounds * BULK_PER_ROUND)
+        , urgent_times_(rounds * URGENT_PER_ROUND)
+        , bulk_listener_(bulk_times_, mutex_)
+        , urgent_listener_(urgent_times_, mutex_)
+        , type_(new PlainPayloadPubSubType<4096>())
+    {
+    }
+
+    ~DeadlineSchedulingBenchmark()
+    {
+        for (size_t i = 0; i < readers_.size(); ++i) subscriber_->delete_datareader(readers_[i]);
+        for (size_t i = 0; i < writers_.size(); ++i) publisher_->delete_datawriter(writers_[i]);
+        if (subscriber_ != nullptr) reader_participant_->delete_subscriber(subscriber_);
+        if (publisher_ != nullptr) writer_participant_->delete_publisher(publisher_);
+        for (Topic* topic : reader_topics_) reader_participant_->delete_topic(topic);
+        for (Topic* topic : writer_topics_) writer_participant_->delete_topic(topic);
+        if (reader_participant_ != nullptr)
+            DomainParticipantFactory::get_instance()->delete_participant(reader_participant_);
+        if (writer_participant_ != nullptr)
+            DomainParticipantFactory::get_instance()->delete_participant(writer_participant_);
+    }
+
+    bool init()
+    {
+        auto flow_controller = std::make_shared<eprosima::fastdds::rtps::FlowControllerDescriptor>();
+        flow_controller->name = "deadline_bench";
+        flow_controller->scheduler = scheduler_;
+        flow_controller->max_bytes_per_period = BYTES_PER_PERIOD;
+        flow_controller->period_ms = PERIOD_MS;
+        DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
+        pqos.flow_controllers().push_back(flow_controller);
+
+        writer_participant_ = DomainParticipantFactory::get_instance()->create_participant(0, pqos);
+        reader_participant_ = DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+        if (writer_participant_ == nullptr || reader_participant_ == nullptr) return false;
+
+        type_.register_type(writer_participant_);
+        type_.register_type(reader_participant_);
+
+        publisher_ = writer_participant_->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+        subscriber_ = reader_participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT, nullptr);
+        if (publisher_ == nullptr || subscriber_ == nullptr) return false;
+
+        // 0: bulk, 1: urgent
+        const char* names[2] = {"DeadlineBulkTopic", "DeadlineUrgentTopic"};
+        const uint32_t deadlines_ms[2] = {BULK_DEADLINE_MS, URGENT_DEADLINE_MS};
+        const uint32_t samples[2] = {rounds_ * BULK_PER_ROUND, rounds_ * URGENT_PER_ROUND};
+        LatencyListener* listeners[2] = {&bulk_listener_, &urgent_listener_};
+        for (int i = 0; i < 2; ++i)
+        {
+            Topic* writer_topic = writer_participant_->create_topic(names[i], type_.get_type_name(), TOPIC_QOS_DEFAULT);
+            Topic* reader_topic = reader_participant_->create_topic(names[i], type_.get_type_name(), TOPIC_QOS_DEFAULT);
+            if (writer_topic == nullptr || reader_topic == nullptr) return false;
+            writer_topics_.push_back(writer_topic);
+            reader_topics_.push_back(reader_topic);
+
+            // 모든 샘플이 히스토리에 남도록 KEEP_ALL 로 받아 쓰기가 막히지 않게 한다
+            DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+            wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+            wqos.history().kind = KEEP_ALL_HISTORY_QOS;
+            wqos.resource_limits().max_samples = static_cast<int32_t>(samples[i]);
+            wqos.resource_limits().max_samples_per_instance = static_cast<int32_t>(samples[i]);
+            wqos.publish_mode().kind = ASYNCHRONOUS_PUBLISH_MODE;
+            wqos.publish_mode().flow_controller_name = "deadline_bench";
+            wqos.latency_budget().duration = eprosima::fastdds::dds::Duration_t(0, deadlines_ms[i] * 1000000u);
+            wqos.data_sharing().off();
+
+            DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+            rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+            rqos.history().kind = KEEP_ALL_HISTORY_QOS;
+            rqos.resource_limits().max_samples = static_cast<int32_t>(samples[i]);
+            rqos.resource_limits().max_samples_per_instance = static_cast<int32_t>(samples[i]);
+            rqos.data_sharing().off();
+
+            DataWriter* writer = publisher_->create_datawriter(writer_topic, wqos, nullptr);
+            DataReader* reader = subscriber_->create_datareader(reader_topic, rqos, listeners[i]);
+            if (writer == nullptr || reader == nullptr) return false;
+            writers_.push_back(writer);
+            readers_.push_back(reader);
+        }
+
+        // 매칭될 때까지 최대 5초 대기
+        for (int i = 0; i < 500; ++i)
+        {
+            PublicationMatchedStatus bulk_status;
+            PublicationMatchedStatus urgent_status;
+            writers_[0]->get_publication_matched_status(bulk_status);
+            writers_[1]->get_publication_matched_status(urgent_status);
+            if (bulk_status.current_count > 0 && urgent_status.current_count > 0) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+    // 모든 라운드를 쓰고 샘플이 다 도착할 때까지 (최대 10초) 기다린다
+    void run()
+    {
+        SampleType* sample = static_cast<SampleType*>(type_.create_data());
+        sample->size = 4096;
+        auto next_round = std::chrono::steady_clock::now();
+        for (uint32_t round = 0; round < rounds_; ++round)
+        {
+            std::this_thread::sleep_until(next_round);
+            next_round += std::chrono::milliseconds(ROUND_MS);
+
+            write_burst(writers_[0], sample, bulk_times_, round * BULK_PER_ROUND, BULK_PER_ROUND);
+            write_burst(writers_[1], sample, urgent_times_, round * URGENT_PER_ROUND, URGENT_PER_ROUND);
+        }
+        type_.delete_data(sample);
+
+        auto limit = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (std::chrono::steady_clock::now() < limit)
+        {
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                if (bulk_listener_.latencies_ms.size() >= bulk_times_.size() &&
+                        urgent_listener_.latencies_ms.size() >= urgent_times_.size())
+                {
+                    break;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    // 마감 시간을 넘긴 (또는 받지 못한) 샘플의 비율과 지연 시간의 p99 (ms)
+    void result(bool urgent, double& miss_rate, double& p99_ms)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        std::vector<double> latencies = urgent ? urgent_listener_.latencies_ms : bulk_listener_.latencies_ms;
+        size_t total = urgent ? urgent_times_.size() : bulk_times_.size();
+        double deadline_ms = urgent ? URGENT_DEADLINE_MS : BULK_DEADLINE_MS;
+
+        size_t misses = total > latencies.size() ? total - latencies.size() : 0;
+        for (double latency : latencies)
+        {
+            if (latency > deadline_ms) ++misses;
+        }
+        miss_rate = total > 0 ? 100.0 * static_cast<double>(misses) / static_cast<double>(total) : 0.0;
+
+        std::sort(latencies.begin(), latencies.end());
+        p99_ms = latencies.empty() ? 0.0 :
+                latencies[std::min(static_cast<size_t>(0.99 * static_cast<double>(latencies.size() - 1) + 0.5),
+                latencies.size() - 1)];
+    }
+
+private:
+
+    void write_burst(DataWriter* writer, SampleType* sample, std::vector<std::chrono::steady_clock::time_point>& times,
+            uint32_t first, uint32_t count)
+    {
+        for (uint32_t i = first; i < first + count; ++i)
+        {
+            sample->index = i;
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                times[i] = std::chrono::steady_clock::now();
+            }
+            writer->write(sample);
+        }
+    }
+
+    FlowControllerSchedulerPolicy scheduler_;
+    uint32_t rounds_;
+    std::mutex mutex_;
+    std::vector<std::chrono::steady_clock::time_point> bulk_times_;
+    std::vector<std::chrono::steady_clock::time_point> urgent_times_;
+    LatencyListener bulk_listener_;
+    LatencyListener urgent_listener_;
+    DomainParticipant* writer_participant_ = nullptr;
+    DomainParticipant* reader_participant_ = nullptr;
+    Publisher* publisher_ = nullptr;
+    Subscriber* subscriber_ = nullptr;
+    std::vector<Topic*> writer_topics_;
+    std::vector<Topic*> reader_topics_;
+    std::vector<DataWriter*> writers_;
+    std::vector<DataReader*> readers_;
+    TypeSupport type_;
+};
+
+constexpr uint32_t DeadlineSchedulingBenchmark::PERIOD_MS;
+constexpr int32_t DeadlineSchedulingBenchmark::BYTES_PER_PERIOD;
+constexpr uint32_t DeadlineSchedulingBenchmark::ROUND_MS;
+constexpr uint32_t DeadlineSchedulingBenchmark::BULK_PER_ROUND;
+constexpr uint32_t DeadlineSchedulingBenchmark::URGENT_PER_ROUND;
+constexpr uint32_t DeadlineSchedulingBenchmark::BULK_DEADLINE_MS;
+constexpr uint32_t DeadlineSchedulingBenchmark::URGENT_DEADLINE_MS;
+
+void run_deadline_benchmark(uint32_t rounds)
+{
+    // 같은 프로세스 안의 reader 도 흐름 제어기와 UDP 를 거치도록 intraprocess 전달을 끈다
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    DomainParticipantFactory::get_instance()->set_library_settings(settings);
+
+    std::cout << "=== 흐름 제어기 마감 시간 벤치마크 (라운드: " << rounds << ", 대역폭: "
+              << DeadlineSchedulingBenchmark::BYTES_PER_PERIOD / 1024 << " KB / "
+              << DeadlineSchedulingBenchmark::PERIOD_MS << " ms) ===" << std::endl;
+    std::cout << "  스케줄러 | urgent 미스(%) | urgent p99(ms) | bulk 미스(%) | bulk p99(ms)" << std::endl;
+
+    const std::pair<FlowControllerSchedulerPolicy, const char*> schedulers[2] = {
+        {FlowControllerSchedulerPolicy::FIFO, "FIFO"},
+        {FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST, "EDF"}};
+    for (const auto& scheduler : schedulers)
+    {
+        DeadlineSchedulingBenchmark bench(scheduler.first, rounds);
+        if (!bench.init())
+        {
+            std::cerr << "벤치마크 준비 실패 (" << scheduler.second << ")" << std::endl;
+            continue;
+        }
+        bench.run();
+
+        double urgent_miss = 0;
+        double urgent_p99 = 0;
+        double bulk_miss = 0;
+        double bulk_p99 = 0;
+        bench.result(true, urgent_miss, urgent_p99);
+        bench.result(false, bulk_miss, bulk_p99);
+        std::cout << std::setw(10) << scheduler.second << " | " << std::fixed << std::setprecision(1)
+                  << std::setw(14) << urgent_miss << " | " << std::setw(14) << urgent_p99 << " | "
+                  << std::setw(12) << bulk_miss << " | " << std::setw(12) << bulk_p99 << std::endl;
+    }
+
+    std::cout << "=== 흐름 제어기 마감 시간 벤치마크 종료 ===" << std::endl;
+}
+
+// TypeObject 레지스트리 벤치마크
+// HelloWorld 의 complete TypeObject 를 이름만 바꿔 여러 개 만들고, 원격 타입처럼 등록할 때(minimal 은 minimal
+// TypeIdentifier 로 처음 찾을 때 만든다)와 로컬 타입처럼 등록할 때(minimal 을 바로 만든다)의 시간과 메모리,
+// 그리고 여러 스레드에서 get_type_object 로 찾는 처리량을 잰다.
+class TypeObjectRegistryBenchmark
+{
+public:
+
+    explicit TypeObjectRegistryBenchmark(uint32_t num_types)
+        : num_types_(num_types)
+    {
+    }
+
+    bool init()
+    {
+        TypeSupport type(new HelloWorldPubSubType());
+        type->register_type_object_representation();
+        xtypes::TypeObjectPair type_objects;
+        if (RETCODE_OK != registry().get_type_objects(type->get_name(), type_objects))
+        {
+            return false;
+        }
+        complete_ = type_objects.complete_type_object;
+        return true;
+    }
+
+    // 이름이 다른 complete TypeObject 를 원격 타입으로 등록한다
+    double register_remote(std::vector<xtypes::TypeIdentifier>& complete_ids)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < num_types_; ++i)
+        {
+            xtypes::TypeObject type_object = complete_;
+            type_object.complete().struct_type().header().detail().type_name("RemoteType_" + std::to_string(i));
+            xtypes::TypeIdentifierPair type_ids;
+            if (RETCODE_OK == registry().register_type_object(type_object, type_ids))
+            {
+                complete_ids.push_back(type_ids.type_identifier1());
+            }
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // 이름이 다른 complete TypeObject 를 로컬 타입으로 등록한다
+    double register_local(std::vector<xtypes::TypeIdentifier>& complete_ids,
+            std::vector<xtypes::TypeIdentifier>& minimal_ids)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < num_types_; ++i)
+        {
+            std::string name = "LocalType_" + std::to_string(i);
+            xtypes::CompleteTypeObject type_object = complete_.complete();
+            type_object.struct_type().header().detail().type_name(name);
+            xtypes::TypeIdentifierPair type_ids;
+            if (RETCODE_OK == registry().register_type_object(name, type_object, type_ids))
+            {
+                bool first_complete = xtypes::EK_COMPLETE == type_ids.type_identifier1()._d();
+                complete_ids.push_back(first_complete ? type_ids.type_identifier1() : type_ids.type_identifier2());
+                minimal_ids.push_back(first_complete ? type_ids.type_identifier2() : type_ids.type_identifier1());
+            }
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // 여러 스레드가 주어진 TypeIdentifier 들을 돌아가며 찾는다. 초당 조회 수와 찾지 못한 수를 돌려준다.
+    double lookup(const std::vector<xtypes::TypeIdentifier>& type_ids, uint32_t num_threads,
+            uint32_t lookups_per_thread, uint64_t& misses)
+    {
+        std::atomic<uint64_t> not_found(0);
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back([&, t]()
+                    {
+                        xtypes::TypeObject type_object;
+                        uint64_t local_misses = 0;
+                        for (uint32_t i = 0; i < lookups_per_thread; ++i)
+                        {
+                            const xtypes::TypeIdentifier& type_id = type_ids[(i + t * 7919u) % type_ids.size()];
+                            if (RETCODE_OK != registry().get_type_object(type_id, type_object))
+                            {
+                                ++local_misses;
+                            }
+                        }
+                        not_found += local_misses;
+                    });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        misses = not_found.load();
+        return static_cast<double>(num_threads) * lookups_per_thread / std::max(seconds, 1e-9);
+    }
+
+private:
+
+    static xtypes::ITypeObjectRegistry& registry()
+    {
+        return DomainParticipantFactory::get_instance()->type_object_registry();
+    }
+
+    uint32_t num_types_;
+    xtypes::TypeObject complete_;
+};
+
+void run_typeobject_benchmark(uint32_t num_types, uint32_t num_threads)
+{
+    std::cout << "=== TypeObject 레지스트리 벤치마크 (타입: " << num_types << ", 조회 스레드: " << num_threads
+              << ") ===" << std::endl;
+
+    TypeObjectRegistryBenchmark bench(num_types);
+    if (!bench.init())
+    {
+        std::cerr << "HelloWorld TypeObject 등록 실패" << std::endl;
+        return;
+    }
+
+    std::vector<xtypes::TypeIdentifier> remote_complete_ids;
+    size_t memory_before = resident_memory_bytes();
+    double remote_ms = bench.register_remote(remote_complete_ids);
+    size_t memory_remote = resident_memory_bytes();
+
+    std::vector<xtypes::TypeIdentifier> local_complete_ids;
+    std::vector<xtypes::TypeIdentifier> local_minimal_ids;
+    double local_ms = bench.register_local(local_complete_ids, local_minimal_ids);
+    size_t memory_local = resident_memory_bytes();
+
+    if (remote_complete_ids.empty() || local_minimal_ids.empty())
+    {
+        std::cerr << "타입 등록 실패" << std::endl;
+        return;
+    }
+
+    const uint32_t lookups_per_thread = 1000000;
+    uint64_t remote_misses = 0;
+    uint64_t complete_misses = 0;
+    uint64_t minimal_misses = 0;
+    double remote_rate = bench.lookup(remote_complete_ids, num_threads, lookups_per_thread, remote_misses);
+    double complete_rate = bench.lookup(local_complete_ids, num_threads, lookups_per_thread, complete_misses);
+    double minimal_rate = bench.lookup(local_minimal_ids, num_threads, lookups_per_thread, minimal_misses);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "원격 등록 (minimal 지연 생성): " << remote_complete_ids.size() << "개, " << remote_ms << " ms, 메모리 +"
+              << (memory_remote > memory_before ? memory_remote - memory_before : 0) / 1024.0 << " KB" << std::endl
+              << "로컬 등록 (minimal 즉시 생성): " << local_complete_ids.size() << "개, " << local_ms << " ms, 메모리 +"
+              << (memory_local > memory_remote ? memory_local - memory_remote : 0) / 1024.0 << " KB" << std::endl
+              << "원격 complete 조회: " << remote_rate / 1e6 << " M/s (실패 " << remote_misses << ")" << std::endl
+              << "로컬 complete 조회: " << complete_rate / 1e6 << " M/s (실패 " << complete_misses << ")" << std::endl
+              << "로컬 minimal 조회: " << minimal_rate / 1e6 << " M/s (실패 " << minimal_misses << ")" << std::endl;
+    std::cout << "=== TypeObject 레지스트리 벤치마크 종료 ===" << std::endl;
+}
+
+// 참여자 시작 시간 벤치마크
+// 참여자를 하나씩 만들면서 create_participant 시간과 첫 DataWriter 생성 시간을 잰다.
+// 지연 생성(fastdds.deferred_builtin_endpoints)을 켜면 TypeLookup 서비스 엔드포인트가
+// 첫 엔드포인트 또는 첫 원격 타입 요청 때 만들어지므로, 비용이 어디로 옮겨가는지 함께 출력한다.
+static double percentile(std::vector<double> values, double ratio)
+{
+    if (values.empty()) return 0.0;
+    std::sort(values.begin(), values.end());
+    size_t index = static_cast<size_t>(ratio * static_cast<double>(values.size() - 1) + 0.5);
+    return values[std::min(index, values.size() - 1)];
+}
+
+static double mean(const std::vector<double>& values)
+{
+    double sum = 0.0;
+    for (double value : values) sum += value;
+    return values.empty() ? 0.0 : sum / static_cast<double>(values.size());
+}
+
+void run_startup_benchmark_mode(uint32_t num_participants, bool deferred)
+{
+    struct StartupParticipant
+    {
+        DomainParticipant* participant = nullptr;
+        Topic* topic = nullptr;
+        Publisher* publisher = nullptr;
+        DataWriter* writer = nullptr;
+    };
+
+    DomainParticipantQos qos = PARTICIPANT_QOS_DEFAULT;
+    if (deferred)
+    {
+        qos.properties().properties().emplace_back("fastdds.deferred_builtin_endpoints", "true");
+    }
+
+    std::vector<StartupParticipant> participants(num_participants);
+    std::vector<double> create_us;
+    std::vector<double> first_writer_us;
+    size_t start_threads = thread_count();
+    size_t start_memory = resident_memory_bytes();
+
+    // 참여자를 모두 만든 뒤에 엔드포인트를 만들어 두 단계를 따로 잰다
+    for (auto& entry : participants)
+    {
+        auto start = std::chrono::steady_clock::now();
+        entry.participant = DomainParticipantFactory::get_instance()->create_participant(0, qos);
+        create_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        if (entry.participant == nullptr)
+        {
+            std::cerr << "참여자 생성 실패" << std::endl;
+            create_us.pop_back();
+            break;
+        }
+    }
+    size_t created_threads = thread_count();
+    size_t created_memory = resident_memory_bytes();
+
+    for (size_t i = 0; i < participants.size(); ++i)
+    {
+        StartupParticipant& entry = participants[i];
+        if (entry.participant == nullptr) break;
+
+        TypeSupport type(new HelloWorldPubSubType());
+        type.register_type(entry.participant);
+        entry.topic = entry.participant->create_topic("StartupTopic_" + std::to_string(i), type.get_type_name(),
+                        TOPIC_QOS_DEFAULT);
+        entry.publisher = entry.participant->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+        if (entry.topic == nullptr || entry.publisher == nullptr) break;
+
+        auto start = std::chrono::steady_clock::now();
+        entry.writer = entry.publisher->create_datawriter(entry.topic, DATAWRITER_QOS_DEFAULT, nullptr);
+        first_writer_us.push_back(
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    std::vector<double> total_us;
+    for (size_t i = 0; i < first_writer_us.size(); ++i)
+    {
+        total_us.push_back(create_us[i] + first_writer_us[i]);
+    }
+
+    double created = static_cast<double>(std::max<size_t>(create_us.size(), 1));
+    double memory_delta = created_memory > start_memory ? static_cast<double>(created_memory - start_memory) : 0.0;
+    std::cout << (deferred ? "지연 생성" : "기본") << " (참여자 " << create_us.size() << "개)" << std::endl;
+    std::cout << std::fixed << std::setprecision(1)
+              << "  create_participant us: 평균 " << mean(create_us) << ", p50 " << percentile(create_us, 0.5)
+              << ", p99 " << percentile(create_us, 0.99) << std::endl;
+    std::cout << "  첫 DataWriter us:       평균 " << mean(first_writer_us) << ", p50 "
+              << percentile(first_writer_us, 0.5) << ", p99 " << percentile(first_writer_us, 0.99) << std::endl;
+    std::cout << "  합계 us:                평균 " << mean(total_us) << ", p50 " << percentile(total_us, 0.5)
+              << ", p99 " << percentile(total_us, 0.99) << std::endl;
+    std::cout << "  참여자당 스레드 " << static_cast<double>(created_threads - start_threads) / created
+              << " -> " << static_cast<double>(thread_count() - start_threads) / created
+              << ", 메모리 " << memory_delta / created / 1024.0 << " KB (엔드포인트 생성 전)" << std::endl;
+
+    for (auto& entry : participants)
+    {
+        if (entry.participant == nullptr) continue;
+        entry.participant->delete_contained_entities();
+        DomainParticipantFactory::get_instance()->delete_participant(entry.participant);
+    }
+}
+
+// 기본 시작과 지연 생성 시작을 차례로 측정한다
+void run_startup_benchmark(uint32_t num_participants)
+{
+    std::cout << "=== 참여자 시작 시간 벤치마크 (참여자: " << num_participants << ") ===" << std::endl;
+    run_startup_benchmark_mode(num_participants, false);
+    run_startup_benchmark_mode(num_participants, true);
+    std::cout << "=== 참여자 시작 시간 벤치마크 종료 ===" << std::endl;
+}
+
+// 지연 생성 참여자 대상 타입 조회 테스트
+// 지연 생성 참여자는 첫 DATA(p)에 TypeLookup 엔드포인트를 알리지 않고, 첫 DataWriter를 만들 때
+// 엔드포인트를 만든 뒤 DATA(p)를 다시 보낸다. 이미 그 참여자를 알고 있는 원격 참여자는 갱신된 DATA(p)로
+// TypeLookup 엔드포인트를 매칭해야 writer의 타입을 조회할 수 있다.
+// 타입 레지스트리는 프로세스 전역이므로 지연 생성 참여자는 fork한 자식 프로세스에서 만든다.
+int run_deferred_typelookup_test(uint32_t timeout_ms)
+{
+    std::cout << "=== 지연 생성 참여자 타입 조회 테스트 ===" << std::endl << std::flush;
+
+    pid_t child = fork();
+    if (child < 0)
+    {
+        std::cerr << "fork 실패" << std::endl;
+        return 1;
+    }
+
+    if (child == 0)
+    {
+        // 자식: 지연 생성 참여자. 원격 참여자가 먼저 발견하도록 기다린 뒤 writer를 만든다
+        DomainParticipantQos qos = PARTICIPANT_QOS_DEFAULT;
+        qos.properties().properties().emplace_back("fastdds.deferred_builtin_endpoints", "true");
+        DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(0, qos);
+        if (participant == nullptr) _exit(1);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+        TypeSupport type(new HelloWorldPubSubType());
+        type.register_type(participant);
+        Topic* topic = participant->create_topic("DeferredTypeLookupTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+        Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+        if (topic != nullptr && publisher != nullptr)
+        {
+            publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT, nullptr);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms + 1000));
+        participant->delete_contained_entities();
+        DomainParticipantFactory::get_instance()->delete_participant(participant);
+        _exit(0);
+    }
+
+    // 부모: 타입을 등록하지 않은 기본 참여자. writer를 발견하면 그 타입을 TypeLookup으로 받아야 한다
+    class TypeLookupListener : public DomainParticipantListener
+    {
+    public:
+        void on_data_writer_discovery(
+                DomainParticipant*,
+                WriterDiscoveryStatus reason,
+                const PublicationBuiltinTopicData& info,
+                bool&) override
+        {
+            if (reason != WriterDiscoveryStatus::DISCOVERED_WRITER || !info.type_information.assigned()) return;
+
+            std::lock_guard<std::mutex> guard(mutex_);
+            type_id_ = info.type_information.type_information.complete().typeid_with_size().type_id();
+            discovered_ = true;
+        }
+
+        bool type_id(xtypes::TypeIdentifier& type_id)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            type_id = type_id_;
+            return discovered_;
+        }
+
+    private:
+        std::mutex mutex_;
+        xtypes::TypeIdentifier type_id_;
+        bool discovered_ = false;
+    } listener;
+
+    DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(0,
+                    PARTICIPANT_QOS_DEFAULT, &listener, StatusMask::none());
+    bool discovered = false;
+    bool resolved = false;
+    if (participant != nullptr)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms + 1000);
+        while (!resolved && std::chrono::steady_clock::now() < deadline)
+        {
+            xtypes::TypeIdentifier type_id;
+            xtypes::TypeObject type_object;
+            discovered = listener.type_id(type_id);
+            resolved = discovered && RETCODE_OK ==
+                    DomainParticipantFactory::get_instance()->type_object_registry().get_type_object(type_id,
+                    type_object);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        participant->set_listener(nullptr);
+        DomainParticipantFactory::get_instance()->delete_participant(participant);
+    }
+
+    int status = 0;
+    waitpid(child, &status, 0);
+
+    std::cout << "writer 발견: " << (discovered ? "예" : "아니오") << std::endl
+              << "타입 조회: " << (resolved ? "성공" : "실패") << std::endl;
+    std::cout << "=== 지연 생성 참여자 타입 조회 테스트 종료 ===" << std::endl;
+    return resolved ? 0 : 1;
+}
+
 int main(int argc, char** argv)
 {
+    // plain 타입 벤치마크 모드: HelloWorldSimulator --plain-bench [반복 횟수]
+    if (argc > 1 && std::string(argv[1]) == "--plain-bench")
+    {
+        uint32_t iterations = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 100;
+        run_plain_benchmark(iterations);
+        return 0;
+    }
+
+    // 깊은 히스토리 모드: HelloWorldSimulator --history-bench [최대 깊이] [reader 수]
+    if (argc > 1 && std::string(argv[1]) == "--history-bench")
+    {
+        uint32_t max_depth = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 10000;
+        uint32_t num_readers = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 4;
+        run_history_benchmark(max_depth, std::max(num_readers, 1u));
+        return 0;
+    }
+
+    // 타이머 부하 모드: HelloWorldSimulator --timer-bench [writer 수] [deadline 주기(ms)] [단계별 측정 시간(s)]
+    if (argc > 1 && std::string(argv[1]) == "--timer-bench")
+    {
+        uint32_t num_writers = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 25000;
+        uint32_t period_ms = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 100;
+        uint32_t seconds = argc > 4 ? static_cast<uint32_t>(atoi(argv[4])) : 2;
+        run_timer_benchmark(std::max(num_writers, 1u), std::max(period_ms, 1u), std::max(seconds, 1u));
+        return 0;
+    }
+
+    // 흐름 제어기 마감 시간 모드: HelloWorldSimulator --deadline-bench [라운드 수]
+    if (argc > 1 && std::string(argv[1]) == "--deadline-bench")
+    {
+        uint32_t rounds = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 50;
+        run_deadline_benchmark(std::max(rounds, 1u));
+        return 0;
+    }
+
+    // 디스커버리 부하 모드:
+    // HelloWorldSimulator --discovery-load [가상 참여자 수] [참여자당 엔드포인트 수] [실제 참여자 수] [제한 시간(s)]
+    if (argc > 1 && std::string(argv[1]) == "--discovery-load")
+    {
+        uint32_t num_virtual = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 1000;
+        uint32_t endpoints = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 4;
+        uint32_t num_real = argc > 4 ? static_cast<uint32_t>(atoi(argv[4])) : 1;
+        uint32_t timeout_s = argc > 5 ? static_cast<uint32_t>(atoi(argv[5])) : 120;
+        run_discovery_load(num_virtual, endpoints, std::max(num_real, 1u), timeout_s);
+        return 0;
+    }
+
+    // 반복 알림 처리 모드: HelloWorldSimulator --reannounce-bench [가상 참여자 수] [참여자당 엔드포인트 수] [알림 횟수]
+    if (argc > 1 && std::string(argv[1]) == "--reannounce-bench")
+    {
+        uint32_t num_virtual = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 1000;
+        uint32_t endpoints = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 10;
+        uint32_t rounds = argc > 4 ? static_cast<uint32_t>(atoi(argv[4])) : 20;
+        run_reannounce_benchmark(std::max(num_virtual, 1u), endpoints, std::max(rounds, 1u));
+        return 0;
+    }
+
+    // 디스커버리 서버 매칭 처리량 모드:
+    // HelloWorldSimulator --ds-match-bench [클라이언트 수] [클라이언트당 엔드포인트 수] [토픽 수] [제한 시간(s)]
+    if (argc > 1 && std::string(argv[1]) == "--ds-match-bench")
+    {
+        uint32_t num_clients = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 20;
+        uint32_t endpoints = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 100;
+        uint32_t num_topics = argc > 4 ? static_cast<uint32_t>(atoi(argv[4])) : 50;
+        uint32_t timeout_s = argc > 5 ? static_cast<uint32_t>(atoi(argv[5])) : 120;
+        run_discovery_server_benchmark(std::max(num_clients, 1u), std::max(endpoints, 1u), std::max(num_topics, 1u),
+                timeout_s);
+        return 0;
+    }
+
+    // 백업 서버 복원 시간 모드:
+    // HelloWorldSimulator --restore-bench [엔드포인트 수] [참여자당 엔드포인트 수] [저널 참여자 수]
+    if (argc > 1 && std::string(argv[1]) == "--restore-bench")
+    {
+        uint32_t endpoints = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 100000;
+        uint32_t endpoints_per_participant = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 1000;
+        uint32_t journal_participants = argc > 4 ? static_cast<uint32_t>(atoi(argv[4])) : 100;
+        run_restore_benchmark(std::max(endpoints, 1u), std::max(endpoints_per_participant, 1u), journal_participants);
+        return 0;
+    }
+
+    // TypeObject 레지스트리 모드: HelloWorldSimulator --typeobject-bench [타입 수] [조회 스레드 수]
+    if (argc > 1 && std::string(argv[1]) == "--typeobject-bench")
+    {
+        uint32_t num_types = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 5000;
+        uint32_t num_threads = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 4;
+        run_typeobject_benchmark(std::max(num_types, 1u), std::max(num_threads, 1u));
+        return 0;
+    }
+
+    // 참여자 시작 시간 모드: HelloWorldSimulator --startup-bench [참여자 수]
+    if (argc > 1 && std::string(argv[1]) == "--startup-bench")
+    {
+        uint32_t num_participants = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 20;
+        run_startup_benchmark(std::max(num_participants, 1u));
+        return 0;
+    }
+
+    // 지연 생성 타입 조회 테스트 모드: HelloWorldSimulator --deferred-typelookup-test [대기 ms]
+    if (argc > 1 && std::string(argv[1]) == "--deferred-typelookup-test")
+    {
+        uint32_t timeout_ms = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 5000;
+        return run_deferred_typelookup_test(timeout_ms);
+    }
+
     // 샘플 수 설정 (기본값 10)
     uint32_t samples = 10;
     
@@ -0,0 +1,193 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file PlainPayloadPubSubTypes.hpp
+ *
+ * 고정 크기 plain 타입과 그 TopicDataType 구현.
+ * 아래 IDL 을 fastddsgen 으로 생성한 코드와 같은 직렬화 결과를 내며, 크기별로 타입을 만들 수 있도록 템플릿으로 작성했다.
+ *
+ *     @final
+ *     struct PlainPayload_N
+ *     {
+ *         unsigned long index;
+ *         unsigned long size;
+ *         octet data[N];
+ *     };
+ *
+ * 메모리 배치가 XCDR1 / XCDR2 직렬화 결과와 같으므로 (is_plain), DataSharing 을 사용할 때
+ * loan_sample / LoanableSequence 로 직렬화 없이 송수신할 수 있다.
+ */
+
+#ifndef FAST_DDS_SIMULATOR__PLAINPAYLOAD_PUBSUBTYPES_HPP
+#define FAST_DDS_SIMULATOR__PLAINPAYLOAD_PUBSUBTYPES_HPP
+
+#include <cstdint>
+#include <new>
+#include <string>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/rtps/common/CdrSerialization.hpp>
+#include <fastdds/rtps/common/InstanceHandle.hpp>
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+
+// 고정 크기 plain 샘플. N 은 4 의 배수여야 한다.
+template<uint32_t N>
+struct PlainPayload
+{
+    static_assert(N > 0 && 0 == N % 4, "PlainPayload size should be a multiple of 4");
+
+    uint32_t index;
+    uint32_t size;
+    uint8_t data[N];
+};
+
+template<uint32_t N>
+class PlainPayloadPubSubType : public eprosima::fastdds::dds::TopicDataType
+{
+public:
+
+    typedef PlainPayload<N> type;
+
+    PlainPayloadPubSubType()
+    {
+        set_name(("PlainPayload_" + std::to_string(N)).c_str());
+        max_serialized_type_size = static_cast<uint32_t>(sizeof(type)) + 4u; /*encapsulation*/
+        is_compute_key_provided = false;
+    }
+
+    bool serialize(
+            const void* const data,
+            eprosima::fastdds::rtps::SerializedPayload_t& payload,
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) override
+    {
+        const type* p_type = static_cast<const type*>(data);
+
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload.data), payload.max_size);
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                is_xcdr1(data_representation) ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload.encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        ser.set_encoding_flag(
+            is_xcdr1(data_representation) ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR :
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR2);
+
+        try
+        {
+            ser.serialize_encapsulation();
+            ser << p_type->index << p_type->size;
+            ser.serialize_array(p_type->data, N);
+            ser.set_dds_cdr_options({0, 0});
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        payload.length = static_cast<uint32_t>(ser.get_serialized_data_length());
+        return true;
+    }
+
+    bool deserialize(
+            eprosima::fastdds::rtps::SerializedPayload_t& payload,
+            void* data) override
+    {
+        try
+        {
+            type* p_type = static_cast<type*>(data);
+
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload.data), payload.length);
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN);
+
+            deser.read_encapsulation();
+            payload.encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            deser >> p_type->index >> p_type->size;
+            deser.deserialize_array(p_type->data, N);
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    uint32_t calculate_serialized_size(
+            const void* const /*data*/,
+            eprosima::fastdds::dds::DataRepresentationId_t /*data_representation*/) override
+    {
+        return max_serialized_type_size;
+    }
+
+    bool compute_key(
+            eprosima::fastdds::rtps::SerializedPayload_t& /*payload*/,
+            eprosima::fastdds::rtps::InstanceHandle_t& /*ihandle*/,
+            bool /*force_md5*/ = false) override
+    {
+        return false;
+    }
+
+    bool compute_key(
+            const void* const /*data*/,
+            eprosima::fastdds::rtps::InstanceHandle_t& /*ihandle*/,
+            bool /*force_md5*/ = false) override
+    {
+        return false;
+    }
+
+    void* create_data() override
+    {
+        return reinterpret_cast<void*>(new type());
+    }
+
+    void delete_data(
+            void* data) override
+    {
+        delete(reinterpret_cast<type*>(data));
+    }
+
+    bool is_bounded() const override
+    {
+        return true;
+    }
+
+    // @final 구조체이므로 XCDR1 / XCDR2 모두 메모리 배치와 직렬화 결과가 같다
+    bool is_plain(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) const override
+    {
+        static_cast<void>(data_representation);
+        return true;
+    }
+
+    bool construct_sample(
+            void* memory) const override
+    {
+        new (memory) type();
+        return true;
+    }
+
+private:
+
+    static bool is_xcdr1(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation)
+    {
+        return eprosima::fastdds::dds::DataRepresentationId_t::XCDR_DATA_REPRESENTATION == data_representation;
+    }
+
+};
+
+#endif // FAST_DDS_SIMULATOR__PLAINPAYLOAD_PUBSUBTYPES_HPP
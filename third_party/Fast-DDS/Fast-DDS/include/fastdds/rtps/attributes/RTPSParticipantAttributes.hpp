@@ -277,6 +277,16 @@ public:
     //!Initial announcements configuration
     InitialAnnouncementConfig initial_announcements;
 
+    /**
+     * Number of periodic announcements between two announcements carrying the full participant data.
+     * The periodic announcements in between only send a HEARTBEAT with the sequence number of the last
+     * participant data, which keeps the RTPSParticipant alive on the remote participants.
+     * Initial announcements, changes on the participant data, and newly discovered participants always get the
+     * full data. The default value of 1 sends the full data on every announcement.
+     * Only used by the SIMPLE discovery protocol.
+     */
+    uint32_t full_announcement_period = 1;
+
     //!Attributes of the SimpleEDP protocol
     SimpleEDPAttributes m_simpleEDP;
 
@@ -308,6 +318,7 @@ public:
                (this->leaseDuration == b.leaseDuration) &&
                (this->leaseDuration_announcementperiod == b.leaseDuration_announcementperiod) &&
                (this->initial_announcements == b.initial_announcements) &&
+               (this->full_announcement_period == b.full_announcement_period) &&
                (this->m_simpleEDP == b.m_simpleEDP) &&
                (this->static_edp_xml_config_ == b.static_edp_xml_config_) &&
                (this->m_DiscoveryServers == b.m_DiscoveryServers) &&
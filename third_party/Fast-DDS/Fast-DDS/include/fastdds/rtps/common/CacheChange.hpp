@@ -53,6 +53,9 @@ struct CacheChangeWriterInfo_t
     CacheChange_t* volatile next = nullptr;
     //! Used to know if the object is already in a list.
     std::atomic_bool is_linked {false};
+    //! Time, in nanoseconds of the steady clock, when the change should be sent.
+    //! Used by the earliest deadline first scheduler of FlowControllerImpl.
+    int64_t due_time_ns = 0;
 };
 
 /*!
@@ -204,6 +204,38 @@ public:
         }
     }
 
+    /**
+     * Get the collection of entries of this selector.
+     *
+     * @return a const reference to the entries collection.
+     */
+    const ResourceLimitedVector<LocatorSelectorEntry*>& entries() const
+    {
+        return entries_;
+    }
+
+    /**
+     * Get the indexes of the selected entries.
+     *
+     * @return a const reference to the collection of selected entry indexes.
+     */
+    const ResourceLimitedVector<size_t>& selections() const
+    {
+        return selections_;
+    }
+
+    /**
+     * Restore a selection previously obtained with selections().
+     * The selection state of each entry should be restored by the caller.
+     *
+     * @param selections Indexes of the entries to mark as selected.
+     */
+    void restore_selections(
+            const std::vector<size_t>& selections)
+    {
+        selections_.assign(selections.begin(), selections.end());
+    }
+
     /**
      * Count the number of selected locators.
      *
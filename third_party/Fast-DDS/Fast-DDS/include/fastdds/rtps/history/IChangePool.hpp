@@ -19,6 +19,8 @@
 #ifndef FASTDDS_RTPS_HISTORY__ICHANGEPOOL_HPP
 #define FASTDDS_RTPS_HISTORY__ICHANGEPOOL_HPP
 
+#include <cstddef>
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -63,6 +65,29 @@ public:
      */
     virtual bool release_cache(
             CacheChange_t* cache_change) = 0;
+
+    /**
+     * @brief Return a number of cache changes to the pool
+     *
+     * @param [in] cache_changes  Array with the pointers to the cache changes to release.
+     * @param [in] num_changes    Number of cache changes to release.
+     *
+     * @returns whether the operation succeeded for all the cache changes or not
+     *
+     * @pre Each of the @c num_changes first elements of @c cache_changes fulfills the preconditions of
+     *      @c release_cache
+     */
+    virtual bool release_caches(
+            CacheChange_t* const* cache_changes,
+            size_t num_changes)
+    {
+        bool ret_val = true;
+        for (size_t i = 0; i < num_changes; ++i)
+        {
+            ret_val = release_cache(cache_changes[i]) && ret_val;
+        }
+        return ret_val;
+    }
 };
 
 } // namespace rtps
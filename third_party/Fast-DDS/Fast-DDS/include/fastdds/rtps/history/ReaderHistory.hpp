@@ -236,6 +236,16 @@ protected:
     FASTDDS_EXPORTED_API void do_release_cache(
             CacheChange_t* ch) override;
 
+    /**
+     * Return a number of removed changes to the reader's pools at once.
+     *
+     * @param changes      Array with the pointers to the changes to release.
+     * @param num_changes  Number of changes to release.
+     */
+    FASTDDS_EXPORTED_API void do_release_caches(
+            CacheChange_t* const* changes,
+            size_t num_changes);
+
     template<typename Pred>
     inline void remove_changes_with_pred(
             Pred pred)
@@ -244,18 +254,25 @@ protected:
         assert(nullptr != mp_mutex);
 
         std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+        std::vector<CacheChange_t*> removed_changes;
         std::vector<CacheChange_t*>::iterator chit = m_changes.begin();
         while (chit != m_changes.end())
         {
             if (pred(*chit))
             {
-                chit = remove_change_nts(chit);
+                removed_changes.push_back(*chit);
+                chit = remove_change_nts(chit, false);
             }
             else
             {
                 ++chit;
             }
         }
+
+        if (!removed_changes.empty())
+        {
+            do_release_caches(removed_changes.data(), removed_changes.size());
+        }
     }
 
     //!Pointer to the reader
@@ -40,6 +40,7 @@
 #include <rtps/builtin/discovery/participant/PDP.h>
 #include <rtps/participant/RTPSParticipantImpl.hpp>
 #include <rtps/reader/StatefulReader.hpp>
+#include <rtps/resources/TimedEvent.h>
 #include <rtps/RTPSDomainImpl.hpp>
 #include <rtps/writer/StatefulWriter.hpp>
 
@@ -76,6 +77,8 @@ TypeLookupManager::TypeLookupManager()
 
 TypeLookupManager::~TypeLookupManager()
 {
+    delete pending_type_requests_event_;
+
     if (nullptr != builtin_reply_reader_)
     {
         participant_->deleteUserEndpoint(builtin_reply_reader_->getGuid());
@@ -141,6 +144,14 @@ bool TypeLookupManager::init(
 
     type_propagation_ = participant_->type_propagation();
 
+    pending_type_requests_event_ = new TimedEvent(participant_->getEventResource(),
+                    [this]() -> bool
+                    {
+                        send_pending_type_requests();
+                        return false;
+                    },
+                    type_requests_batching_period_ms);
+
     // Check if ReaderProxyData and WriterProxyData objects were created successfully
     if (temp_reader_proxy_data_ && temp_writer_proxy_data_)
     {
@@ -378,10 +389,21 @@ ReturnCode_t TypeLookupManager::check_type_identifier_received(
             TK_NONE ?
             temp_proxy_data->type_information.type_information.complete().typeid_with_size() :
             temp_proxy_data->type_information.type_information.minimal().typeid_with_size();
+    xtypes::TypeObjectRegistry& type_object_registry =
+            fastdds::rtps::RTPSDomainImpl::get_instance()->type_object_registry_observer();
+
+    // The minimal TypeObject of a remote complete type is only built when it is looked up by its minimal
+    // TypeIdentifier, so keep the announced pair.
+    if (temp_proxy_data->type_information.type_information.minimal().typeid_with_size().type_id()._d() != TK_NONE &&
+            type_identifier_with_size.type_id()._d() == xtypes::EK_COMPLETE)
+    {
+        type_object_registry.register_pending_minimal_type_identifier(
+            temp_proxy_data->type_information.type_information.minimal().typeid_with_size().type_id(),
+            type_identifier_with_size.type_id());
+    }
 
     // Check if the type is known
-    if (fastdds::rtps::RTPSDomainImpl::get_instance()->type_object_registry_observer().
-                    is_type_identifier_known(type_identifier_with_size))
+    if (type_object_registry.is_type_identifier_known(type_identifier_with_size))
     {
         // The type is already known, invoke the callback
         callback(RETCODE_OK, temp_proxy_data.get());
@@ -389,43 +411,121 @@ ReturnCode_t TypeLookupManager::check_type_identifier_received(
     }
 
     {
+        // Make a copy of the proxy to free the EDP pool
+        ProxyType* temp_proxy_data_copy(new ProxyType(*temp_proxy_data));
+
         // Check if TypeIdentfierWithSize already exists in the map
         std::lock_guard<std::mutex> lock(async_get_types_mutex_);
         auto it = async_get_type_callbacks.find(type_identifier_with_size);
         if (it != async_get_type_callbacks.end())
         {
             // TypeIdentfierWithSize exists, add the callback
-            // Make a copy of the proxy to free the EDP pool
-            ProxyType* temp_proxy_data_copy(new ProxyType(*temp_proxy_data));
             it->second.push_back(std::make_pair(temp_proxy_data_copy, callback));
             // Return without sending new request
             return RETCODE_NO_DATA;
         }
-    }
 
-    // TypeIdentfierWithSize doesn't exist, create a new entry
-    SampleIdentity get_type_dependencies_request = get_type_dependencies(
-        {type_identifier_with_size.type_id()}, type_server);
-    if (INVALID_SAMPLE_IDENTITY != get_type_dependencies_request)
-    {
-        // Store the sent requests and callback
-        add_async_get_type_request(get_type_dependencies_request, type_identifier_with_size);
+        // TypeIdentfierWithSize doesn't exist, create a new entry
+        bool already_requested =
+                async_get_type_writer_callbacks_.end() !=
+                async_get_type_writer_callbacks_.find(type_identifier_with_size) ||
+                async_get_type_reader_callbacks_.end() !=
+                async_get_type_reader_callbacks_.find(type_identifier_with_size);
         std::vector<std::pair<ProxyType*, AsyncCallback>> types;
-        // Make a copy of the proxy to free the EDP pool
-        ProxyType* temp_proxy_data_copy(new ProxyType(*temp_proxy_data));
         types.push_back(std::make_pair(temp_proxy_data_copy, callback));
         async_get_type_callbacks.emplace(type_identifier_with_size, std::move(types));
 
-        return RETCODE_NO_DATA;
+        if (already_requested)
+        {
+            // Endpoints of the other kind are already waiting for the type, which is notified to both
+            return RETCODE_NO_DATA;
+        }
+    }
+
+    add_pending_type_request(type_server, type_identifier_with_size);
+    return RETCODE_NO_DATA;
+}
+
+void TypeLookupManager::add_pending_type_request(
+        const fastdds::rtps::GUID_t& type_server,
+        const xtypes::TypeIdentfierWithSize& type_identifier_with_size)
+{
+    std::vector<xtypes::TypeIdentfierWithSize> type_ids;
+    {
+        std::lock_guard<std::mutex> lock(async_get_types_mutex_);
+        auto& pending_types = pending_type_requests_[type_server];
+        pending_types.push_back(type_identifier_with_size);
+        if (max_types_per_request <= pending_types.size())
+        {
+            // The batch is full, so it is sent without waiting for the period to expire
+            type_ids.swap(pending_types);
+            pending_type_requests_.erase(type_server);
+        }
     }
-    else
+
+    if (!type_ids.empty() && !send_type_dependencies_request(type_server, type_ids))
+    {
+        // The callbacks are not notified from the discovery thread, the event notifies them
+        std::lock_guard<std::mutex> lock(async_get_types_mutex_);
+        failed_type_requests_.insert(failed_type_requests_.end(), type_ids.begin(), type_ids.end());
+        type_ids.clear();
+    }
+
+    if (type_ids.empty())
+    {
+        pending_type_requests_event_->restart_timer();
+    }
+}
+
+void TypeLookupManager::send_pending_type_requests()
+{
+    std::map<fastdds::rtps::GUID_t, std::vector<xtypes::TypeIdentfierWithSize>> pending_type_requests;
+    std::vector<xtypes::TypeIdentfierWithSize> failed_type_requests;
+    {
+        std::lock_guard<std::mutex> lock(async_get_types_mutex_);
+        pending_type_requests.swap(pending_type_requests_);
+        failed_type_requests.swap(failed_type_requests_);
+    }
+
+    for (const auto& server_types : pending_type_requests)
+    {
+        if (!send_type_dependencies_request(server_types.first, server_types.second))
+        {
+            failed_type_requests.insert(failed_type_requests.end(), server_types.second.begin(),
+                    server_types.second.end());
+        }
+    }
+
+    // The endpoints of the types that could not be requested continue without TypeInformation
+    for (const xtypes::TypeIdentfierWithSize& type_id : failed_type_requests)
     {
-        // Failed to send request, return error
-        EPROSIMA_LOG_ERROR(TYPELOOKUP_SERVICE, "Failed to send get_type_dependencies request");
-        return RETCODE_ERROR;
+        notify_callbacks(RETCODE_NO_DATA, type_id);
     }
 }
 
+bool TypeLookupManager::send_type_dependencies_request(
+        const fastdds::rtps::GUID_t& type_server,
+        const std::vector<xtypes::TypeIdentfierWithSize>& type_ids)
+{
+    xtypes::TypeIdentifierSeq id_seq;
+    id_seq.reserve(type_ids.size());
+    for (const xtypes::TypeIdentfierWithSize& type_id : type_ids)
+    {
+        id_seq.push_back(type_id.type_id());
+    }
+
+    SampleIdentity get_type_dependencies_request = get_type_dependencies(id_seq, type_server);
+    if (INVALID_SAMPLE_IDENTITY != get_type_dependencies_request)
+    {
+        // Store the sent request and the batch of types it is resolving
+        add_async_get_type_request(get_type_dependencies_request, type_ids);
+        return true;
+    }
+
+    EPROSIMA_LOG_ERROR(TYPELOOKUP_SERVICE, "Failed to send get_type_dependencies request");
+    return false;
+}
+
 void TypeLookupManager::notify_callbacks(
         ReturnCode_t request_ret_status,
         const xtypes::TypeIdentfierWithSize& type_identifier_with_size)
@@ -461,12 +561,12 @@ void TypeLookupManager::notify_callbacks(
 
 bool TypeLookupManager::add_async_get_type_request(
         const SampleIdentity& request,
-        const xtypes::TypeIdentfierWithSize& type_identifier_with_size)
+        const std::vector<xtypes::TypeIdentfierWithSize>& type_ids)
 {
     std::lock_guard<std::mutex> lock(async_get_types_mutex_);
     try
     {
-        async_get_type_requests_.emplace(request, type_identifier_with_size);
+        async_get_type_requests_.emplace(request, type_ids);
         return true;
     }
     catch (const std::exception& e)
@@ -21,6 +21,7 @@
 #define FASTDDS_FASTDDS_BUILTIN_TYPE_LOOKUP_SERVICE__TYPELOOKUPMANAGER_HPP
 
 #include <cstdint>
+#include <map>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -95,6 +96,7 @@ class RTPSParticipantImpl;
 class StatefulReader;
 class StatefulWriter;
 class ParticipantProxyData;
+class TimedEvent;
 class WriterHistory;
 
 } // namespace rtps
@@ -184,7 +186,7 @@ public:
      * @param callback Callback called when the negotiation is complete.
      * @return ReturnCode_t RETCODE_OK if the type is already known.
      *                      RETCODE_NO_DATA if type is not known, and a negotiation has been started.
-     *                      RETCODE_ERROR if any request was not sent correctly.
+     *                      If the request cannot be sent, the callback is called with RETCODE_NO_DATA.
      */
     ReturnCode_t async_get_type(
             eprosima::ProxyPool<eprosima::fastdds::rtps::WriterProxyData>::smart_ptr& temp_proxy_data,
@@ -206,14 +208,15 @@ protected:
      * Checks if the given TypeIdentfierWithSize is known by the TypeObjectRegistry.
      * Uses get_type_dependencies() and get_types() to get those that are not known.
      * Adds a callback to the async_get_type_callbacks_ entry of the TypeIdentfierWithSize, or creates a new one if
-     * TypeIdentfierWithSize was not in the map before
+     * TypeIdentfierWithSize was not in the map before.
+     * New TypeIdentfierWithSize are not requested right away, but added to the pending requests of the type_server,
+     * which are sent together when the batching period expires.
      * @param temp_proxy_data[in] Temporary Writer/Reader ProxyData that originated the request.
      * @param type_server[in] GUID of the remote participant that has the type.
      * @param callback[in] Callback to add.
      * @param async_get_type_callbacks[in] The collection ProxyData and their callbacks to use.
      * @return ReturnCode_t RETCODE_OK if type is known.
      *                      RETCODE_NO_DATA if the type is being discovered.
-     *                      RETCODE_ERROR if the request was not sent or the callback was not added correctly.
      */
     template <typename ProxyType, typename AsyncCallback>
     ReturnCode_t check_type_identifier_received(
@@ -224,6 +227,33 @@ protected:
             std::vector<std::pair<ProxyType*,
             AsyncCallback>>>& async_get_type_callbacks);
 
+    /**
+     * Adds a TypeIdentfierWithSize to the pending requests of a remote participant.
+     * The pending requests are sent right away when there are max_types_per_request of them, or when the
+     * batching period expires otherwise.
+     * @param type_server[in] GUID of the remote participant that has the type.
+     * @param type_identifier_with_size[in] TypeIdentfierWithSize to be requested.
+     */
+    void add_pending_type_request(
+            const fastdds::rtps::GUID_t& type_server,
+            const xtypes::TypeIdentfierWithSize& type_identifier_with_size);
+
+    /**
+     * Sends a single get_type_dependencies request for all the pending TypeIdentfierWithSize of each remote
+     * participant, and notifies with RETCODE_NO_DATA the callbacks of the batches that could not be sent.
+     */
+    void send_pending_type_requests();
+
+    /**
+     * Sends a get_type_dependencies request for a batch of TypeIdentfierWithSize.
+     * @param type_server[in] GUID of the remote participant that has the types.
+     * @param type_ids[in] Batch of TypeIdentfierWithSize to be requested.
+     * @return true if the request was sent. false otherwise, and the caller must notify the callbacks of the batch.
+     */
+    bool send_type_dependencies_request(
+            const fastdds::rtps::GUID_t& type_server,
+            const std::vector<xtypes::TypeIdentfierWithSize>& type_ids);
+
     /**
      *  Notifies callbacks for a given TypeIdentfierWithSize.
      * @param type_identifier_with_size[in] TypeIdentfierWithSize of the callbacks to notify.
@@ -233,15 +263,14 @@ protected:
             const xtypes::TypeIdentfierWithSize& type_identifier_with_size);
 
     /**
-     * Adds a callback to the async_get_type_callbacks_ entry of the TypeIdentfierWithSize, or creates a new one if
-     * TypeIdentfierWithSize was not in the map before.
+     * Stores the TypeIdentfierWithSize that originated a request.
      * @param request[in] SampleIdentity of the request.
-     * @param type_identifier_with_size[in] TypeIdentfierWithSize that originated the request.
+     * @param type_ids[in] Batch of TypeIdentfierWithSize that originated the request.
      * @return true if added. false otherwise.
      */
     bool add_async_get_type_request(
             const SampleIdentity& request,
-            const xtypes::TypeIdentfierWithSize& type_identifier_with_size );
+            const std::vector<xtypes::TypeIdentfierWithSize>& type_ids);
 
     /**
      * Removes a TypeIdentfierWithSize from the async_get_type_callbacks_.
@@ -432,7 +461,8 @@ protected:
     mutable TypeLookup_RequestPubSubType request_type_;
     mutable TypeLookup_ReplyPubSubType reply_type_;
 
-    //! Mutex to protect access to async_get_type_callbacks_ and async_get_type_requests_.
+    //! Mutex to protect access to async_get_type_callbacks_, async_get_type_requests_, pending_type_requests_ and
+    //! failed_type_requests_.
     std::mutex async_get_types_mutex_;
 
     //! Collection of all the WriterProxyData and their callbacks related to a TypeIdentfierWithSize, hashed by its TypeIdentfierWithSize.
@@ -446,11 +476,26 @@ protected:
             AsyncGetTypeReaderCallback>>> async_get_type_reader_callbacks_;
 
     //! Collection of all SampleIdentity and the TypeIdentfierWithSize it originated from, hashed by its SampleIdentity.
-    std::unordered_map<SampleIdentity, xtypes::TypeIdentfierWithSize> async_get_type_requests_;
+    std::unordered_map<SampleIdentity, std::vector<xtypes::TypeIdentfierWithSize>> async_get_type_requests_;
+
+    //! TypeIdentfierWithSize waiting to be requested, grouped by the remote participant that has them.
+    std::map<fastdds::rtps::GUID_t, std::vector<xtypes::TypeIdentfierWithSize>> pending_type_requests_;
+
+    //! TypeIdentfierWithSize whose request could not be sent, waiting to be notified from the event thread.
+    std::vector<xtypes::TypeIdentfierWithSize> failed_type_requests_;
+
+    //! Event that sends the pending requests when the batching period expires.
+    fastdds::rtps::TimedEvent* pending_type_requests_event_ = nullptr;
 
     //! Max size of TypeLookup messages.
     static constexpr uint32_t typelookup_data_max_size = 5000;
 
+    //! Time, in milliseconds, unknown types are gathered before requesting them.
+    static constexpr double type_requests_batching_period_ms = 10.0;
+
+    //! Max number of TypeIdentfierWithSize in a single get_type_dependencies request.
+    static constexpr size_t max_types_per_request = 64;
+
     //! TypePropagation policy
     utils::TypePropagation type_propagation_;
 };
@@ -106,7 +106,7 @@ void TypeLookupReplyListener::process_reply()
             auto request_it = typelookup_manager_->async_get_type_requests_.find(request_id);
             if (request_it != typelookup_manager_->async_get_type_requests_.end())
             {
-                xtypes::TypeIdentfierWithSize type_id {request_it->second};
+                std::vector<xtypes::TypeIdentfierWithSize> type_ids {request_it->second};
                 // Process the TypeLookup_Reply based on its type
                 switch (reply.return_value()._d())
                 {
@@ -114,13 +114,12 @@ void TypeLookupReplyListener::process_reply()
                     {
                         if (RETCODE_OK == reply.return_value().getType()._d())
                         {
-                            check_get_types_reply(request_id, type_id,
+                            check_get_types_reply(request_id, type_ids,
                                     reply.return_value().getType().result(), reply.header().relatedRequestId());
                         }
                         else
                         {
-                            typelookup_manager_->notify_callbacks(RETCODE_NO_DATA, type_id);
-                            typelookup_manager_->remove_async_get_type_request(request_id);
+                            check_exception_reply(request_id, type_ids, replies_queue_.front().type_server);
                         }
                         break;
                     }
@@ -129,13 +128,12 @@ void TypeLookupReplyListener::process_reply()
                         if (RETCODE_OK == reply.return_value().getTypeDependencies()._d())
                         {
                             check_get_type_dependencies_reply(
-                                request_id, type_id, replies_queue_.front().type_server,
+                                request_id, type_ids, replies_queue_.front().type_server,
                                 reply.return_value().getTypeDependencies().result());
                         }
                         else
                         {
-                            typelookup_manager_->notify_callbacks(RETCODE_NO_DATA, type_id);
-                            typelookup_manager_->remove_async_get_type_request(request_id);
+                            check_exception_reply(request_id, type_ids, replies_queue_.front().type_server);
                         }
                         break;
                     }
@@ -154,31 +152,35 @@ void TypeLookupReplyListener::process_reply()
 
 void TypeLookupReplyListener::check_get_types_reply(
         const SampleIdentity& request_id,
-        const xtypes::TypeIdentfierWithSize& type_id,
+        const std::vector<xtypes::TypeIdentfierWithSize>& type_ids,
         const TypeLookup_getTypes_Out& reply,
         SampleIdentity related_request)
 {
-    ReturnCode_t register_result = RETCODE_OK;
-
     if (0 != reply.types().size())
     {
-        for (xtypes::TypeIdentifierTypeObjectPair pair : reply.types())
+        // Register all the received types at once
+        std::vector<bool> registered;
+        if (RETCODE_OK != fastdds::rtps::RTPSDomainImpl::get_instance()->type_object_registry_observer().
+                        register_type_objects(reply.types(), registered))
+        {
+            // If any of the types is not registered, log error
+            EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE_REPLY_LISTENER,
+                    "Error registering remote type.");
+        }
+
+        // Types of the reply that could not be registered
+        std::unordered_set<xtypes::TypeIdentifier> rejected_types;
+        for (size_t i = 0; i < registered.size(); ++i)
         {
-            xtypes::TypeIdentifierPair type_ids;
-            type_ids.type_identifier1(pair.type_identifier());
-            if (RETCODE_OK != fastdds::rtps::RTPSDomainImpl::get_instance()->type_object_registry_observer().
-                            register_type_object(pair.type_object(), type_ids, false))
+            if (!registered[i])
             {
-                // If any of the types is not registered, log error
-                EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE_REPLY_LISTENER,
-                        "Error registering remote type.");
-                register_result = RETCODE_ERROR;
+                rejected_types.insert(reply.types()[i].type_identifier());
             }
         }
 
-        if (RETCODE_OK == register_result)
+        // Check if the get_type_dependencies related to this reply required a continuation_point
+        bool has_continuation = false;
         {
-            // Check if the get_type_dependencies related to this reply required a continuation_point
             std::unique_lock<std::mutex> guard(replies_with_continuation_mutex_);
             auto it = std::find(replies_with_continuation_.begin(),
                             replies_with_continuation_.end(), related_request);
@@ -186,42 +188,52 @@ void TypeLookupReplyListener::check_get_types_reply(
             {
                 // If it did, remove it from the list and continue
                 replies_with_continuation_.erase(it);
+                has_continuation = true;
             }
-            else
+        }
+
+        if (!has_continuation)
+        {
+            // If it did not, check that each type that originated the request is registered and consistent
+            // before notifying the callbacks associated with it
+            for (const xtypes::TypeIdentfierWithSize& type_id : type_ids)
             {
-                // If it did not, check that the type that originated the request is consistent
-                // before notifying the callbacks associated with the request
-                try
+                ReturnCode_t type_result = RETCODE_NO_DATA;
+                if (rejected_types.end() == rejected_types.find(type_id.type_id()))
                 {
-                    xtypes::TypeObject type_object;
-                    fastdds::rtps::RTPSDomainImpl::get_instance()->type_object_registry_observer().get_type_object(
-                        type_id.type_id(), type_object);
-                    xtypes::TypeObjectUtils::type_object_consistency(type_object);
-                    xtypes::TypeIdentifierPair type_ids;
-                    if (RETCODE_OK !=
-                            fastdds::rtps::RTPSDomainImpl::get_instance()->type_object_registry_observer().
-                                    register_type_object(type_object, type_ids, true))
+                    try
                     {
-                        EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE_REPLY_LISTENER,
-                                "Cannot register minimal of remote type");
+                        xtypes::TypeObject type_object;
+                        ReturnCode_t get_result = fastdds::rtps::RTPSDomainImpl::get_instance()->
+                                        type_object_registry_observer().get_type_object(type_id.type_id(),
+                                        type_object);
+                        if (RETCODE_OK == get_result)
+                        {
+                            xtypes::TypeObjectUtils::type_object_consistency(type_object);
+                            // The minimal TypeObject of a complete remote type is not built here. The registry builds
+                            // it the first time its TypeIdentifier is required.
+                            type_result = RETCODE_OK;
+                        }
+                    }
+                    catch (const std::exception& exception)
+                    {
+                        EPROSIMA_LOG_ERROR(TYPELOOKUP_SERVICE_REPLY_LISTENER,
+                                "Error registering remote type: " << exception.what());
                     }
-
-                    typelookup_manager_->notify_callbacks(RETCODE_OK, type_id);
-                }
-                catch (const std::exception& exception)
-                {
-                    EPROSIMA_LOG_ERROR(TYPELOOKUP_SERVICE_REPLY_LISTENER,
-                            "Error registering remote type: " << exception.what());
                 }
+
+                typelookup_manager_->notify_callbacks(type_result, type_id);
             }
         }
     }
     else
     {
-        typelookup_manager_->notify_callbacks(RETCODE_NO_DATA, type_id);
+        for (const xtypes::TypeIdentfierWithSize& type_id : type_ids)
+        {
+            typelookup_manager_->notify_callbacks(RETCODE_NO_DATA, type_id);
+        }
         EPROSIMA_LOG_WARNING(TYPELOOKUP_SERVICE_REPLY_LISTENER,
                 "Received reply with no types.");
-        register_result = RETCODE_ERROR;
     }
 
     // Remove the processed SampleIdentity from the outstanding requests
@@ -230,7 +242,7 @@ void TypeLookupReplyListener::check_get_types_reply(
 
 void TypeLookupReplyListener::check_get_type_dependencies_reply(
         const SampleIdentity& request_id,
-        const xtypes::TypeIdentfierWithSize& type_id,
+        const std::vector<xtypes::TypeIdentfierWithSize>& type_ids,
         const fastdds::rtps::GUID_t type_server,
         const TypeLookup_getTypeDependencies_Out& reply)
 {
@@ -254,21 +266,34 @@ void TypeLookupReplyListener::check_get_type_dependencies_reply(
         }
     }
 
-    // If there is no continuation point, add the parent type
+    // If there is no continuation point, add the parent types
     if (reply.continuation_point().empty())
     {
-        needed_types.push_back(type_id.type_id());
+        for (const xtypes::TypeIdentfierWithSize& type_id : type_ids)
+        {
+            if (unique_types.insert(type_id.type_id()).second)
+            {
+                needed_types.push_back(type_id.type_id());
+            }
+        }
     }
     // Make a new request with the continuation point
     else
     {
+        // The request must have the same TypeIdentifiers, in the same order, as the original one
+        xtypes::TypeIdentifierSeq id_seq;
+        id_seq.reserve(type_ids.size());
+        for (const xtypes::TypeIdentfierWithSize& type_id : type_ids)
+        {
+            id_seq.push_back(type_id.type_id());
+        }
         SampleIdentity next_request_id = typelookup_manager_->
-                        get_type_dependencies({type_id.type_id()}, type_server,
+                        get_type_dependencies(id_seq, type_server,
                         reply.continuation_point());
         if (INVALID_SAMPLE_IDENTITY != next_request_id)
         {
             // Store the sent requests and associated TypeIdentfierWithSize
-            typelookup_manager_->add_async_get_type_request(next_request_id, type_id);
+            typelookup_manager_->add_async_get_type_request(next_request_id, type_ids);
         }
         else
         {
@@ -283,7 +308,7 @@ void TypeLookupReplyListener::check_get_type_dependencies_reply(
     if (INVALID_SAMPLE_IDENTITY != get_types_request)
     {
         // Store the type request
-        typelookup_manager_->add_async_get_type_request(get_types_request, type_id);
+        typelookup_manager_->add_async_get_type_request(get_types_request, type_ids);
 
         // If this get_types request has a continuation_point, store it in the list
         if (!reply.continuation_point().empty())
@@ -302,6 +327,34 @@ void TypeLookupReplyListener::check_get_type_dependencies_reply(
     typelookup_manager_->remove_async_get_type_request(request_id);
 }
 
+void TypeLookupReplyListener::check_exception_reply(
+        const SampleIdentity& request_id,
+        const std::vector<xtypes::TypeIdentfierWithSize>& type_ids,
+        const fastdds::rtps::GUID_t type_server)
+{
+    // Remove the processed SampleIdentity from the outstanding requests
+    typelookup_manager_->remove_async_get_type_request(request_id);
+
+    if (1 < type_ids.size())
+    {
+        // Only the unknown types of the batch must fail
+        for (const xtypes::TypeIdentfierWithSize& type_id : type_ids)
+        {
+            if (!typelookup_manager_->send_type_dependencies_request(type_server, {type_id}))
+            {
+                typelookup_manager_->notify_callbacks(RETCODE_NO_DATA, type_id);
+            }
+        }
+    }
+    else
+    {
+        for (const xtypes::TypeIdentfierWithSize& type_id : type_ids)
+        {
+            typelookup_manager_->notify_callbacks(RETCODE_NO_DATA, type_id);
+        }
+    }
+}
+
 void TypeLookupReplyListener::on_new_cache_change_added(
         RTPSReader* reader,
         const CacheChange_t* const change_in)
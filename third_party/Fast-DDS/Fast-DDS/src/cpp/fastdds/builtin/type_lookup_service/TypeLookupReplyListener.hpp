@@ -25,6 +25,7 @@
 #include <queue>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <fastdds/builtin/type_lookup_service/detail/TypeLookupTypes.hpp>
 #include <fastdds/dds/xtypes/type_representation/TypeObjectUtils.hpp>
@@ -92,15 +93,16 @@ protected:
     void process_reply();
 
     /**
-     * @brief Registers TypeIdentifier and TypeObject in TypeObjectRegistry.
+     * @brief Registers all the received TypeIdentifiers and TypeObjects in TypeObjectRegistry at once.
      * This method also notifies all type related callbacks and removes the current SampleIdentity from the pending request list.
      * @param request_id[in] The SampleIdentity of the request.
+     * @param type_ids[in] The batch of TypeIdentfierWithSize that originated the request.
      * @param reply[in] The reply data.
      * @param related_request[in] The request that this reply answers.
      */
     void check_get_types_reply(
             const SampleIdentity& request_id,
-            const xtypes::TypeIdentfierWithSize& type_id,
+            const std::vector<xtypes::TypeIdentfierWithSize>& type_ids,
             const TypeLookup_getTypes_Out& reply,
             SampleIdentity related_request);
 
@@ -110,15 +112,30 @@ protected:
      * If they are, sends get_types request and adds it to the list.
      * Also removes the current SampleIdentity from the list.
      * @param request_id[in] The SampleIdentity of the request.
+     * @param type_ids[in] The batch of TypeIdentfierWithSize that originated the request.
      * @param type_server[in] GUID corresponding to the remote participant which TypeInformation is being solved.
      * @param reply[in] The reply data.
      */
     void check_get_type_dependencies_reply(
             const SampleIdentity& request_id,
-            const xtypes::TypeIdentfierWithSize& type_id,
+            const std::vector<xtypes::TypeIdentfierWithSize>& type_ids,
             const fastdds::rtps::GUID_t type_server,
             const TypeLookup_getTypeDependencies_Out& reply);
 
+    /**
+     * @brief Handles a reply with an exception.
+     * The remote participant fails the whole request when it does not know one of its types, so each type of a batch
+     * is requested again on its own. The callbacks of a single type are notified with RETCODE_NO_DATA.
+     * Also removes the current SampleIdentity from the list.
+     * @param request_id[in] The SampleIdentity of the request.
+     * @param type_ids[in] The batch of TypeIdentfierWithSize that originated the request.
+     * @param type_server[in] GUID corresponding to the remote participant which TypeInformation is being solved.
+     */
+    void check_exception_reply(
+            const SampleIdentity& request_id,
+            const std::vector<xtypes::TypeIdentfierWithSize>& type_ids,
+            const fastdds::rtps::GUID_t type_server);
+
     /**
      * @brief Method called when this class is notified of a new cache change.
      * @param reader The reader receiving the cache change.
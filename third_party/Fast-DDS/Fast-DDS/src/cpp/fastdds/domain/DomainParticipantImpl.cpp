@@ -2545,6 +2545,8 @@ bool DomainParticipantImpl::can_qos_be_updated(
                 from.wire_protocol().builtin.discovery_config.leaseDuration_announcementperiod) ||
                 !(to.wire_protocol().builtin.discovery_config.initial_announcements ==
                 from.wire_protocol().builtin.discovery_config.initial_announcements) ||
+                !(to.wire_protocol().builtin.discovery_config.full_announcement_period ==
+                from.wire_protocol().builtin.discovery_config.full_announcement_period) ||
                 !(to.wire_protocol().builtin.discovery_config.m_simpleEDP ==
                 from.wire_protocol().builtin.discovery_config.m_simpleEDP) ||
                 !(strcmp(to.wire_protocol().builtin.discovery_config.static_edp_xml_config(),
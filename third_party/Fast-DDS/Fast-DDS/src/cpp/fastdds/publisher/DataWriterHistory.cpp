@@ -306,7 +306,7 @@ bool DataWriterHistory::find_or_add_key(
 
     if (static_cast<int>(keyed_changes_.size()) < resource_limited_qos_.max_instances)
     {
-        vit = keyed_changes_.insert(std::make_pair(instance_handle, detail::DataWriterInstance())).first;
+        vit = keyed_changes_.emplace(instance_handle).first;
         vit->second.key_payload.copy(&payload, false);
         *vit_out = vit;
         return true;
@@ -498,12 +498,13 @@ bool DataWriterHistory::set_next_deadline(
     }
     else if (topic_kind_ == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        t_m_Inst_Caches::iterator vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        vit->second.next_deadline_us = next_deadline_us;
         return true;
     }
 
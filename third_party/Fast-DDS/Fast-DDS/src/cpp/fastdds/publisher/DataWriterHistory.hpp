@@ -31,6 +31,8 @@
 #include <fastdds/rtps/history/WriterHistory.hpp>
 
 #include <fastdds/publisher/history/DataWriterInstance.hpp>
+#include <rtps/common/InstanceHandleHash.hpp>
+#include <utils/collections/HashIndexedMap.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -254,7 +256,8 @@ public:
 
 private:
 
-    typedef std::map<rtps::InstanceHandle_t, detail::DataWriterInstance> t_m_Inst_Caches;
+    typedef HashIndexedMap<rtps::InstanceHandle_t, detail::DataWriterInstance, rtps::InstanceHandleHash>
+            t_m_Inst_Caches;
 
     //!Map where keys are instance handles and values are vectors of cache changes associated
     t_m_Inst_Caches keyed_changes_;
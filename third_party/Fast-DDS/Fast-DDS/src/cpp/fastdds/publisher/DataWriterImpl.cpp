@@ -315,6 +315,24 @@ ReturnCode_t DataWriterImpl::enable()
         w_att.endpoint.properties.properties().push_back(std::move(property));
     }
 
+    // Relative deadline used by flow controllers with EARLIEST_DEADLINE_FIRST scheduler, unless given by the user.
+    if (uses_earliest_deadline_first_flow_controller() &&
+            nullptr == PropertyPolicyHelper::find_property(qos_.properties(), "fastdds.sfc.deadline_us"))
+    {
+        const dds::Duration_t& budget = qos_.latency_budget().duration;
+        const dds::Duration_t& deadline = qos_.deadline().period;
+        const dds::Duration_t* relative_deadline =
+                (dds::c_TimeZero != budget && dds::c_TimeInfinite != budget) ? &budget :
+                (dds::c_TimeInfinite != deadline ? &deadline : nullptr);
+
+        if (nullptr != relative_deadline)
+        {
+            property.name("fastdds.sfc.deadline_us");
+            property.value(std::to_string(relative_deadline->to_ns() / 1000));
+            w_att.endpoint.properties.properties().push_back(std::move(property));
+        }
+    }
+
     if (qos_.reliable_writer_qos().disable_positive_acks.enabled &&
             qos_.reliable_writer_qos().disable_positive_acks.duration != dds::c_TimeInfinite)
     {
@@ -1505,6 +1523,19 @@ ReturnCode_t DataWriterImpl::get_publication_matched_status(
     return RETCODE_OK;
 }
 
+bool DataWriterImpl::uses_earliest_deadline_first_flow_controller() const
+{
+    const std::string& flow_controller_name = qos_.publish_mode().flow_controller_name;
+    for (const auto& descriptor : publisher_->rtps_participant()->get_attributes().flow_controllers)
+    {
+        if (descriptor && flow_controller_name == descriptor->name)
+        {
+            return fastdds::rtps::FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST == descriptor->scheduler;
+        }
+    }
+    return false;
+}
+
 bool DataWriterImpl::deadline_timer_reschedule()
 {
     assert(qos_.deadline().period != dds::c_TimeInfinite);
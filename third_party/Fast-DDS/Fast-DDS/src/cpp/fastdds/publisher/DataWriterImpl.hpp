@@ -612,6 +612,11 @@ protected:
      */
     bool lifespan_expired();
 
+    /**
+     * @brief Check whether the flow controller of the writer uses the EARLIEST_DEADLINE_FIRST scheduler
+     */
+    bool uses_earliest_deadline_first_flow_controller() const;
+
     ReturnCode_t check_new_change_preconditions(
             fastdds::rtps::ChangeKind_t change_kind,
             const void* const data);
@@ -51,6 +51,7 @@
 #include <fastdds/utils/TypePropagation.hpp>
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 #include <rtps/participant/RTPSParticipantImpl.hpp>
+#include <rtps/reader/BaseReader.hpp>
 #include <rtps/resources/TimedEvent.h>
 #include <rtps/resources/ResourceEvent.h>
 #include <rtps/RTPSDomainImpl.hpp>
@@ -254,6 +255,12 @@ ReturnCode_t DataReaderImpl::enable()
         return RETCODE_ERROR;
     }
 
+    // Any listener of the reader, its subscriber or its participant may be called when receiving a sample
+    BaseReader::downcast(reader)->set_user_listener_check([this]()
+            {
+                return nullptr != get_listener_for(StatusMask::none());
+            });
+
     auto content_topic = dynamic_cast<ContentFilteredTopicImpl*>(topic_->get_impl());
     if (nullptr != content_topic)
     {
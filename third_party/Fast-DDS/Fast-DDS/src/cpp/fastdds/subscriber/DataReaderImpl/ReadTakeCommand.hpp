@@ -89,6 +89,8 @@ struct ReadTakeCommand
 
     ~ReadTakeCommand()
     {
+        history_.release_deferred_changes_nts();
+
         if (!data_values_.has_ownership() && RETCODE_NO_DATA == return_value_)
         {
             loan_manager_.return_loan(data_values_, sample_infos_);
@@ -133,7 +135,7 @@ struct ReadTakeCommand
                 if (remove_change)
                 {
                     // Remove from history
-                    history_.remove_change_sub(change, it);
+                    history_.remove_change_sub(change, it, true);
 
                     // Current iterator will point to change next to the one removed. Avoid incrementing.
                     continue;
@@ -168,7 +170,7 @@ struct ReadTakeCommand
                     if (remove_change || (added && take_samples))
                     {
                         // Remove from history
-                        history_.remove_change_sub(change, it);
+                        history_.remove_change_sub(change, it, true);
 
                         // Current iterator will point to change next to the one removed. Avoid incrementing.
                         continue;
@@ -304,7 +306,13 @@ private:
         // Check instance_state against states_.instance_states and view_state against states_.view_states
         auto instance_state = instance_->second->instance_state;
         auto view_state = instance_->second->view_state;
-        return (0 != (states_.instance_states & instance_state)) && (0 != (states_.view_states & view_state));
+        if ((0 == (states_.instance_states & instance_state)) || (0 == (states_.view_states & view_state)))
+        {
+            return false;
+        }
+
+        // Skip instances without unread samples when only unread samples are requested
+        return (0 != (states_.sample_states & READ_SAMPLE_STATE)) || (0 < instance_->second->unread_samples);
     }
 
     bool next_instance()
@@ -16,6 +16,7 @@
  * @file DataReaderHistory.cpp
  */
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -335,6 +336,10 @@ void DataReaderHistory::add_to_instance(
     // ADD TO KEY VECTOR
     DataReaderCacheChange item = a_change;
     eprosima::utilities::collections::sorted_vector_insert(instance.cache_changes, item, rtps::history_order_cmp);
+    if (!a_change->isRead)
+    {
+        ++instance.unread_samples;
+    }
     data_available_instances_[a_change->instanceHandle] = instances_[a_change->instanceHandle];
 
     EPROSIMA_LOG_INFO(SUBSCRIBER, mp_reader->getGuid().entityId
@@ -447,6 +452,10 @@ bool DataReaderHistory::remove_change_sub(
                 {
                     --counters_.samples_read;
                 }
+                else
+                {
+                    sample_unread_removed(*vit->second);
+                }
                 break;
             }
         }
@@ -468,7 +477,8 @@ bool DataReaderHistory::remove_change_sub(
 
 bool DataReaderHistory::remove_change_sub(
         CacheChange_t* change,
-        DataReaderInstance::ChangeCollection::iterator& it)
+        DataReaderInstance::ChangeCollection::iterator& it,
+        bool defer_release)
 {
     if (mp_reader == nullptr || mp_mutex == nullptr)
     {
@@ -491,7 +501,11 @@ bool DataReaderHistory::remove_change_sub(
         return false;
     }
 
-    auto new_it = ReaderHistory::remove_change_nts(chit);
+    auto new_it = ReaderHistory::remove_change_nts(chit, !defer_release);
+    if (defer_release)
+    {
+        deferred_releases_.push_back(change);
+    }
 
     if (new_it == changesEnd() || !matches_change(&dummy_change, *new_it)) // Change was successfully removed.
     {
@@ -508,6 +522,10 @@ bool DataReaderHistory::remove_change_sub(
                 {
                     --counters_.samples_read;
                 }
+                else
+                {
+                    sample_unread_removed(*vit->second);
+                }
             }
             else
             {
@@ -523,6 +541,15 @@ bool DataReaderHistory::remove_change_sub(
     return false;
 }
 
+void DataReaderHistory::release_deferred_changes_nts()
+{
+    if (!deferred_releases_.empty())
+    {
+        do_release_caches(deferred_releases_.data(), deferred_releases_.size());
+        deferred_releases_.clear();
+    }
+}
+
 bool DataReaderHistory::set_next_deadline(
         const InstanceHandle_t& handle,
         const std::chrono::steady_clock::time_point& next_deadline_us,
@@ -581,6 +608,18 @@ uint64_t DataReaderHistory::get_unread_count(
     {
         counters_.samples_read += ret_val;
         counters_.samples_unread = 0;
+
+        // Samples not notified yet are kept unread, so the per instance bounds should be recomputed
+        for (auto& it : instances_)
+        {
+            DataReaderInstance& instance = *it.second;
+            instance.unread_samples = static_cast<uint32_t>(std::count_if(
+                        instance.cache_changes.begin(), instance.cache_changes.end(),
+                        [](const DataReaderCacheChange& item)
+                        {
+                            return !item->isRead;
+                        }));
+        }
     }
     return ret_val;
 }
@@ -627,11 +666,7 @@ std::pair<bool, DataReaderHistory::instance_info> DataReaderHistory::lookup_avai
             else
             {
                 // Looking for an instance with a handle greater than the one on the input
-                auto comp = [](const InstanceHandle_t& h, const InstanceCollection::value_type& it)
-                        {
-                            return h < it.first;
-                        };
-                it = std::upper_bound(data_available_instances_.begin(), data_available_instances_.end(), handle, comp);
+                it = data_available_instances_.upper_bound(handle);
             }
         }
     }
@@ -705,7 +740,10 @@ ReaderHistory::iterator DataReaderHistory::remove_change_nts(
                 // keyed map.
                 if (it != instances_.end())
                 {
-                    it->second->cache_changes.remove(change_ptr);
+                    if (it->second->cache_changes.remove(change_ptr) && !dummy_change.isRead)
+                    {
+                        sample_unread_removed(*it->second);
+                    }
                     if (dummy_change.isRead)
                     {
                         --counters_.samples_read;
@@ -831,6 +869,21 @@ void DataReaderHistory::change_was_processed_nts(
     {
         ++counters_.samples_read;
         --counters_.samples_unread;
+
+        auto vit = instances_.find(change->instanceHandle);
+        if (vit != instances_.end())
+        {
+            sample_unread_removed(*vit->second);
+        }
+    }
+}
+
+void DataReaderHistory::sample_unread_removed(
+        DataReaderInstance& instance)
+{
+    if (0 < instance.unread_samples)
+    {
+        --instance.unread_samples;
     }
 }
 
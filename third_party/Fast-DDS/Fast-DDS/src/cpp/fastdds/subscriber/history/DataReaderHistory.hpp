@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <fastcdr/cdr/fixed_size_string.hpp>
 
@@ -46,6 +47,9 @@
 
 #include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
 
+#include <rtps/common/InstanceHandleHash.hpp>
+#include <utils/collections/HashIndexedMap.hpp>
+
 #include "DataReaderHistoryCounters.hpp"
 #include "DataReaderInstance.hpp"
 
@@ -67,7 +71,8 @@ public:
     using GUID_t = eprosima::fastdds::rtps::GUID_t;
     using SequenceNumber_t = eprosima::fastdds::rtps::SequenceNumber_t;
 
-    using InstanceCollection = std::map<InstanceHandle_t, std::shared_ptr<DataReaderInstance>>;
+    using InstanceCollection = HashIndexedMap<InstanceHandle_t, std::shared_ptr<DataReaderInstance>,
+                    eprosima::fastdds::rtps::InstanceHandleHash>;
     using instance_info = InstanceCollection::iterator;
 
     /**
@@ -218,14 +223,23 @@ public:
     /**
      * This method is called to remove a change from the DataReaderHistory.
      *
-     * @param [in]     change Pointer to the CacheChange_t.
-     * @param [in,out] it     Iterator pointing to change on input. Will point to next valid change on output.
+     * @param [in]     change         Pointer to the CacheChange_t.
+     * @param [in,out] it             Iterator pointing to change on input. Will point to next valid change on output.
+     * @param [in]     defer_release  When true, the change is kept until @ref release_deferred_changes_nts is called
+     *                                instead of being returned to the pool right away.
      *
      * @return True if removed.
      */
     bool remove_change_sub(
             CacheChange_t* change,
-            DataReaderInstance::ChangeCollection::iterator& it);
+            DataReaderInstance::ChangeCollection::iterator& it,
+            bool defer_release = false);
+
+    /**
+     * Return to the pool, at once, all the changes removed with @c defer_release since the last call.
+     * No Thread Safe.
+     */
+    void release_deferred_changes_nts();
 
     /**
      * Called when a writer is unmatched from the reader holding this history.
@@ -400,6 +414,9 @@ private:
     /// Book-keeping counters for ReadCondition support
     DataReaderHistoryCounters counters_;
 
+    /// Changes removed from the history and still waiting to be returned to the pool
+    std::vector<CacheChange_t*> deferred_releases_;
+
     /**
      * @brief Method that finds a key in m_keyedChanges or tries to add it if not found
      * @param a_change The change to get the key from
@@ -464,6 +481,14 @@ private:
             CacheChange_t* a_change,
             DataReaderInstance& instance);
 
+    /**
+     * @brief Account that an unread sample of an instance has been read or removed from it.
+     *
+     * @param instance  Instance the sample belongs to.
+     */
+    void sample_unread_removed(
+            DataReaderInstance& instance);
+
 };
 
 } // namespace detail
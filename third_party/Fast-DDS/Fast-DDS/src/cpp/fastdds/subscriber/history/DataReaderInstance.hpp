@@ -58,6 +58,9 @@ struct DataReaderInstance
     int32_t disposed_generation_count = 0;
     //! Current no_writers generation of the instance
     int32_t no_writers_generation_count = 0;
+    //! Upper bound of the number of unread samples on @c cache_changes, used to skip instances on read / take
+    //! operations that only look for unread samples
+    uint32_t unread_samples = 0;
 
     DataReaderInstance(
             const eprosima::fastdds::ResourceLimitedContainerConfig& changes_allocation,
@@ -19,6 +19,8 @@
 #include <exception>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <fastcdr/Cdr.h>
 #include <fastcdr/CdrSizeCalculator.hpp>
@@ -92,11 +94,12 @@ ReturnCode_t TypeObjectRegistry::register_type_object(
     complete_entry.complementary_type_id = type_ids.type_identifier1();
     minimal_entry.complementary_type_id = type_ids.type_identifier2();
 
-    std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+    std::lock_guard<shared_mutex> data_guard(type_object_registry_mutex_);
     auto type_ids_result {local_type_identifiers_.insert({type_name, type_ids})};
 
     if (type_ids_result.second)
     {
+        index_local_type_identifiers(type_name, type_ids);
         auto min_entry_result {type_registry_entries_.insert(
                                    {type_ids.type_identifier1(), minimal_entry})};
         if (!min_entry_result.second)
@@ -247,7 +250,7 @@ ReturnCode_t TypeObjectRegistry::register_type_identifier(
             break;
     }
 
-    std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+    std::lock_guard<shared_mutex> data_guard(type_object_registry_mutex_);
     auto result {local_type_identifiers_.insert({type_name, type_identifier})};
     if (!result.second)
     {
@@ -256,6 +259,10 @@ ReturnCode_t TypeObjectRegistry::register_type_identifier(
             return eprosima::fastdds::dds::RETCODE_BAD_PARAMETER;
         }
     }
+    else
+    {
+        index_local_type_identifiers(type_name, type_identifier);
+    }
     return eprosima::fastdds::dds::RETCODE_OK;
 }
 
@@ -277,7 +284,7 @@ ReturnCode_t TypeObjectRegistry::get_type_objects(
             return eprosima::fastdds::dds::RETCODE_BAD_PARAMETER;
         }
 
-        std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+        shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
         if (EK_MINIMAL == type_ids.type_identifier1()._d())
         {
             type_objects.minimal_type_object =
@@ -306,7 +313,7 @@ ReturnCode_t TypeObjectRegistry::get_type_identifiers(
     }
     try
     {
-        std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+        shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
         type_identifiers = local_type_identifiers_.at(type_name);
     }
     catch (std::exception&)
@@ -324,16 +331,22 @@ ReturnCode_t TypeObjectRegistry::get_type_object(
     {
         return eprosima::fastdds::dds::RETCODE_PRECONDITION_NOT_MET;
     }
-    try
     {
-        std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
-        type_object = type_registry_entries_.at(type_identifier).type_object;
+        shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
+        auto it {type_registry_entries_.find(type_identifier)};
+        if (type_registry_entries_.end() != it)
+        {
+            type_object = it->second.type_object;
+            return eprosima::fastdds::dds::RETCODE_OK;
+        }
     }
-    catch (std::exception&)
+
+    // The minimal TypeObject of a remote complete type is built the first time it is required
+    if (EK_MINIMAL == type_identifier._d() && build_pending_minimal_type_object(type_identifier))
     {
-        return eprosima::fastdds::dds::RETCODE_NO_DATA;
+        return get_type_object(type_identifier, type_object);
     }
-    return eprosima::fastdds::dds::RETCODE_OK;
+    return eprosima::fastdds::dds::RETCODE_NO_DATA;
 }
 
 ReturnCode_t TypeObjectRegistry::get_type_information(
@@ -354,7 +367,7 @@ ReturnCode_t TypeObjectRegistry::get_type_information(
     }
 
     {
-        std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+        shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
         if (type_registry_entries_.end() == type_registry_entries_.find(type_ids.type_identifier1()) ||
                 (TK_NONE != type_ids.type_identifier2()._d() &&
                 type_registry_entries_.end() == type_registry_entries_.find(type_ids.type_identifier2())))
@@ -424,7 +437,7 @@ ReturnCode_t TypeObjectRegistry::get_type_information(
             type_information.minimal().dependent_typeid_count(NO_DEPENDENCIES);
         }
 
-        std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+        shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
         type_information.complete().typeid_with_size().typeobject_serialized_size(
             type_registry_entries_.at(
                 type_ids.type_identifier1()).type_object_serialized_size);
@@ -496,7 +509,7 @@ ReturnCode_t TypeObjectRegistry::get_type_information(
             type_information.complete().dependent_typeid_count(NO_DEPENDENCIES);
         }
 
-        std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+        shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
         type_information.minimal().typeid_with_size().typeobject_serialized_size(
             type_registry_entries_.at(
                 type_ids.type_identifier1()).type_object_serialized_size);
@@ -527,9 +540,73 @@ ReturnCode_t TypeObjectRegistry::get_type_dependencies(
 bool TypeObjectRegistry::is_type_identifier_known(
         const TypeIdentfierWithSize& type_identifier_with_size)
 {
+    if (is_type_identifier_registered(type_identifier_with_size))
+    {
+        return true;
+    }
+
+    // The minimal TypeObject of a remote complete type is built the first time it is required
+    return EK_MINIMAL == type_identifier_with_size.type_id()._d() &&
+           build_pending_minimal_type_object(type_identifier_with_size.type_id()) &&
+           is_type_identifier_registered(type_identifier_with_size);
+}
+
+void TypeObjectRegistry::register_pending_minimal_type_identifier(
+        const TypeIdentifier& minimal_type_id,
+        const TypeIdentifier& complete_type_id)
+{
+    if (EK_MINIMAL != minimal_type_id._d() || EK_COMPLETE != complete_type_id._d())
+    {
+        return;
+    }
+
+    {
+        // Most endpoints announce types already known
+        shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
+        if (type_registry_entries_.end() != type_registry_entries_.find(minimal_type_id) ||
+                pending_minimal_type_ids_.end() != pending_minimal_type_ids_.find(minimal_type_id))
+        {
+            return;
+        }
+    }
+
+    std::lock_guard<shared_mutex> data_guard(type_object_registry_mutex_);
+    if (type_registry_entries_.end() == type_registry_entries_.find(minimal_type_id))
+    {
+        pending_minimal_type_ids_.insert({minimal_type_id, complete_type_id});
+    }
+}
+
+bool TypeObjectRegistry::build_pending_minimal_type_object(
+        const TypeIdentifier& minimal_type_id)
+{
+    TypeIdentifier complete_type_id;
+    {
+        shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
+        auto it {pending_minimal_type_ids_.find(minimal_type_id)};
+        if (pending_minimal_type_ids_.end() == it ||
+                type_registry_entries_.end() == type_registry_entries_.find(it->second))
+        {
+            // The complete TypeObject might not have been received yet
+            return false;
+        }
+        complete_type_id = it->second;
+    }
+
+    // The minimal TypeObject built locally might not match the one announced
+    bool built {minimal_type_id == get_complementary_type_identifier(complete_type_id)};
+
+    std::lock_guard<shared_mutex> data_guard(type_object_registry_mutex_);
+    pending_minimal_type_ids_.erase(minimal_type_id);
+    return built;
+}
+
+bool TypeObjectRegistry::is_type_identifier_registered(
+        const TypeIdentfierWithSize& type_identifier_with_size)
+{
+    shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
     if (TypeObjectUtils::is_direct_hash_type_identifier(type_identifier_with_size.type_id()))
     {
-        std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
         // Check TypeIdentifier is known
         auto it {type_registry_entries_.find(type_identifier_with_size.type_id())};
         if (it != type_registry_entries_.end())
@@ -541,9 +618,10 @@ bool TypeObjectRegistry::is_type_identifier_known(
                 return true;
             }
         }
+
+        return local_type_names_.end() != local_type_names_.find(type_identifier_with_size.type_id());
     }
 
-    std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
     for (const auto& it : local_type_identifiers_)
     {
         if (it.second.type_identifier1() == type_identifier_with_size.type_id() ||
@@ -563,14 +641,11 @@ bool TypeObjectRegistry::is_builtin_annotation(
         return false;
     }
 
-    std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
-    for (const auto& it : local_type_identifiers_)
+    shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
+    auto it {local_type_names_.find(type_identifier)};
+    if (local_type_names_.end() != it)
     {
-        if (it.second.type_identifier1() == type_identifier ||
-                it.second.type_identifier2() == type_identifier)
-        {
-            return is_builtin_annotation_name(it.first);
-        }
+        return is_builtin_annotation_name(it->second);
     }
     return false;
 }
@@ -652,14 +727,14 @@ ReturnCode_t TypeObjectRegistry::register_type_object(
         minimal_entry.complementary_type_id = type_ids.type_identifier2();
         complete_entry.complementary_type_id = type_ids.type_identifier1();
 
-        std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+        std::lock_guard<shared_mutex> data_guard(type_object_registry_mutex_);
         type_registry_entries_.insert({type_ids.type_identifier1(), minimal_entry});
     }
 
     complete_entry.type_object = type_object;
     complete_entry.type_object_serialized_size = type_object_serialized_size;
 
-    std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+    std::lock_guard<shared_mutex> data_guard(type_object_registry_mutex_);
     if (!type_registry_entries_.insert({type_identifier, complete_entry}).second)
     {
         if (build_minimal && EK_COMPLETE == type_object._d())
@@ -682,6 +757,43 @@ ReturnCode_t TypeObjectRegistry::register_type_object(
     return eprosima::fastdds::dds::RETCODE_OK;
 }
 
+ReturnCode_t TypeObjectRegistry::register_type_objects(
+        const TypeIdentifierTypeObjectPairSeq& type_objects,
+        std::vector<bool>& registered)
+{
+    ReturnCode_t ret_code {eprosima::fastdds::dds::RETCODE_OK};
+    std::vector<std::pair<TypeIdentifier, TypeRegistryEntry>> entries;
+    entries.reserve(type_objects.size());
+    registered.assign(type_objects.size(), false);
+
+    // TypeIdentifiers are calculated before taking the lock
+    for (size_t i = 0; i < type_objects.size(); ++i)
+    {
+        const TypeIdentifierTypeObjectPair& pair = type_objects[i];
+        TypeRegistryEntry entry;
+        TypeIdentifier type_identifier {calculate_type_identifier(
+                                            pair.type_object(),
+                                            entry.type_object_serialized_size)};
+        if (TK_NONE != pair.type_identifier()._d() &&
+                (pair.type_identifier()._d() != pair.type_object()._d() ||
+                type_identifier != pair.type_identifier()))
+        {
+            ret_code = eprosima::fastdds::dds::RETCODE_PRECONDITION_NOT_MET;
+            continue;
+        }
+        entry.type_object = pair.type_object();
+        entries.emplace_back(std::move(type_identifier), std::move(entry));
+        registered[i] = true;
+    }
+
+    std::lock_guard<shared_mutex> data_guard(type_object_registry_mutex_);
+    for (auto& entry : entries)
+    {
+        type_registry_entries_.insert(std::move(entry));
+    }
+    return ret_code;
+}
+
 ReturnCode_t TypeObjectRegistry::are_types_compatible(
         const TypeIdentifierPair& type_identifiers,
         const TypeConsistencyEnforcementQosPolicy& type_consistency_qos)
@@ -918,7 +1030,7 @@ const TypeIdentifier TypeObjectRegistry::get_complementary_type_identifier(
 {
     if (TypeObjectUtils::is_direct_hash_type_identifier(type_id))
     {
-        std::unique_lock<std::mutex> lock(type_object_registry_mutex_);
+        shared_lock<shared_mutex> lock(type_object_registry_mutex_);
         auto it = type_registry_entries_.find(type_id);
         if (type_registry_entries_.end() != it)
         {
@@ -928,6 +1040,7 @@ const TypeIdentifier TypeObjectRegistry::get_complementary_type_identifier(
             }
             else if (EK_COMPLETE == type_id._d()) // From EK_COMPLETE its EK_MINIMAL complementary can be built.
             {
+                // The minimal TypeObject of a remote type is only built the first time it is required.
                 TypeRegistryEntry minimal_entry;
                 CompleteTypeObject complete_type_object = it->second.type_object.complete();
                 lock.unlock();
@@ -937,7 +1050,8 @@ const TypeIdentifier TypeObjectRegistry::get_complementary_type_identifier(
                     minimal_entry.type_object,
                     minimal_entry.type_object_serialized_size);
 
-                lock.lock();
+                std::lock_guard<shared_mutex> data_guard(type_object_registry_mutex_);
+                pending_minimal_type_ids_.erase(minimal_type_id);
                 auto min_entry_result {type_registry_entries_.insert(
                                            {minimal_type_id, minimal_entry})};
                 if (!min_entry_result.second)
@@ -955,6 +1069,12 @@ const TypeIdentifier TypeObjectRegistry::get_complementary_type_identifier(
         }
         else
         {
+            lock.unlock();
+            // The minimal TypeObject of a remote complete type is built the first time it is required
+            if (EK_MINIMAL == type_id._d() && build_pending_minimal_type_object(type_id))
+            {
+                return get_complementary_type_identifier(type_id);
+            }
             EPROSIMA_LOG_WARNING(
                 XTYPES_TYPE_REPRESENTATION,
                 "Complete type identifier was not registered previously.");
@@ -1024,7 +1144,7 @@ void TypeObjectRegistry::add_dependency(
     TypeIdentfierWithSize type_id_size;
     type_id_size.type_id(type_id);
     {
-        std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+        shared_lock<shared_mutex> data_guard(type_object_registry_mutex_);
         type_id_size.typeobject_serialized_size(
             type_registry_entries_.at(
                 type_id).type_object_serialized_size);
@@ -1371,7 +1491,7 @@ const MinimalBitmaskType TypeObjectRegistry::build_minimal_from_complete_bitmask
 
 void TypeObjectRegistry::register_primitive_type_identifiers()
 {
-    std::lock_guard<std::mutex> data_guard(type_object_registry_mutex_);
+    std::lock_guard<shared_mutex> data_guard(type_object_registry_mutex_);
     TypeIdentifierPair type_ids;
     type_ids.type_identifier1()._d(TK_BOOLEAN);
     local_type_identifiers_.insert({boolean_type_name, type_ids});
@@ -1405,6 +1525,20 @@ void TypeObjectRegistry::register_primitive_type_identifiers()
     local_type_identifiers_.insert({char16_type_name, type_ids});
 }
 
+void TypeObjectRegistry::index_local_type_identifiers(
+        const std::string& type_name,
+        const TypeIdentifierPair& type_ids)
+{
+    if (TypeObjectUtils::is_direct_hash_type_identifier(type_ids.type_identifier1()))
+    {
+        local_type_names_.insert({type_ids.type_identifier1(), type_name});
+    }
+    if (TypeObjectUtils::is_direct_hash_type_identifier(type_ids.type_identifier2()))
+    {
+        local_type_names_.insert({type_ids.type_identifier2(), type_name});
+    }
+}
+
 const TypeIdentifier TypeObjectRegistry::minimal_from_complete_type_identifier(
         const TypeIdentifier& type_id)
 {
@@ -24,6 +24,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <fastcdr/xcdr/optional.hpp>
 
@@ -39,6 +40,7 @@
 #include <fastdds/xtypes/dynamic_types/DynamicTypeImpl.hpp>
 #include <fastdds/xtypes/dynamic_types/MemberDescriptorImpl.hpp>
 #include <fastdds/xtypes/type_representation/TypeIdentifierWithSizeHashSpecialization.h>
+#include <utils/shared_mutex.hpp>
 
 namespace std {
 template<>
@@ -163,6 +165,21 @@ public:
             TypeIdentifierPair& type_ids,
             bool build_minimal);
 
+    /**
+     * @brief Register the remote TypeObjects received in a TypeLookup reply.
+     *        Same as calling register_type_object without building the minimal TypeObject for each pair, but the
+     *        registry is only locked once for all of them.
+     *
+     * @param [in] type_objects Sequence of TypeIdentifiers and their related TypeObjects.
+     * @param [out] registered Whether each pair of @c type_objects was registered, in the same order.
+     * @return ReturnCode_t RETCODE_OK if every TypeObject is correctly registered.
+     *                      RETCODE_PRECONDITION_NOT_MET if any TypeIdentifier is not consistent with its TypeObject.
+     *                      The rest of the TypeObjects are registered anyway.
+     */
+    ReturnCode_t register_type_objects(
+            const TypeIdentifierTypeObjectPairSeq& type_objects,
+            std::vector<bool>& registered);
+
     /**
      * @brief Register an indirect hash TypeIdentifier.
      *
@@ -271,6 +288,18 @@ public:
     bool is_type_identifier_known(
             const TypeIdentfierWithSize& type_identifier_with_size);
 
+    /**
+     * @brief Register the minimal TypeIdentifier announced along with a remote complete TypeIdentifier.
+     *        The minimal TypeObject of a remote complete type is not built when the type is registered, so a lookup by
+     *        this minimal TypeIdentifier builds it from the complete one.
+     *
+     * @param [in] minimal_type_id Minimal TypeIdentifier announced by the remote participant.
+     * @param [in] complete_type_id Complete TypeIdentifier announced by the remote participant.
+     */
+    void register_pending_minimal_type_identifier(
+            const TypeIdentifier& minimal_type_id,
+            const TypeIdentifier& complete_type_id);
+
     /**
      * @brief Check if a given TypeIdentifier corresponds to a builtin annotation.
      *
@@ -796,6 +825,38 @@ protected:
      */
     void register_primitive_type_identifiers();
 
+    /**
+     * @brief Check if the given TypeIdentfierWithSize is already registered, without building any TypeObject.
+     *
+     * @param [in] type_identifier_with_size TypeIdentfierWithSize to query.
+     * @return true if TypeIdentfierWithSize is known. false otherwise.
+     */
+    bool is_type_identifier_registered(
+            const TypeIdentfierWithSize& type_identifier_with_size);
+
+    /**
+     * @brief Build the minimal TypeObject of a remote complete type the first time its minimal TypeIdentifier is
+     *        looked up.
+     *
+     * @param [in] minimal_type_id Minimal TypeIdentifier being looked up.
+     * @return true if the minimal TypeIdentifier has been registered. false if it was not pending, its complete
+     *         type is not registered yet, or the minimal TypeObject built does not match it.
+     */
+    bool build_pending_minimal_type_object(
+            const TypeIdentifier& minimal_type_id);
+
+    /**
+     * @brief Add the direct hash TypeIdentifiers of a local type to the reverse index.
+     *
+     * @pre type_object_registry_mutex_ must be taken exclusively.
+     *
+     * @param [in] type_name Name of the local type.
+     * @param [in] type_ids TypeIdentifierPair registered for the local type.
+     */
+    void index_local_type_identifiers(
+            const std::string& type_name,
+            const TypeIdentifierPair& type_ids);
+
     /**
      * @brief Get Minimal TypeIdentifier from Complete TypeIdentifier.
      *
@@ -1097,12 +1158,20 @@ protected:
     // In case of indirect hash TypeIdentifiers, type_identifier_2 would be uninitialized (TK_NONE).
     std::unordered_map<std::string, TypeIdentifierPair> local_type_identifiers_;
 
+    // Reverse index of local_type_identifiers_: type_name of every local direct hash TypeIdentifier.
+    std::unordered_map<TypeIdentifier, std::string> local_type_names_;
+
     // Collection of TypeObjects hashed by its TypeIdentifier.
     // Only direct hash TypeIdentifiers are included in this collection.
     std::unordered_map<TypeIdentifier, TypeRegistryEntry> type_registry_entries_;
 
-    // Mutex to protect concurrent access to collections contained in this class
-    std::mutex type_object_registry_mutex_;
+    // Minimal TypeIdentifiers announced for remote complete types whose minimal TypeObject has not been built yet,
+    // with their complete TypeIdentifier.
+    std::unordered_map<TypeIdentifier, TypeIdentifier> pending_minimal_type_ids_;
+
+    // Mutex to protect concurrent access to collections contained in this class.
+    // Lookups, which are most of the accesses once the types are registered, only take it shared.
+    shared_mutex type_object_registry_mutex_;
 
 };
 
@@ -22,6 +22,7 @@
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
@@ -36,6 +37,7 @@ DataSharingListener::DataSharingListener(
         std::shared_ptr<DataSharingNotification> notification,
         const std::string& datasharing_pools_directory,
         const ThreadSettings& thr_config,
+        std::chrono::nanoseconds spin_duration,
         ResourceLimitedContainerConfig limits,
         BaseReader* reader)
     : notification_(notification)
@@ -43,8 +45,11 @@ DataSharingListener::DataSharingListener(
     , reader_(reader)
     , writer_pools_(limits)
     , writer_pools_changed_(false)
+    , check_all_writers_(false)
     , datasharing_pools_directory_(datasharing_pools_directory)
     , thread_config_(thr_config)
+    , max_spin_((std::max)(spin_duration, std::chrono::nanoseconds(0)))
+    , current_spin_(max_spin_)
 {
 }
 
@@ -54,22 +59,47 @@ DataSharingListener::~DataSharingListener()
     notification_->destroy();
 }
 
-void DataSharingListener::run()
+bool DataSharingListener::spin_for_new_data()
 {
-    while (is_running_.load())
+    if (max_spin_.count() == 0)
     {
-        try
+        return false;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + current_spin_;
+    do
+    {
+        if (!is_running_.load() || notification_->notification_->new_data.load())
         {
-            std::unique_lock<Segment::mutex> lock(notification_->notification_->notification_mutex);
-            notification_->notification_->notification_cv.wait(lock, [&]
-                    {
-                        return !is_running_.load() || notification_->notification_->new_data.load();
-                    });
+            current_spin_ = max_spin_;
+            return true;
         }
-        catch (const boost::interprocess::interprocess_exception& /*e*/)
+    } while (std::chrono::steady_clock::now() < deadline);
+
+    // Nothing arrived, spin less next time so an idle reader does not keep the core busy
+    current_spin_ = std::max(current_spin_ / 2, max_spin_ / 16);
+    return false;
+}
+
+void DataSharingListener::run()
+{
+    while (is_running_.load())
+    {
+        if (!spin_for_new_data())
         {
-            // Timeout when locking
-            continue;
+            try
+            {
+                std::unique_lock<Segment::mutex> lock(notification_->notification_->notification_mutex);
+                notification_->notification_->notification_cv.wait(lock, [&]
+                        {
+                            return !is_running_.load() || notification_->notification_->new_data.load();
+                        });
+            }
+            catch (const boost::interprocess::interprocess_exception& /*e*/)
+            {
+                // Timeout when locking
+                continue;
+            }
         }
 
         if (!is_running_.load())
@@ -80,7 +110,7 @@ void DataSharingListener::run()
 
         do
         {
-            process_new_data();
+            process_new_data(false);
 
             // If some writer added new data, there may be something to read.
             // If there were matching/unmatching, we may not have finished our last loop
@@ -126,7 +156,8 @@ void DataSharingListener::stop()
     listening_thread_.join();
 }
 
-void DataSharingListener::process_new_data ()
+void DataSharingListener::process_new_data (
+        bool all_writers)
 {
     EPROSIMA_LOG_INFO(RTPS_READER, "Received new data notification");
 
@@ -134,12 +165,29 @@ void DataSharingListener::process_new_data ()
 
     // It is safe to 'forget' any change now
     notification_->notification_->new_data.store(false);
+    // New writers and writers skipped by an interrupted loop may have data without being flagged.
+    // Notifications simulated by the reader itself do not flag any writer either.
+    all_writers |= writer_pools_changed_.load(std::memory_order_relaxed);
+    all_writers |= check_all_writers_.exchange(false);
     // All places where this is set to true is locked by the same mutex, memory_order_relaxed is enough
     writer_pools_changed_.store(false, std::memory_order_relaxed);
 
+    // Take the flagged writers after clearing new_data, so flags set from now on will wake us again
+    uint32_t pending_writers[DataSharingNotification::writer_slot_count / 32];
+    for (uint32_t i = 0; i < DataSharingNotification::writer_slot_count / 32; ++i)
+    {
+        pending_writers[i] = notification_->pending_writers_->mask[i].exchange(0u);
+    }
+
     // Loop on the writers looking for data not read yet
     for (auto it = writer_pools_.begin(); it != writer_pools_.end(); ++it)
     {
+        if (!all_writers && it->flags_notifications &&
+                0u == (pending_writers[it->slot / 32] & (1u << (it->slot % 32))))
+        {
+            continue;
+        }
+
         //First see if we have some liveliness asertion pending
         bool liveliness_assertion_needed = false;
         uint32_t new_assertion_sequence = it->pool->last_liveliness_sequence();
@@ -283,10 +331,11 @@ void DataSharingListener::notify(
 {
     if (same_thread)
     {
-        process_new_data();
+        process_new_data(true);
     }
     else
     {
+        check_all_writers_.store(true);
         notification_->notify();
     }
 }
@@ -20,6 +20,7 @@
 #define RTPS_DATASHARING_DATASHARINGLISTENER_HPP
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 
@@ -61,6 +62,7 @@ public:
             std::shared_ptr<DataSharingNotification> notification,
             const std::string& datasharing_pools_directory,
             const ThreadSettings& thr_config,
+            std::chrono::nanoseconds spin_duration,
             ResourceLimitedContainerConfig limits,
             BaseReader* reader);
 
@@ -102,15 +104,29 @@ protected:
      */
     void run();
 
+    /**
+     * Busy waits for a notification during the current spin budget.
+     * The budget is restored after a successful spin and halved after a failed one,
+     * so an idle reader quickly falls back to blocking.
+     *
+     * @return true if a notification arrived or the listener was stopped while spinning.
+     */
+    bool spin_for_new_data();
+
     /**
      * Processes a notification
+     *
+     * @param all_writers Whether to look at every writer or only at those flagged on the notification.
      */
-    void process_new_data();
+    void process_new_data(
+            bool all_writers);
 
     struct WriterInfo
     {
         std::shared_ptr<ReaderPool> pool;
         uint32_t last_assertion_sequence = 0;
+        uint32_t slot = 0;
+        bool flags_notifications = false;
 
         WriterInfo() = default;
         WriterInfo(
@@ -118,6 +134,8 @@ protected:
                 uint32_t assertion)
             : pool(writer_pool)
             , last_assertion_sequence(assertion)
+            , slot(DataSharingNotification::writer_slot(writer_pool->writer()))
+            , flags_notifications(writer_pool->writer_flags_notifications())
         {
         }
 
@@ -129,8 +147,11 @@ protected:
     eprosima::thread listening_thread_;
     ResourceLimitedVector<WriterInfo> writer_pools_;
     std::atomic<bool> writer_pools_changed_;
+    std::atomic<bool> check_all_writers_;
     std::string datasharing_pools_directory_;
     ThreadSettings thread_config_;
+    std::chrono::nanoseconds max_spin_;
+    std::chrono::nanoseconds current_spin_;
     mutable std::mutex mutex_;
 
 };
@@ -26,6 +26,8 @@ namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+constexpr uint32_t DataSharingNotification::writer_slot_count;
+
 std::shared_ptr<DataSharingNotification> DataSharingNotification::create_notification(
         const GUID_t& reader_guid,
         const std::string& shared_dir)
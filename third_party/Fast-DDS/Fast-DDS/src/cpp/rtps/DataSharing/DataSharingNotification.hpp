@@ -23,6 +23,7 @@
 #include <rtps/history/PoolConfig.h>
 #include <utils/shared_memory/SharedMemSegment.hpp>
 #include <utils/shared_memory/SharedDir.hpp>
+#include <utils/Fnv1a.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
 
 #include <memory>
@@ -48,6 +49,9 @@ public:
 
     virtual ~DataSharingNotification() = default;
 
+    //! Number of slots on the mask of writers with pending notifications
+    static constexpr uint32_t writer_slot_count = 256;
+
     /**
      * Notifies of new data
      */
@@ -66,6 +70,39 @@ public:
         }
     }
 
+    /**
+     * Notifies of new data from a writer.
+     * The slot of the writer is flagged before waking the listener, so it only needs to look at the flagged writers.
+     * Readers from versions without the mask of pending writers are just notified.
+     *
+     * @param writer_guid GUID of the writer with new data
+     */
+    inline void notify(
+            const GUID_t& writer_guid)
+    {
+        if (nullptr != pending_writers_)
+        {
+            uint32_t slot = writer_slot(writer_guid);
+            pending_writers_->mask[slot / 32].fetch_or(1u << (slot % 32));
+        }
+        notify();
+    }
+
+    /**
+     * Computes the slot of a writer on the mask of writers with pending notifications.
+     * Writer and reader may live on different processes, so this should not depend on anything process specific.
+     * Different writers may share a slot. That only makes the listener look at a writer without new data.
+     *
+     * @param writer_guid GUID of the writer
+     * @return the slot of the writer, in the range [0, writer_slot_count)
+     */
+    static uint32_t writer_slot(
+            const GUID_t& writer_guid)
+    {
+        uint32_t hash = fnv1a_32(writer_guid);
+        return (hash ^ (hash >> 16)) % writer_slot_count;
+    }
+
     /**
      * Returns the GUID of the reader listening to the notifications
      */
@@ -111,8 +148,24 @@ protected:
         //! New data available
         std::atomic<bool> new_data;
     };
+
+    /**
+     * Mask of writers with pending notifications.
+     * Kept on its own node, so the layout of the Notification node is the same for peers from previous versions,
+     * which do not know about it.
+     */
+    struct alignas (8) PendingWriters
+    {
+        //! Writers with pending notifications, one bit per slot
+        std::atomic<uint32_t> mask[writer_slot_count / 32];
+    };
 #pragma warning(pop)
 
+    constexpr static const char* pending_writers_chunk_name()
+    {
+        return "pending_writers_node";
+    }
+
     static std::string generate_segment_name(
             const std::string& shared_dir,
             const GUID_t& reader_guid)
@@ -147,7 +200,8 @@ protected:
         {
             uint32_t per_allocation_extra_size = T::compute_per_allocation_extra_size(
                 alignof(Notification), DataSharingNotification::domain_name());
-            uint32_t segment_size = static_cast<uint32_t>(sizeof(Notification)) + per_allocation_extra_size;
+            uint32_t segment_size = static_cast<uint32_t>(sizeof(Notification)) + per_allocation_extra_size +
+                    static_cast<uint32_t>(sizeof(PendingWriters)) + per_allocation_extra_size;
 
             //Open the segment
             T::remove(segment_name_);
@@ -169,6 +223,11 @@ protected:
             // Alloc and initialize the Node
             notification_ = local_segment->get().template construct<Notification>("notification_node")();
             notification_->new_data.store(false);
+            pending_writers_ = local_segment->get().template construct<PendingWriters>(pending_writers_chunk_name())();
+            for (std::atomic<uint32_t>& pending : pending_writers_->mask)
+            {
+                pending.store(0u);
+            }
         }
         catch (std::exception& e)
         {
@@ -218,6 +277,10 @@ protected:
             return false;
         }
 
+        // Not present on readers from previous versions
+        pending_writers_ = (local_segment->get().template find<PendingWriters>(
+                    pending_writers_chunk_name())).first;
+
         segment_ = std::move(local_segment);
         return true;
     }
@@ -227,6 +290,7 @@ protected:
 
     std::unique_ptr<Segment> segment_;  //< Shared memory segment
     Notification* notification_;        //< The notification data
+    PendingWriters* pending_writers_ = nullptr; //< The mask of writers with pending notifications, if supported
     bool owned_ = false;                //< Whether the shared segment is owned by this instance
 };
 
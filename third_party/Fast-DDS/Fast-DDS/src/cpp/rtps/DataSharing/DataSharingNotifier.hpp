@@ -36,11 +36,14 @@ public:
 
     /**
      * Initializes a datasharing notifier for a reader
+     * @param writer_guid GUID of the writer sending the notifications
      * @param directory Sahred memory directory to use to open the shared notification
      */
     DataSharingNotifier(
+            const GUID_t& writer_guid,
             std::string directory)
-        : directory_(directory)
+        : writer_guid_(writer_guid)
+        , directory_(directory)
     {
     }
 
@@ -80,13 +83,14 @@ public:
         if (is_enabled())
         {
             EPROSIMA_LOG_INFO(RTPS_WRITER, "Notifying reader " << shared_notification_->reader());
-            shared_notification_->notify();
+            shared_notification_->notify(writer_guid_);
         }
     }
 
 protected:
 
     std::shared_ptr<DataSharingNotification> shared_notification_;
+    GUID_t writer_guid_;
     std::string directory_;
 };
 
@@ -27,6 +27,8 @@ namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+constexpr uint32_t DataSharingPayloadPool::notification_version;
+
 bool DataSharingPayloadPool::release_payload(
         SerializedPayload_t& payload)
 {
@@ -101,6 +101,16 @@ public:
         return "history";
     }
 
+    constexpr static const char* notification_version_chunk_name()
+    {
+        return "notification_version";
+    }
+
+    //! Version of the notification protocol used by the writer.
+    //! Version 1 flags the slot of the writer on the mask of pending writers of the reader before notifying.
+    //! Writers from previous versions do not have this chunk.
+    static constexpr uint32_t notification_version = 1;
+
     uint32_t history_size() const
     {
         return descriptor_->history_size;
@@ -141,6 +141,11 @@ public:
             return false;
         }
 
+        // Writers from previous versions do not flag their notifications
+        const uint32_t* version = local_segment->get().template find<uint32_t>(
+            notification_version_chunk_name()).first;
+        writer_flags_notifications_ = (nullptr != version && 1u <= *version);
+
         // Set the reading pointer
         next_payload_ = begin();
         segment_ = std::move(local_segment);
@@ -276,6 +281,15 @@ public:
         return false;
     }
 
+    /**
+     * Whether the writer flags its slot on the mask of pending writers when notifying.
+     * The pool of writers which do not flag it has to be checked on every notification.
+     */
+    bool writer_flags_notifications() const
+    {
+        return writer_flags_notifications_;
+    }
+
 protected:
 
     bool ensure_reading_reference_is_in_bounds()
@@ -305,6 +319,7 @@ private:
     bool is_volatile_;              //< Whether the reader is volatile or not
     uint64_t next_payload_;         //< Index of the next history position to read
     SequenceNumber_t last_sn_;      //< Sequence number of the last read payload
+    bool writer_flags_notifications_ = false; //< Whether the writer flags its notifications
 };
 
 }  // namespace rtps
@@ -160,9 +160,11 @@ public:
             uint32_t size_for_history = static_cast<uint32_t>(estimated_size_for_history);
 
             uint32_t descriptor_size = static_cast<uint32_t>(sizeof(PoolDescriptor));
+            uint32_t version_size = static_cast<uint32_t>(sizeof(uint32_t));
             uint64_t estimated_segment_size = size_for_payloads_pool + per_allocation_extra_size +
                     size_for_history + per_allocation_extra_size +
-                    descriptor_size + per_allocation_extra_size;
+                    descriptor_size + per_allocation_extra_size +
+                    version_size + per_allocation_extra_size;
             overflow |= (estimated_segment_size != static_cast<uint32_t>(estimated_segment_size));
             uint32_t segment_size = static_cast<uint32_t>(estimated_segment_size);
 
@@ -223,6 +225,10 @@ public:
             descriptor_->notified_end = 0u;
             descriptor_->liveliness_sequence = 0u;
 
+            //Alloc the version of the notification protocol
+            local_segment->get().template construct<uint32_t>(notification_version_chunk_name())(
+                uint32_t(notification_version));
+
             free_history_size_ = pool_size_;
         }
         catch (std::exception& e)
@@ -22,6 +22,7 @@
 #include <algorithm>
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.hpp>
 #include <fastdds/rtps/common/Locator.hpp>
 #include <fastdds/utils/IPFinder.hpp>
 
@@ -46,11 +47,19 @@ BuiltinProtocols::BuiltinProtocols()
     , mp_PDP(nullptr)
     , mp_WLP(nullptr)
     , typelookup_manager_(nullptr)
+    , defer_typelookup_manager_(false)
+    , typelookup_manager_shutting_down_(false)
 {
 }
 
 BuiltinProtocols::~BuiltinProtocols()
 {
+    {
+        // A deferred TypeLookupManager created from now on would be leaked
+        std::lock_guard<std::mutex> guard(typelookup_manager_mutex_);
+        typelookup_manager_shutting_down_ = true;
+    }
+
     if (nullptr != mp_PDP)
     {
         // Send participant is disposed
@@ -60,10 +69,7 @@ BuiltinProtocols::~BuiltinProtocols()
     }
 
     // The type lookup manager should be deleted first, since it will access the PDP database
-    if (nullptr != typelookup_manager_)
-    {
-        delete typelookup_manager_;
-    }
+    delete typelookup_manager_.exchange(nullptr);
 
     delete mp_WLP;
     delete mp_PDP;
@@ -88,6 +94,17 @@ bool BuiltinProtocols::initBuiltinProtocols(
 
     const RTPSParticipantAllocationAttributes& allocation = p_part->get_attributes().allocation;
 
+    // TypeLookupManager, which may be created on first use so participants not exchanging types save it.
+    // Decided before the PDP is initialized, since it sets the builtin endpoints to announce.
+    auto type_propagation = p_part->type_propagation();
+    bool should_create_typelookup =
+            (dds::utils::TypePropagation::TYPEPROPAGATION_ENABLED == type_propagation) ||
+            (dds::utils::TypePropagation::TYPEPROPAGATION_MINIMAL_BANDWIDTH == type_propagation);
+    const std::string* defer_property = PropertyPolicyHelper::find_property(p_part->get_attributes().properties,
+                    "fastdds.deferred_builtin_endpoints");
+    defer_typelookup_manager_ = should_create_typelookup && (nullptr != defer_property) &&
+            ("true" == *defer_property);
+
     // PDP
     switch (m_att.discovery_config.discoveryProtocol)
     {
@@ -143,15 +160,11 @@ bool BuiltinProtocols::initBuiltinProtocols(
     }
 
     // TypeLookupManager
-    auto type_propagation = p_part->type_propagation();
-    bool should_create_typelookup =
-            (dds::utils::TypePropagation::TYPEPROPAGATION_ENABLED == type_propagation) ||
-            (dds::utils::TypePropagation::TYPEPROPAGATION_MINIMAL_BANDWIDTH == type_propagation);
-
-    if (should_create_typelookup)
+    if (should_create_typelookup && !defer_typelookup_manager_)
     {
-        typelookup_manager_ = new fastdds::dds::builtin::TypeLookupManager();
-        typelookup_manager_->init(this);
+        auto typelookup_manager = new fastdds::dds::builtin::TypeLookupManager();
+        typelookup_manager->init(this);
+        typelookup_manager_ = typelookup_manager;
     }
 
     return true;
@@ -195,6 +208,48 @@ void BuiltinProtocols::filter_server_remote_locators(
     m_DiscoveryServers.swap(allowed_locators);
 }
 
+fastdds::dds::builtin::TypeLookupManager* BuiltinProtocols::typelookup_manager()
+{
+    fastdds::dds::builtin::TypeLookupManager* typelookup_manager = typelookup_manager_.load();
+    if (nullptr != typelookup_manager || !defer_typelookup_manager_ || nullptr == mp_PDP)
+    {
+        return typelookup_manager;
+    }
+
+    std::lock_guard<std::mutex> guard(typelookup_manager_mutex_);
+    typelookup_manager = typelookup_manager_.load();
+    if (nullptr == typelookup_manager && !typelookup_manager_shutting_down_)
+    {
+        typelookup_manager = new fastdds::dds::builtin::TypeLookupManager();
+        if (!typelookup_manager->init(this))
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PDP, "Deferred TypeLookupManager configuration failed");
+            delete typelookup_manager;
+            return nullptr;
+        }
+
+        {
+            // Participants discovered from now on are matched by the PDP, and the known ones are matched here
+            std::lock_guard<std::recursive_mutex> pdp_lock(*mp_PDP->getMutex());
+            typelookup_manager_ = typelookup_manager;
+
+            const GuidPrefix_t& local_prefix = mp_participantImpl->getGuid().guidPrefix;
+            for (auto it = mp_PDP->ParticipantProxiesBegin(); it != mp_PDP->ParticipantProxiesEnd(); ++it)
+            {
+                if ((*it)->guid.guidPrefix != local_prefix)
+                {
+                    typelookup_manager->assign_remote_endpoints(**it);
+                }
+            }
+        }
+
+        // Remote participants only match our TypeLookup endpoints after this announcement
+        mp_PDP->announce_typelookup_endpoints();
+    }
+
+    return typelookup_manager;
+}
+
 bool BuiltinProtocols::add_writer(
         RTPSWriter* rtps_writer,
         const TopicDescription& topic,
@@ -204,6 +259,9 @@ bool BuiltinProtocols::add_writer(
 
     if (nullptr != mp_PDP)
     {
+        // Remote participants may ask for our types as soon as this endpoint is announced
+        typelookup_manager();
+
         ok = mp_PDP->get_edp()->new_writer_proxy_data(rtps_writer, topic, qos);
 
         if (!ok)
@@ -239,6 +297,9 @@ bool BuiltinProtocols::add_reader(
 
     if (nullptr != mp_PDP)
     {
+        // Remote participants may ask for our types as soon as this endpoint is announced
+        typelookup_manager();
+
         ok = mp_PDP->get_edp()->new_reader_proxy_data(rtps_reader, topic, qos, content_filter);
 
         if (!ok)
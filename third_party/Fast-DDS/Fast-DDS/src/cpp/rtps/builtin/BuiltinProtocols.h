@@ -21,7 +21,9 @@
 #define FASTDDS_RTPS_BUILTIN__BUILTINPROTOCOLS_H
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <atomic>
 #include <list>
+#include <mutex>
 
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.hpp>
 #include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
@@ -76,6 +78,9 @@ private:
      */
     mutable eprosima::shared_mutex discovery_mutex_;
 
+    //! Mutex to serialize the creation of a deferred TypeLookupManager.
+    std::mutex typelookup_manager_mutex_;
+
 public:
 
     /**
@@ -117,8 +122,13 @@ public:
     PDP* mp_PDP;
     //!Pointer to the WLP
     WLP* mp_WLP;
-    //!Pointer to the TypeLookupManager
-    fastdds::dds::builtin::TypeLookupManager* typelookup_manager_;
+    //!Pointer to the TypeLookupManager. Loaded without lock, since a deferred one is created at any time.
+    std::atomic<fastdds::dds::builtin::TypeLookupManager*> typelookup_manager_;
+    //!Whether the TypeLookupManager is created on first use instead of on initialization.
+    bool defer_typelookup_manager_;
+    //!Whether the builtin protocols are being destroyed, so a deferred TypeLookupManager must not be created.
+    //!Protected by typelookup_manager_mutex_.
+    bool typelookup_manager_shutting_down_;
     //!Locator list for metatraffic
     LocatorList_t m_metatrafficMulticastLocatorList;
     //!Locator List for metatraffic unicast
@@ -191,6 +201,12 @@ public:
     bool remove_reader(
             RTPSReader* rtps_reader);
 
+    /**
+     * Get the TypeLookupManager, creating it if it was deferred and this is its first use.
+     * @return Pointer to the TypeLookupManager, or nullptr if type propagation is disabled.
+     */
+    fastdds::dds::builtin::TypeLookupManager* typelookup_manager();
+
     //! Announce RTPSParticipantState (force the sending of a DPD message.)
     void announceRTPSParticipantState();
     //!Stop the RTPSParticipant Announcement (used in tests to avoid multiple packets being send)
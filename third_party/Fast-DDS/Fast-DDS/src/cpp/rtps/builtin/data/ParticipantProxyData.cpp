@@ -986,6 +986,8 @@ bool ParticipantProxyData::update_data(
     is_alive = true;
     user_data = pdata.user_data;
     properties = pdata.properties;
+    // Builtin endpoints may be created after the first announcement, but are never removed while alive
+    m_available_builtin_endpoints |= pdata.m_available_builtin_endpoints;
 #if HAVE_SECURITY
     identity_token_ = pdata.identity_token_;
     permissions_token_ = pdata.permissions_token_;
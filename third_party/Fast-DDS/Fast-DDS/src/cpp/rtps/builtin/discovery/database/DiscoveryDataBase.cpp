@@ -17,10 +17,13 @@
  *
  */
 
+#include <algorithm>
 #include <mutex>
 #include <set>
+#include <thread>
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/common/EntityId_t.hpp>
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
@@ -29,13 +32,18 @@
 #include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
 
 #include <nlohmann/json.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
+#include <rtps/writer/DeliveryThreadPool.hpp>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 namespace ddb {
 
+constexpr size_t DiscoveryDataBase::min_parallel_matches;
+constexpr uint32_t DiscoveryDataBase::max_matching_threads;
+
 DiscoveryDataBase::DiscoveryDataBase(
         const fastdds::rtps::GuidPrefix_t& server_guid_prefix)
     : server_guid_prefix_(server_guid_prefix)
@@ -60,6 +68,19 @@ DiscoveryDataBase::~DiscoveryDataBase()
     }
 }
 
+void DiscoveryDataBase::init_matching_threads(
+        const fastdds::rtps::ThreadSettings& thread_settings,
+        uint32_t participant_id)
+{
+    uint32_t num_threads = (std::min)(max_matching_threads, (std::max)(std::thread::hardware_concurrency(), 1u));
+    if (1 < num_threads)
+    {
+        // The thread processing the queue takes part on the matching, so it is not included in the pool
+        matching_pool_.reset(new fastdds::rtps::DeliveryThreadPool(num_threads - 1, thread_settings, participant_id,
+                "dds.ddb.%u.%u"));
+    }
+}
+
 void DiscoveryDataBase::add_server(
         fastdds::rtps::GuidPrefix_t server)
 {
@@ -351,10 +372,7 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been processed
         std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        journal_change_(*change);
     }
 
     if (!enabled_)
@@ -383,10 +401,7 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been process
         std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        journal_change_(*change);
     }
 
     if (!enabled_)
@@ -535,6 +550,9 @@ bool DiscoveryDataBase::process_edp_data_queue()
     // Swap DATA queues
     edp_data_queue_.Swap();
 
+    // New endpoints are matched once the whole queue has been processed
+    defer_matches_ = true;
+
     eprosima::fastdds::rtps::CacheChange_t* change;
     std::string topic_name;
 
@@ -546,6 +564,12 @@ bool DiscoveryDataBase::process_edp_data_queue()
         change = data_queue_info.change();
         topic_name = data_queue_info.topic();
 
+        // Keep the order of the changes of each endpoint
+        if (!deferred_match_topics_.empty())
+        {
+            match_deferred_endpoint_(guid_from_change(change));
+        }
+
         // If the change is a DATA(w|r)
         if (change->kind == eprosima::fastdds::rtps::ALIVE)
         {
@@ -583,6 +607,9 @@ bool DiscoveryDataBase::process_edp_data_queue()
         }
     }
 
+    defer_matches_ = false;
+    match_deferred_endpoints_();
+
     return is_dirty_topic;
 }
 
@@ -954,26 +981,12 @@ void DiscoveryDataBase::create_writers_from_change_(
         // we avoid backprogation of the data.
         writer_it->second.add_or_update_ack_participant(ch->writerGUID.guidPrefix, true);
 
-        // if topic is virtual, it must iterate over all readers
-        if (topic_name == virtual_topic_)
+        // Match with the readers in the topic, unless it is left for the end of the EDP queue processing
+        bool topic_exists = defer_matches_ ?
+                defer_match_(writer_guid, topic_name) : match_new_endpoint_(writer_guid, topic_name);
+        if (!topic_exists)
         {
-            for (auto reader_it : readers_)
-            {
-                match_writer_reader_(writer_guid, reader_it.first);
-            }
-        }
-        else
-        {
-            auto readers_it = readers_by_topic_.find(topic_name);
-            if (readers_it == readers_by_topic_.end())
-            {
-                EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Topic error: " << topic_name << ". Must exist.");
-                return;
-            }
-            for (auto reader : readers_it->second)
-            {
-                match_writer_reader_(writer_guid, reader);
-            }
+            return;
         }
         // Update set of dirty_topics
         set_dirty_topic_(topic_name);
@@ -1072,26 +1085,12 @@ void DiscoveryDataBase::create_readers_from_change_(
         // we avoid backprogation of the data.
         reader_it->second.add_or_update_ack_participant(ch->writerGUID.guidPrefix, true);
 
-        // If topic is virtual, it must iterate over all readers
-        if (topic_name == virtual_topic_)
-        {
-            for (auto writer_it : writers_)
-            {
-                match_writer_reader_(writer_it.first, reader_guid);
-            }
-        }
-        else
+        // Match with the writers in the topic, unless it is left for the end of the EDP queue processing
+        bool topic_exists = defer_matches_ ?
+                defer_match_(reader_guid, topic_name) : match_new_endpoint_(reader_guid, topic_name);
+        if (!topic_exists)
         {
-            auto writers_it = writers_by_topic_.find(topic_name);
-            if (writers_it == writers_by_topic_.end())
-            {
-                EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Topic error: " << topic_name << ". Must exist.");
-                return;
-            }
-            for (auto writer : writers_it->second)
-            {
-                match_writer_reader_(writer, reader_guid);
-            }
+            return;
         }
         // Update set of dirty_topics
         set_dirty_topic_(topic_name);
@@ -1140,6 +1139,20 @@ void DiscoveryDataBase::match_writer_reader_(
     }
     DiscoveryParticipantInfo& reader_participant_info = p_rit->second;
 
+    // Only the entities of both GUID prefixes are modified
+    std::mutex& writer_lock = match_lock_(writer_guid.guidPrefix);
+    std::mutex& reader_lock = match_lock_(reader_guid.guidPrefix);
+    std::unique_lock<std::mutex> writer_guard(writer_lock, std::defer_lock);
+    std::unique_lock<std::mutex> reader_guard(reader_lock, std::defer_lock);
+    if (&writer_lock == &reader_lock)
+    {
+        writer_guard.lock();
+    }
+    else
+    {
+        std::lock(writer_guard, reader_guard);
+    }
+
     // virtual              - needs info and give none
     // local                - needs info and give info
     // external             - needs none and give info
@@ -1251,6 +1264,156 @@ void DiscoveryDataBase::match_writer_reader_(
     }
 }
 
+bool DiscoveryDataBase::match_new_endpoint_(
+        const eprosima::fastdds::rtps::GUID_t& guid,
+        const std::string& topic_name)
+{
+    if (is_writer(guid))
+    {
+        // If topic is virtual, it must iterate over all readers
+        if (topic_name == virtual_topic_)
+        {
+            for (auto& reader_it : readers_)
+            {
+                match_writer_reader_(guid, reader_it.first);
+            }
+        }
+        else
+        {
+            auto readers_it = readers_by_topic_.find(topic_name);
+            if (readers_it == readers_by_topic_.end())
+            {
+                EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Topic error: " << topic_name << ". Must exist.");
+                return false;
+            }
+            for (auto& reader : readers_it->second)
+            {
+                match_writer_reader_(guid, reader);
+            }
+        }
+    }
+    else
+    {
+        // If topic is virtual, it must iterate over all writers
+        if (topic_name == virtual_topic_)
+        {
+            for (auto& writer_it : writers_)
+            {
+                match_writer_reader_(writer_it.first, guid);
+            }
+        }
+        else
+        {
+            auto writers_it = writers_by_topic_.find(topic_name);
+            if (writers_it == writers_by_topic_.end())
+            {
+                EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Topic error: " << topic_name << ". Must exist.");
+                return false;
+            }
+            for (auto& writer : writers_it->second)
+            {
+                match_writer_reader_(writer, guid);
+            }
+        }
+    }
+    return true;
+}
+
+bool DiscoveryDataBase::defer_match_(
+        const eprosima::fastdds::rtps::GUID_t& guid,
+        const std::string& topic_name)
+{
+    // The topic is checked now, so the endpoint is not set as dirty when the matching is not possible
+    if (topic_name != virtual_topic_)
+    {
+        const auto& endpoints_by_topic = is_writer(guid) ? readers_by_topic_ : writers_by_topic_;
+        if (endpoints_by_topic.find(topic_name) == endpoints_by_topic.end())
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Topic error: " << topic_name << ". Must exist.");
+            return false;
+        }
+    }
+
+    deferred_matches_[topic_name].push_back(guid);
+    deferred_match_topics_[guid] = topic_name;
+    return true;
+}
+
+void DiscoveryDataBase::match_deferred_endpoint_(
+        const eprosima::fastdds::rtps::GUID_t& guid)
+{
+    auto topic_it = deferred_match_topics_.find(guid);
+    if (topic_it == deferred_match_topics_.end())
+    {
+        return;
+    }
+
+    std::vector<eprosima::fastdds::rtps::GUID_t>& topic_matches = deferred_matches_[topic_it->second];
+    topic_matches.erase(std::find(topic_matches.begin(), topic_matches.end(), guid));
+    match_new_endpoint_(guid, topic_it->second);
+    deferred_match_topics_.erase(topic_it);
+}
+
+void DiscoveryDataBase::match_deferred_endpoints_()
+{
+    // Matchings only modify the ack status of the entities, which is protected by match_locks_.
+    // The maps of the database are not modified meanwhile, so they can be read from several threads.
+    std::vector<const std::pair<const std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>*> topics;
+    topics.reserve(deferred_matches_.size());
+    for (const auto& topic : deferred_matches_)
+    {
+        if (!topic.second.empty())
+        {
+            topics.push_back(&topic);
+        }
+    }
+
+    auto match_topic = [this, &topics](size_t topic_index)
+            {
+                for (const auto& guid : topics[topic_index]->second)
+                {
+                    match_new_endpoint_(guid, topics[topic_index]->first);
+                }
+            };
+
+    if (matching_pool_ && 1 < topics.size() && min_parallel_matches <= deferred_match_topics_.size())
+    {
+        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Matching " << deferred_match_topics_.size() << " endpoints in "
+                                                          << topics.size() << " topics in parallel");
+
+        // Larger topics first, so they do not end up being the last ones
+        std::sort(topics.begin(), topics.end(), [](
+                    const std::pair<const std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>* a,
+                    const std::pair<const std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>* b)
+                {
+                    return a->second.size() > b->second.size();
+                });
+
+        matching_pool_->run(topics.size(), match_topic);
+    }
+    else
+    {
+        for (size_t i = 0; i < topics.size(); ++i)
+        {
+            match_topic(i);
+        }
+    }
+
+    deferred_matches_.clear();
+    deferred_match_topics_.clear();
+}
+
+std::mutex& DiscoveryDataBase::match_lock_(
+        const eprosima::fastdds::rtps::GuidPrefix_t& guid_prefix)
+{
+    size_t index = 0;
+    for (auto octet : guid_prefix.value)
+    {
+        index = index * 31 + octet;
+    }
+    return match_locks_[index % match_locks_.size()];
+}
+
 bool DiscoveryDataBase::set_dirty_topic_(
         const std::string& topic)
 {
@@ -2637,13 +2800,265 @@ bool DiscoveryDataBase::from_json(
     return true;
 }
 
+void DiscoveryDataBase::to_binary(
+        std::vector<fastdds::rtps::octet>& buffer) const
+{
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+    buffer.clear();
+    BinaryBackupWriter writer(buffer);
+    writer.write_header(binary_backup_snapshot_magic);
+
+    // The own server entities are not stored in the db, because in relaunch the must be created again
+    // The number of entities of each kind is written once they have been counted
+    size_t count_position = writer.position();
+    uint32_t count = 0;
+    writer.write_uint32(count);
+    for (const auto& participant : participants_)
+    {
+        if (participant.first != server_guid_prefix_)
+        {
+            writer.write_guid_prefix(participant.first);
+            participant.second.to_binary(writer);
+            ++count;
+        }
+    }
+    writer.write_uint32_at(count_position, count);
+
+    for (const auto* endpoints : {&writers_, &readers_})
+    {
+        count_position = writer.position();
+        count = 0;
+        writer.write_uint32(count);
+        for (const auto& endpoint : *endpoints)
+        {
+            if (endpoint.first.guidPrefix != server_guid_prefix_)
+            {
+                writer.write_guid(endpoint.first);
+                endpoint.second.to_binary(writer);
+                ++count;
+            }
+        }
+        writer.write_uint32_at(count_position, count);
+    }
+}
+
+bool DiscoveryDataBase::check_binary(
+        const fastdds::rtps::octet* data,
+        size_t length)
+{
+    BinaryBackupReader reader(data, length);
+    BinaryBackupChange change_aux;
+    std::vector<std::pair<fastdds::rtps::GuidPrefix_t, bool>> ack_status_aux;
+    std::set<fastdds::rtps::GuidPrefix_t> participants;
+    // Every change is looked up by its instance handle when loading the snapshot
+    std::set<fastdds::rtps::InstanceHandle_t> instance_handles;
+    uint32_t count = 0;
+
+    if (!reader.read_header(binary_backup_snapshot_magic) || !reader.read_uint32(count))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        fastdds::rtps::GuidPrefix_t prefix_aux;
+        DiscoveryParticipantChangeData dpcd;
+        if (!reader.read_guid_prefix(prefix_aux) ||
+                !reader.read_change(change_aux) ||
+                !reader.read_ack_status(ack_status_aux) ||
+                !dpcd.from_binary(reader) ||
+                !instance_handles.insert(change_aux.instance_handle).second)
+        {
+            return false;
+        }
+        participants.insert(prefix_aux);
+    }
+
+    // Writers and then readers, which must belong to a participant of the snapshot
+    for (int kind = 0; kind < 2; ++kind)
+    {
+        if (!reader.read_uint32(count))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            fastdds::rtps::GUID_t guid_aux;
+            std::string topic;
+            if (!reader.read_guid(guid_aux) ||
+                    !reader.read_change(change_aux) ||
+                    !reader.read_ack_status(ack_status_aux) ||
+                    !reader.read_string(topic) ||
+                    participants.count(guid_aux.guidPrefix) == 0 ||
+                    !instance_handles.insert(change_aux.instance_handle).second)
+            {
+                return false;
+            }
+        }
+    }
+
+    // Trailing bytes mean the file is not a snapshot written by to_binary
+    return reader.at_end();
+}
+
+bool DiscoveryDataBase::from_binary(
+        const fastdds::rtps::octet* data,
+        size_t length,
+        std::map<eprosima::fastdds::rtps::InstanceHandle_t, fastdds::rtps::CacheChange_t*>& changes_map)
+{
+    // Changes are taken from changes_map, with already created changes
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Raising DDB from binary Backup");
+
+    BinaryBackupReader reader(data, length);
+    BinaryBackupChange change_aux;
+    std::vector<std::pair<fastdds::rtps::GuidPrefix_t, bool>> ack_status_aux;
+    uint32_t count = 0;
+
+    if (!reader.read_header(binary_backup_snapshot_magic) || !reader.read_uint32(count))
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "BACKUP CORRUPTED");
+        return false;
+    }
+
+    // Participants
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        fastdds::rtps::GuidPrefix_t prefix_aux;
+        DiscoveryParticipantChangeData dpcd;
+        if (!reader.read_guid_prefix(prefix_aux) ||
+                !reader.read_change(change_aux) ||
+                !reader.read_ack_status(ack_status_aux) ||
+                !dpcd.from_binary(reader))
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "BACKUP CORRUPTED");
+            return false;
+        }
+
+        fastdds::rtps::CacheChange_t* change = changes_map[change_aux.instance_handle];
+        if (nullptr == change)
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Participant " << prefix_aux << " without change");
+            return false;
+        }
+
+        // Populate DiscoveryParticipantInfo
+        DiscoveryParticipantInfo dpi(change, server_guid_prefix_, dpcd);
+        for (const auto& ack : ack_status_aux)
+        {
+            dpi.add_or_update_ack_participant(ack.first, ack.second);
+        }
+
+        // Add Participant
+        participants_.insert(std::make_pair(prefix_aux, dpi));
+
+        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Participant " << prefix_aux << " created");
+
+        // In case the change is NOT ALIVE it must be set as dispose so it can be communicate to others and erased
+        if (change->kind != fastdds::rtps::ALIVE)
+        {
+            disposals_.push_back(change);
+        }
+    }
+
+    // Writers and readers
+    for (bool writers : {true, false})
+    {
+        if (!reader.read_uint32(count))
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "BACKUP CORRUPTED");
+            return false;
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            fastdds::rtps::GUID_t guid_aux;
+            std::string topic;
+            if (!reader.read_guid(guid_aux) ||
+                    !reader.read_change(change_aux) ||
+                    !reader.read_ack_status(ack_status_aux) ||
+                    !reader.read_string(topic))
+            {
+                EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "BACKUP CORRUPTED");
+                return false;
+            }
+
+            fastdds::rtps::CacheChange_t* change = changes_map[change_aux.instance_handle];
+            auto part_it = participants_.find(guid_aux.guidPrefix);
+            if (nullptr == change || part_it == participants_.end())
+            {
+                // Endpoint without participant, corrupted DDB
+                EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Endpoint " << guid_aux << " without participant");
+                return false;
+            }
+
+            // Populate DiscoveryEndpointInfo
+            DiscoveryEndpointInfo dei(change, topic, topic == virtual_topic_, server_guid_prefix_);
+            for (const auto& ack : ack_status_aux)
+            {
+                dei.add_or_update_ack_participant(ack.first, ack.second);
+            }
+
+            // Add the endpoint to its participant and to its topic. This will create the topic if necessary
+            if (writers)
+            {
+                writers_.insert(std::make_pair(guid_aux, dei));
+                add_writer_to_topic_(guid_aux, topic);
+                part_it->second.add_writer(guid_aux);
+                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Writer " << guid_aux << " created");
+            }
+            else
+            {
+                readers_.insert(std::make_pair(guid_aux, dei));
+                add_reader_to_topic_(guid_aux, topic);
+                part_it->second.add_reader(guid_aux);
+                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Reader " << guid_aux << " created");
+            }
+
+            if (change->kind != fastdds::rtps::ALIVE)
+            {
+                disposals_.push_back(change);
+            }
+        }
+    }
+
+    // Set dirty topics to all, so next iteration every message pending is sent
+    set_dirty_topic_(virtual_topic_);
+
+    // Announce own server
+    server_acked_by_all(false);
+
+    return true;
+}
+
+void DiscoveryDataBase::journal_change_(
+        const eprosima::fastdds::rtps::CacheChange_t& change)
+{
+    // Each record is preceded by its length, so a record partially written can be detected
+    journal_record_.clear();
+    BinaryBackupWriter writer(journal_record_);
+    writer.write_uint32(0);
+    writer.write_change(change);
+    writer.write_uint32_at(0, static_cast<uint32_t>(journal_record_.size() - 4));
+
+    backup_file_.write(reinterpret_cast<const char*>(journal_record_.data()), journal_record_.size());
+    backup_file_.flush();
+}
+
 void DiscoveryDataBase::clean_backup()
 {
-    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Restoring queue DDB in json backup");
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Restoring queue DDB in binary backup");
 
     // This will erase the last backup stored
     backup_file_.close();
-    backup_file_.open(backup_file_name_, std::ios_base::out);
+    backup_file_.open(backup_file_name_, std::ios_base::out | std::ios_base::binary);
+
+    journal_record_.clear();
+    BinaryBackupWriter writer(journal_record_);
+    writer.write_header(binary_backup_journal_magic);
+    backup_file_.write(reinterpret_cast<const char*>(journal_record_.data()), journal_record_.size());
+    backup_file_.flush();
 }
 
 void DiscoveryDataBase::persistence_enable(
@@ -2652,7 +3067,17 @@ void DiscoveryDataBase::persistence_enable(
     is_persistent_ = true;
     backup_file_name_ = backup_file_name;
     // It opens the file in append mode because the info in it has not been yet
-    backup_file_.open(backup_file_name_, std::ios::app);
+    backup_file_.open(backup_file_name_, std::ios::app | std::ios_base::binary);
+
+    // A new journal starts with its header
+    if (0 == backup_file_.tellp())
+    {
+        journal_record_.clear();
+        BinaryBackupWriter writer(journal_record_);
+        writer.write_header(binary_backup_journal_magic);
+        backup_file_.write(reinterpret_cast<const char*>(journal_record_.data()), journal_record_.size());
+        backup_file_.flush();
+    }
 }
 
 bool DiscoveryDataBase::is_participant_local(
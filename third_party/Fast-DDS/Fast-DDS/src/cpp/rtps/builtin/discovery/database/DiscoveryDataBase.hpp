@@ -20,15 +20,18 @@
 #ifndef _FASTDDS_RTPS_DISCOVERY_DATABASE_H_
 #define _FASTDDS_RTPS_DISCOVERY_DATABASE_H_
 
+#include <array>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <vector>
 
 #include <nlohmann/json.hpp>
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/common/CacheChange.hpp>
 #include <fastdds/rtps/history/WriterHistory.hpp>
 
@@ -42,6 +45,9 @@
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
+
+class DeliveryThreadPool;
+
 namespace ddb {
 
 /**
@@ -142,6 +148,11 @@ public:
         enabled_ = true;
     }
 
+    // start the threads that match the new endpoints of different topics in parallel
+    void init_matching_threads(
+            const fastdds::rtps::ThreadSettings& thread_settings,
+            uint32_t participant_id);
+
     // enable ddb in persistence mode and open the file to backup up in append mode
     void persistence_enable(
             const std::string& backup_file_name);
@@ -301,6 +312,21 @@ public:
             nlohmann::json& j,
             std::map<eprosima::fastdds::rtps::InstanceHandle_t, fastdds::rtps::CacheChange_t*>& changes_map);
 
+    // Dump the database into a binary snapshot, replacing the contents of the buffer
+    void to_binary(
+            std::vector<fastdds::rtps::octet>& buffer) const;
+
+    // Parse a whole binary snapshot without loading it, so a corrupted one is discarded before reserving anything
+    static bool check_binary(
+            const fastdds::rtps::octet* data,
+            size_t length);
+
+    // Load the database from a binary snapshot. Changes are taken from changes_map, like in from_json
+    bool from_binary(
+            const fastdds::rtps::octet* data,
+            size_t length,
+            std::map<eprosima::fastdds::rtps::InstanceHandle_t, fastdds::rtps::CacheChange_t*>& changes_map);
+
     // This function erase the last backup and all the changes that has arrived since then and create
     // a new backup that shows the actual state of the database.
     // This way we can simulate the state of the database from a clean state of json backup, or from
@@ -420,6 +446,29 @@ protected:
             const eprosima::fastdds::rtps::GUID_t& writer_guid,
             const eprosima::fastdds::rtps::GUID_t& reader_guid);
 
+    // match a new endpoint with every endpoint of the other kind in its topic.
+    // Return false if the topic does not exist
+    bool match_new_endpoint_(
+            const eprosima::fastdds::rtps::GUID_t& guid,
+            const std::string& topic_name);
+
+    // leave the matching of a new endpoint for the end of the EDP queue processing.
+    // Return false if the topic does not exist
+    bool defer_match_(
+            const eprosima::fastdds::rtps::GUID_t& guid,
+            const std::string& topic_name);
+
+    // match an endpoint with a deferred matching before processing another change of it
+    void match_deferred_endpoint_(
+            const eprosima::fastdds::rtps::GUID_t& guid);
+
+    // match all the endpoints with a deferred matching, spreading the topics over several threads if they are many
+    void match_deferred_endpoints_();
+
+    // lock protecting the participant and endpoints of a GUID prefix while matching
+    std::mutex& match_lock_(
+            const eprosima::fastdds::rtps::GuidPrefix_t& guid_prefix);
+
     void process_dispose_participant_(
             eprosima::fastdds::rtps::CacheChange_t* ch);
 
@@ -512,6 +561,10 @@ protected:
     bool add_edp_subscriptions_to_send_(
             eprosima::fastdds::rtps::CacheChange_t* change);
 
+    // Append a change to the journal of the backup. Must be called with data_queues_mutex_ locked
+    void journal_change_(
+            const eprosima::fastdds::rtps::CacheChange_t& change);
+
     // Get all the writers in given topic and in virtual topic
     std::vector<eprosima::fastdds::rtps::GUID_t> get_writers_in_topic(
             const std::string& topic_name);
@@ -544,6 +597,26 @@ protected:
     std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo> readers_;
     std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo> writers_;
 
+    //! Whether the matching of new endpoints is being deferred, which happens while processing the EDP queue
+    bool defer_matches_ = false;
+
+    //! New endpoints with a deferred matching, grouped by topic, and the topic of each of them
+    std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>> deferred_matches_;
+    std::map<eprosima::fastdds::rtps::GUID_t, std::string> deferred_match_topics_;
+
+    //! Minimum number of deferred matchings to spread them over several threads
+    static constexpr size_t min_parallel_matches = 256;
+
+    //! Maximum number of threads matching deferred endpoints, including the one processing the queue
+    static constexpr uint32_t max_matching_threads = 8;
+
+    //! Threads matching deferred endpoints together with the one processing the queue
+    std::unique_ptr<fastdds::rtps::DeliveryThreadPool> matching_pool_;
+
+    //! Locks used by match_writer_reader_, each one protecting the entities of the GUID prefixes that map to it.
+    //  Matchings of different topics only share the participants, so they can run in parallel under these locks.
+    std::array<std::mutex, 64> match_locks_;
+
     //! Collection of topics whose related endpoints have changed and require a match recalculation
     std::vector<std::string> dirty_topics_;
 
@@ -593,6 +666,8 @@ protected:
     // This file will keep open to write it fast every time a new cache arrives
     // It needs a flush every time a new change is added
     std::ofstream backup_file_;
+    // Buffer for the journal records, kept to avoid allocations
+    std::vector<fastdds::rtps::octet> journal_record_;
 };
 
 
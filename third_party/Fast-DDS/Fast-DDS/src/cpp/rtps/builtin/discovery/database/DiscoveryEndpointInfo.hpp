@@ -81,6 +81,13 @@ public:
         j["topic"] = topic_;
     }
 
+    void to_binary(
+            BinaryBackupWriter& writer) const
+    {
+        DiscoverySharedInfo::to_binary(writer);
+        writer.write_string(topic_);
+    }
+
 private:
 
     std::string topic_;
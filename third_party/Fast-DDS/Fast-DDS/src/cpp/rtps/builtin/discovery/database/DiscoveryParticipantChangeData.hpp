@@ -24,6 +24,7 @@
 #include <fastdds/dds/core/policy/ParameterTypes.hpp>
 
 #include <nlohmann/json.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
 
 namespace eprosima {
@@ -97,6 +98,24 @@ public:
         j["metatraffic_locators"] = object_to_string(metatraffic_locators_);
     }
 
+    void to_binary(
+            BinaryBackupWriter& writer) const
+    {
+        writer.write_locators(metatraffic_locators_);
+        writer.write_uint8(is_client_ ? 1 : 0);
+        writer.write_uint8(is_superclient_ ? 1 : 0);
+        writer.write_uint8(is_local_ ? 1 : 0);
+    }
+
+    bool from_binary(
+            BinaryBackupReader& reader)
+    {
+        return reader.read_locators(metatraffic_locators_) &&
+               reader.read_bool(is_client_) &&
+               reader.read_bool(is_superclient_) &&
+               reader.read_bool(is_local_);
+    }
+
 private:
 
     // The metatraffic locators of from the serialized payload
@@ -96,6 +96,13 @@ void DiscoveryParticipantInfo::to_json(
     participant_change_data_.to_json(j);
 }
 
+void DiscoveryParticipantInfo::to_binary(
+        BinaryBackupWriter& writer) const
+{
+    DiscoverySharedInfo::to_binary(writer);
+    participant_change_data_.to_binary(writer);
+}
+
 } /* namespace ddb */
 } /* namespace rtps */
 } /* namespace fastdds */
@@ -134,6 +134,9 @@ public:
     void to_json(
             nlohmann::json& j) const;
 
+    void to_binary(
+            BinaryBackupWriter& writer) const;
+
 private:
 
     std::vector<GUID_t> readers_;
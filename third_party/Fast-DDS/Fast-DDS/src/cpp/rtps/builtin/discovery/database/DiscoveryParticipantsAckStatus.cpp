@@ -106,6 +106,17 @@ void DiscoveryParticipantsAckStatus::to_json(
     }
 }
 
+void DiscoveryParticipantsAckStatus::to_binary(
+        BinaryBackupWriter& writer) const
+{
+    writer.write_uint32(static_cast<uint32_t>(relevant_participants_map_.size()));
+    for (auto it = relevant_participants_map_.begin(); it != relevant_participants_map_.end(); ++it)
+    {
+        writer.write_guid_prefix(it->first);
+        writer.write_uint8(it->second ? 1 : 0);
+    }
+}
+
 } /* namespace ddb */
 } /* namespace rtps */
 } /* namespace fastdds */
@@ -26,6 +26,7 @@
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
 
 #include <nlohmann/json.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -67,6 +68,9 @@ public:
     void to_json(
             nlohmann::json& j) const;
 
+    void to_binary(
+            BinaryBackupWriter& writer) const;
+
 private:
 
     std::map<GuidPrefix_t, bool> relevant_participants_map_;
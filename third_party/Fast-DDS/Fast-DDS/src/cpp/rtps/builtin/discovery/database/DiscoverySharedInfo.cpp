@@ -66,6 +66,13 @@ void DiscoverySharedInfo::to_json(
     j["ack_status"] = j_ack;
 }
 
+void DiscoverySharedInfo::to_binary(
+        BinaryBackupWriter& writer) const
+{
+    writer.write_change(*change_);
+    relevant_participants_builtin_ack_status_.to_binary(writer);
+}
+
 } /* namespace ddb */
 } /* namespace rtps */
 } /* namespace fastdds */
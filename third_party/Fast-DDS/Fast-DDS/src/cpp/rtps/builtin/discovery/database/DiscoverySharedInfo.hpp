@@ -102,6 +102,9 @@ public:
     virtual void to_json(
             nlohmann::json& j) const;
 
+    virtual void to_binary(
+            BinaryBackupWriter& writer) const;
+
 protected:
 
     CacheChange_t* change_;
@@ -0,0 +1,510 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryBackupFunctions.cpp
+ *
+ */
+
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
+
+#include <cstring>
+#include <fstream>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+constexpr size_t BinaryBackupReader::locator_size;
+
+void BinaryBackupWriter::write_header(
+        uint32_t magic)
+{
+    write_uint32(magic);
+    write_uint32(binary_backup_version);
+}
+
+void BinaryBackupWriter::write_uint8(
+        uint8_t value)
+{
+    buffer_.push_back(value);
+}
+
+void BinaryBackupWriter::write_uint16(
+        uint16_t value)
+{
+    buffer_.push_back(static_cast<octet>(value));
+    buffer_.push_back(static_cast<octet>(value >> 8));
+}
+
+void BinaryBackupWriter::write_uint32(
+        uint32_t value)
+{
+    buffer_.push_back(static_cast<octet>(value));
+    buffer_.push_back(static_cast<octet>(value >> 8));
+    buffer_.push_back(static_cast<octet>(value >> 16));
+    buffer_.push_back(static_cast<octet>(value >> 24));
+}
+
+void BinaryBackupWriter::write_uint32_at(
+        size_t position,
+        uint32_t value)
+{
+    buffer_[position] = static_cast<octet>(value);
+    buffer_[position + 1] = static_cast<octet>(value >> 8);
+    buffer_[position + 2] = static_cast<octet>(value >> 16);
+    buffer_[position + 3] = static_cast<octet>(value >> 24);
+}
+
+void BinaryBackupWriter::write_bytes(
+        const octet* data,
+        size_t length)
+{
+    if (0 < length)
+    {
+        buffer_.insert(buffer_.end(), data, data + length);
+    }
+}
+
+void BinaryBackupWriter::write_string(
+        const std::string& value)
+{
+    write_uint32(static_cast<uint32_t>(value.size()));
+    write_bytes(reinterpret_cast<const octet*>(value.data()), value.size());
+}
+
+void BinaryBackupWriter::write_guid_prefix(
+        const GuidPrefix_t& guid_prefix)
+{
+    write_bytes(guid_prefix.value, GuidPrefix_t::size);
+}
+
+void BinaryBackupWriter::write_guid(
+        const GUID_t& guid)
+{
+    write_guid_prefix(guid.guidPrefix);
+    write_bytes(guid.entityId.value, EntityId_t::size);
+}
+
+void BinaryBackupWriter::write_sequence_number(
+        const SequenceNumber_t& sequence_number)
+{
+    write_uint32(static_cast<uint32_t>(sequence_number.high));
+    write_uint32(sequence_number.low);
+}
+
+void BinaryBackupWriter::write_time(
+        const Time_t& time)
+{
+    write_uint32(static_cast<uint32_t>(time.seconds()));
+    write_uint32(time.fraction());
+}
+
+void BinaryBackupWriter::write_sample_identity(
+        const SampleIdentity& sample_identity)
+{
+    write_guid(sample_identity.writer_guid());
+    write_sequence_number(sample_identity.sequence_number());
+}
+
+void BinaryBackupWriter::write_locators(
+        const RemoteLocatorList& locators)
+{
+    for (const ResourceLimitedVector<Locator_t>* list : {&locators.unicast, &locators.multicast})
+    {
+        write_uint32(static_cast<uint32_t>(list->size()));
+        for (const Locator_t& locator : *list)
+        {
+            write_uint32(static_cast<uint32_t>(locator.kind));
+            write_uint32(locator.port);
+            write_bytes(locator.address, sizeof(locator.address));
+        }
+    }
+}
+
+void BinaryBackupWriter::write_change(
+        const CacheChange_t& change)
+{
+    write_uint8(static_cast<uint8_t>(change.kind));
+    write_guid(change.writerGUID);
+    write_uint8(change.instanceHandle.isDefined() ? 1 : 0);
+    write_bytes(change.instanceHandle.value, 16);
+    write_sequence_number(change.sequenceNumber);
+    write_uint8(change.isRead ? 1 : 0);
+    write_time(change.sourceTimestamp);
+    write_time(change.reader_info.receptionTimestamp);
+    write_sample_identity(change.write_params.sample_identity());
+    write_sample_identity(change.write_params.related_sample_identity());
+    write_bytes(change.vendor_id.data(), change.vendor_id.size());
+    write_uint16(change.serializedPayload.encapsulation);
+    write_uint32(change.serializedPayload.length);
+    write_bytes(change.serializedPayload.data, change.serializedPayload.length);
+}
+
+void BinaryBackupChange::copy_to(
+        CacheChange_t& change) const
+{
+    change.kind = kind;
+    change.writerGUID = writer_guid;
+    change.instanceHandle = instance_handle;
+    change.sequenceNumber = sequence_number;
+    change.isRead = is_read;
+    change.sourceTimestamp = source_timestamp;
+    change.reader_info.receptionTimestamp = reception_timestamp;
+    change.write_params.sample_identity(sample_identity);
+    change.write_params.related_sample_identity(related_sample_identity);
+    change.vendor_id = vendor_id;
+    change.serializedPayload.encapsulation = encapsulation;
+    change.serializedPayload.length = length;
+    if (0 < length)
+    {
+        memcpy(change.serializedPayload.data, data, length);
+    }
+}
+
+bool BinaryBackupReader::read_header(
+        uint32_t magic)
+{
+    uint32_t file_magic = 0;
+    uint32_t version = 0;
+    return read_uint32(file_magic) && magic == file_magic &&
+           read_uint32(version) && binary_backup_version == version;
+}
+
+bool BinaryBackupReader::read_uint8(
+        uint8_t& value)
+{
+    if (length_ - position_ < 1)
+    {
+        return false;
+    }
+    value = data_[position_++];
+    return true;
+}
+
+bool BinaryBackupReader::read_bool(
+        bool& value)
+{
+    uint8_t byte = 0;
+    if (!read_uint8(byte))
+    {
+        return false;
+    }
+    value = 0 != byte;
+    return true;
+}
+
+bool BinaryBackupReader::read_uint16(
+        uint16_t& value)
+{
+    if (length_ - position_ < 2)
+    {
+        return false;
+    }
+    value = static_cast<uint16_t>(data_[position_] | (data_[position_ + 1] << 8));
+    position_ += 2;
+    return true;
+}
+
+bool BinaryBackupReader::read_uint32(
+        uint32_t& value)
+{
+    if (length_ - position_ < 4)
+    {
+        return false;
+    }
+    value = static_cast<uint32_t>(data_[position_]) |
+            (static_cast<uint32_t>(data_[position_ + 1]) << 8) |
+            (static_cast<uint32_t>(data_[position_ + 2]) << 16) |
+            (static_cast<uint32_t>(data_[position_ + 3]) << 24);
+    position_ += 4;
+    return true;
+}
+
+bool BinaryBackupReader::read_string(
+        std::string& value)
+{
+    uint32_t length = 0;
+    if (!read_uint32(length) || length_ - position_ < length)
+    {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char*>(&data_[position_]), length);
+    position_ += length;
+    return true;
+}
+
+bool BinaryBackupReader::read_guid_prefix(
+        GuidPrefix_t& guid_prefix)
+{
+    if (length_ - position_ < GuidPrefix_t::size)
+    {
+        return false;
+    }
+    memcpy(guid_prefix.value, &data_[position_], GuidPrefix_t::size);
+    position_ += GuidPrefix_t::size;
+    return true;
+}
+
+bool BinaryBackupReader::read_guid(
+        GUID_t& guid)
+{
+    if (!read_guid_prefix(guid.guidPrefix) || length_ - position_ < EntityId_t::size)
+    {
+        return false;
+    }
+    memcpy(guid.entityId.value, &data_[position_], EntityId_t::size);
+    position_ += EntityId_t::size;
+    return true;
+}
+
+bool BinaryBackupReader::read_sequence_number(
+        SequenceNumber_t& sequence_number)
+{
+    uint32_t high = 0;
+    if (!read_uint32(high) || !read_uint32(sequence_number.low))
+    {
+        return false;
+    }
+    sequence_number.high = static_cast<int32_t>(high);
+    return true;
+}
+
+bool BinaryBackupReader::read_time(
+        Time_t& time)
+{
+    uint32_t seconds = 0;
+    uint32_t fraction = 0;
+    if (!read_uint32(seconds) || !read_uint32(fraction))
+    {
+        return false;
+    }
+    time = Time_t(static_cast<int32_t>(seconds), fraction);
+    return true;
+}
+
+bool BinaryBackupReader::read_sample_identity(
+        SampleIdentity& sample_identity)
+{
+    return read_guid(sample_identity.writer_guid()) && read_sequence_number(sample_identity.sequence_number());
+}
+
+bool BinaryBackupReader::read_locators(
+        RemoteLocatorList& locators)
+{
+    // The lists are created with room for all their locators, so both sizes are read first
+    uint32_t num_unicast = 0;
+    uint32_t num_multicast = 0;
+    size_t unicast_position = position_;
+    if (!read_uint32(num_unicast) ||
+            !skip(static_cast<size_t>(num_unicast) * locator_size) ||
+            !read_uint32(num_multicast) ||
+            !skip(static_cast<size_t>(num_multicast) * locator_size))
+    {
+        return false;
+    }
+    size_t end_position = position_;
+
+    locators = RemoteLocatorList(num_unicast, num_multicast);
+    position_ = unicast_position + 4;
+    for (uint32_t i = 0; i < num_unicast; ++i)
+    {
+        locators.unicast.push_back(read_locator_());
+    }
+    position_ += 4;
+    for (uint32_t i = 0; i < num_multicast; ++i)
+    {
+        locators.multicast.push_back(read_locator_());
+    }
+
+    position_ = end_position;
+    return true;
+}
+
+bool BinaryBackupReader::read_change(
+        BinaryBackupChange& change)
+{
+    uint8_t kind = 0;
+    bool has_instance_handle = false;
+    if (!read_uint8(kind) ||
+            !read_guid(change.writer_guid) ||
+            !read_bool(has_instance_handle) ||
+            length_ - position_ < 16)
+    {
+        return false;
+    }
+    change.kind = static_cast<ChangeKind_t>(kind);
+
+    change.instance_handle.clear();
+    if (has_instance_handle)
+    {
+        for (size_t i = 0; i < 16; ++i)
+        {
+            change.instance_handle.value[i] = data_[position_ + i];
+        }
+    }
+    position_ += 16;
+
+    if (!read_sequence_number(change.sequence_number) ||
+            !read_bool(change.is_read) ||
+            !read_time(change.source_timestamp) ||
+            !read_time(change.reception_timestamp) ||
+            !read_sample_identity(change.sample_identity) ||
+            !read_sample_identity(change.related_sample_identity) ||
+            !read_uint8(change.vendor_id[0]) ||
+            !read_uint8(change.vendor_id[1]) ||
+            !read_uint16(change.encapsulation) ||
+            !read_uint32(change.length) ||
+            length_ - position_ < change.length)
+    {
+        return false;
+    }
+    change.data = &data_[position_];
+    position_ += change.length;
+    return true;
+}
+
+bool BinaryBackupReader::read_ack_status(
+        std::vector<std::pair<GuidPrefix_t, bool>>& ack_status)
+{
+    uint32_t num_participants = 0;
+    if (!read_uint32(num_participants))
+    {
+        return false;
+    }
+
+    ack_status.clear();
+    for (uint32_t i = 0; i < num_participants; ++i)
+    {
+        GuidPrefix_t guid_prefix;
+        bool is_acked = false;
+        if (!read_guid_prefix(guid_prefix) || !read_bool(is_acked))
+        {
+            return false;
+        }
+        ack_status.emplace_back(guid_prefix, is_acked);
+    }
+    return true;
+}
+
+Locator_t BinaryBackupReader::read_locator_()
+{
+    Locator_t locator;
+    uint32_t kind = 0;
+    read_uint32(kind);
+    locator.kind = static_cast<int32_t>(kind);
+    read_uint32(locator.port);
+    memcpy(locator.address, &data_[position_], sizeof(locator.address));
+    position_ += sizeof(locator.address);
+    return locator;
+}
+
+bool BinaryBackupReader::skip(
+        size_t length)
+{
+    if (length_ - position_ < length)
+    {
+        return false;
+    }
+    position_ += length;
+    return true;
+}
+
+BinaryBackupFile::~BinaryBackupFile()
+{
+    close();
+}
+
+bool BinaryBackupFile::open(
+        const std::string& file_name)
+{
+    close();
+
+#if defined(__linux__)
+    int fd = ::open(file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat file_stat;
+    if (0 == fstat(fd, &file_stat) && 0 < file_stat.st_size)
+    {
+        void* memory = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED != memory)
+        {
+            // The snapshot is parsed from the beginning to the end
+            madvise(memory, static_cast<size_t>(file_stat.st_size), MADV_SEQUENTIAL);
+            data_ = static_cast<const octet*>(memory);
+            size_ = static_cast<size_t>(file_stat.st_size);
+            is_mapped_ = true;
+        }
+    }
+    // The mapping stays valid after closing the descriptor
+    ::close(fd);
+    if (is_mapped_)
+    {
+        return true;
+    }
+#endif // if defined(__linux__)
+
+    std::ifstream file(file_name, std::ios_base::in | std::ios_base::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    file.seekg(0, std::ios_base::end);
+    std::streamoff size = file.tellg();
+    if (size <= 0)
+    {
+        return false;
+    }
+    buffer_.resize(static_cast<size_t>(size));
+    file.seekg(0, std::ios_base::beg);
+    if (!file.read(reinterpret_cast<char*>(buffer_.data()), size))
+    {
+        buffer_.clear();
+        return false;
+    }
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    return true;
+}
+
+void BinaryBackupFile::close()
+{
+#if defined(__linux__)
+    if (is_mapped_)
+    {
+        munmap(const_cast<octet*>(data_), size_);
+        is_mapped_ = false;
+    }
+#endif // if defined(__linux__)
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+    data_ = nullptr;
+    size_ = 0;
+}
+
+} /* ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
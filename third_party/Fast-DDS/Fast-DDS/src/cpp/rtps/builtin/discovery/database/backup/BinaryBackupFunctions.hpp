@@ -0,0 +1,291 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryBackupFunctions.hpp
+ *
+ */
+
+#ifndef FASTDDS_RTPS_BUILTIN_DISCOVERY_DATABASE_BACKUP__BINARYBACKUPFUNCTIONS_HPP
+#define FASTDDS_RTPS_BUILTIN_DISCOVERY_DATABASE_BACKUP__BINARYBACKUPFUNCTIONS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.hpp>
+#include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/RemoteLocators.hpp>
+#include <fastdds/rtps/common/SampleIdentity.hpp>
+#include <fastdds/rtps/common/SequenceNumber.hpp>
+#include <fastdds/rtps/common/Time_t.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+// Binary backup of the Discovery Data Base
+//
+// Every value is stored little endian with a fixed size, and there are no offsets nor padding, so a file can be
+// read in a single operation (or mapped) and parsed in place.
+// Both files start with a magic number and the version of the format:
+/*
+   snapshot:
+    <magic "FDDB"> <version>
+    <num participants> { <guid_prefix> <change> <ack_status> <metatraffic_locators>
+                         <is_client> <is_superclient> <is_local> }
+    <num writers> { <guid> <change> <ack_status> <topic> }
+    <num readers> { <guid> <change> <ack_status> <topic> }
+
+   journal:
+    <magic "FDDJ"> <version>
+    { <record length> <change> }
+
+   change:
+    <kind> <writer_GUID> <instance_handle> <sequence_number> <isRead> <source_timestamp> <reception_timestamp>
+    <sample_identity> <related_sample_identity> <vendor_id> <encapsulation> <length> <data>
+
+   ack_status:
+    <num participants> { <guid_prefix> <is_acked> }
+ */
+
+//! Magic number of the snapshot of the database
+constexpr uint32_t binary_backup_snapshot_magic = 0x42444446; // "FDDB"
+
+//! Magic number of the journal of changes received after the last snapshot
+constexpr uint32_t binary_backup_journal_magic = 0x4A444446; // "FDDJ"
+
+//! Version of the binary backup format
+constexpr uint32_t binary_backup_version = 1;
+
+// Appends binary backup values to a buffer
+class BinaryBackupWriter
+{
+public:
+
+    explicit BinaryBackupWriter(
+            std::vector<octet>& buffer)
+        : buffer_(buffer)
+    {
+    }
+
+    void write_header(
+            uint32_t magic);
+
+    void write_uint8(
+            uint8_t value);
+
+    void write_uint16(
+            uint16_t value);
+
+    void write_uint32(
+            uint32_t value);
+
+    // Overwrite a value already written, like a number of elements not known beforehand
+    void write_uint32_at(
+            size_t position,
+            uint32_t value);
+
+    void write_bytes(
+            const octet* data,
+            size_t length);
+
+    void write_string(
+            const std::string& value);
+
+    void write_guid_prefix(
+            const GuidPrefix_t& guid_prefix);
+
+    void write_guid(
+            const GUID_t& guid);
+
+    void write_sequence_number(
+            const SequenceNumber_t& sequence_number);
+
+    void write_time(
+            const Time_t& time);
+
+    void write_sample_identity(
+            const SampleIdentity& sample_identity);
+
+    void write_locators(
+            const RemoteLocatorList& locators);
+
+    void write_change(
+            const CacheChange_t& change);
+
+    size_t position() const
+    {
+        return buffer_.size();
+    }
+
+private:
+
+    std::vector<octet>& buffer_;
+};
+
+// Change read from a binary backup. The payload is not copied, it points to the backup buffer
+struct BinaryBackupChange
+{
+    ChangeKind_t kind = ALIVE;
+    GUID_t writer_guid;
+    InstanceHandle_t instance_handle;
+    SequenceNumber_t sequence_number;
+    bool is_read = false;
+    Time_t source_timestamp;
+    Time_t reception_timestamp;
+    SampleIdentity sample_identity;
+    SampleIdentity related_sample_identity;
+    VendorId_t vendor_id = c_VendorId_Unknown;
+    uint16_t encapsulation = 0;
+    uint32_t length = 0;
+    const octet* data = nullptr;
+
+    // Copy the info into a change, which must have reserved at least length bytes of payload
+    void copy_to(
+            CacheChange_t& change) const;
+};
+
+// Reads binary backup values from a buffer. Every function returns false when the buffer is not long enough
+class BinaryBackupReader
+{
+public:
+
+    BinaryBackupReader(
+            const octet* data,
+            size_t length)
+        : data_(data)
+        , length_(length)
+    {
+    }
+
+    // Check the magic number and the version
+    bool read_header(
+            uint32_t magic);
+
+    bool read_uint8(
+            uint8_t& value);
+
+    bool read_bool(
+            bool& value);
+
+    bool read_uint16(
+            uint16_t& value);
+
+    bool read_uint32(
+            uint32_t& value);
+
+    bool read_string(
+            std::string& value);
+
+    bool read_guid_prefix(
+            GuidPrefix_t& guid_prefix);
+
+    bool read_guid(
+            GUID_t& guid);
+
+    bool read_sequence_number(
+            SequenceNumber_t& sequence_number);
+
+    bool read_time(
+            Time_t& time);
+
+    bool read_sample_identity(
+            SampleIdentity& sample_identity);
+
+    bool read_locators(
+            RemoteLocatorList& locators);
+
+    bool read_change(
+            BinaryBackupChange& change);
+
+    bool read_ack_status(
+            std::vector<std::pair<GuidPrefix_t, bool>>& ack_status);
+
+    bool skip(
+            size_t length);
+
+    bool at_end() const
+    {
+        return position_ == length_;
+    }
+
+    size_t position() const
+    {
+        return position_;
+    }
+
+private:
+
+    //! Size of a locator: kind, port and address
+    static constexpr size_t locator_size = 24;
+
+    // Read a locator whose size has already been checked
+    Locator_t read_locator_();
+
+    const octet* data_;
+    size_t length_;
+    size_t position_ = 0;
+};
+
+// Read only view of a whole backup file. The file is mapped in memory where the platform allows it, so a large
+// snapshot is parsed in place without copying it, and read into a buffer otherwise
+class BinaryBackupFile
+{
+public:
+
+    BinaryBackupFile() = default;
+
+    ~BinaryBackupFile();
+
+    BinaryBackupFile(
+            const BinaryBackupFile&) = delete;
+
+    BinaryBackupFile& operator =(
+            const BinaryBackupFile&) = delete;
+
+    // Return false if the file cannot be read or it is empty
+    bool open(
+            const std::string& file_name);
+
+    void close();
+
+    const octet* data() const
+    {
+        return data_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+private:
+
+    const octet* data_ = nullptr;
+    size_t size_ = 0;
+    bool is_mapped_ = false;
+    std::vector<octet> buffer_;
+};
+
+} /* ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif // FASTDDS_RTPS_BUILTIN_DISCOVERY_DATABASE_BACKUP__BINARYBACKUPFUNCTIONS_HPP
@@ -51,7 +51,6 @@
 #endif // if HAVE_SECURITY
 #include <rtps/writer/BaseWriter.hpp>
 #include <utils/collections/node_size_helpers.hpp>
-#include <utils/StringMatching.hpp>
 #ifdef FASTDDS_STATISTICS
 #include <statistics/rtps/monitor-service/interfaces/IProxyObserver.hpp>
 #endif //FASTDDS_STATISTICS
@@ -83,6 +82,15 @@ static bool is_same_type(
            && t1.minimal().typeid_with_size() == t2.minimal().typeid_with_size());
 }
 
+//! Result of matching a remote endpoint with a local one, computed while the PDP mutex is taken
+struct LocalEndpointMatching
+{
+    GUID_t guid;
+    bool valid = false;
+    EDP::MatchingFailureMask no_match_reason;
+    fastdds::dds::PolicyMask incompatible_qos;
+};
+
 EDP::EDP(
         PDP* p,
         RTPSParticipantImpl* part)
@@ -727,23 +735,7 @@ bool EDP::valid_matching(
     }
     else
     {
-        for (auto wnameit = wdata->partition.begin();
-                wnameit !=  wdata->partition.end(); ++wnameit)
-        {
-            for (auto rnameit = rdata->partition.begin();
-                    rnameit != rdata->partition.end(); ++rnameit)
-            {
-                if (StringMatching::matchString(wnameit->name(), rnameit->name()))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-            if (matched)
-            {
-                break;
-            }
-        }
+        matched = partition_matcher_.match(wdata->partition, rdata->partition);
     }
     if (!matched) //Different partitions
     {
@@ -835,74 +827,80 @@ bool EDP::pairingReader(
     EPROSIMA_LOG_INFO(RTPS_EDP, rdata.guid << " in topic: \"" << rdata.topic_name << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-    if (!this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints())
+    const PDP::TopicProxies* topic = mp_PDP->topic_proxies(rdata.topic_name.to_string());
+    if (nullptr == topic)
     {
-        pit++;
+        return true;
     }
 
-    for (; pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    // Only the writers on the same topic may match
+    bool match_local_endpoints = mp_PDP->getRTPSParticipant()->should_match_local_endpoints();
+    const GuidPrefix_t& local_prefix = mp_PDP->getRTPSParticipant()->getGuid().guidPrefix;
+    for (size_t i = 0; i < topic->writers.size(); ++i)
     {
-        for (auto& pair : *(*pit)->m_writers)
+        WriterProxyData* wdatait = topic->writers[i];
+        if (!match_local_endpoints && wdatait->guid.guidPrefix == local_prefix)
+        {
+            continue;
+        }
+
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
+        const GUID_t& reader_guid = reader->getGuid();
+        const GUID_t& writer_guid = wdatait->guid;
+
+        if (valid)
         {
-            WriterProxyData* wdatait = pair.second;
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
-            const GUID_t& reader_guid = reader->getGuid();
-            const GUID_t& writer_guid = wdatait->guid;
-
-            if (valid)
-            {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_writer(reader_guid, (*pit)->guid,
-                        *wdatait, reader->getAttributes().security_attributes()))
-                {
-                    EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
-                }
+            GUID_t remote_participant_guid(wdatait->guid.guidPrefix, c_EntityId_RTPSParticipant);
+            if (!mp_RTPSParticipant->security_manager().discovered_writer(reader_guid, remote_participant_guid,
+                    *wdatait, reader->getAttributes().security_attributes()))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
+            }
 #else
-                if (reader->matched_writer_add_edp(*wdatait))
+            if (reader->matched_writer_add_edp(*wdatait))
+            {
+                static_cast<void>(reader_guid);  // Void cast to force usage if we don't have LOG_INFOs
+                EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
+                        "WP:" << wdatait->guid << " match R:" << reader_guid << ". RLoc:" <<
+                        wdatait->remote_locators);
+                //MATCHED AND ADDED CORRECTLY:
+                if (reader->get_listener() != nullptr)
                 {
-                    static_cast<void>(reader_guid);  // Void cast to force usage if we don't have LOG_INFOs
-                    EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
-                            "WP:" << wdatait->guid << " match R:" << reader_guid << ". RLoc:" <<
-                            wdatait->remote_locators);
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (reader->get_listener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        reader->get_listener()->on_reader_matched(reader, info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    reader->get_listener()->on_reader_matched(reader, info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && reader->get_listener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && reader->get_listener() != nullptr)
-                {
-                    reader->get_listener()->on_requested_incompatible_qos(reader, incompatible_qos);
-                    mp_PDP->notify_incompatible_qos_matching(R->getGuid(), wdatait->guid, incompatible_qos);
-                }
+                reader->get_listener()->on_requested_incompatible_qos(reader, incompatible_qos);
+                mp_PDP->notify_incompatible_qos_matching(R->getGuid(), wdatait->guid, incompatible_qos);
+            }
 
-                //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->guid<<RTPS_DEF<<endl);
-                if (reader->matched_writer_is_matched(wdatait->guid)
-                        && reader->matched_writer_remove(wdatait->guid))
-                {
+            //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->guid<<RTPS_DEF<<endl);
+            if (reader->matched_writer_is_matched(wdatait->guid)
+                    && reader->matched_writer_remove(wdatait->guid))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
-                            wdatait->guid);
+                mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
+                        wdatait->guid);
 #endif // if HAVE_SECURITY
 
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (reader->get_listener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        reader->get_listener()->on_reader_matched(reader, info);
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if (reader->get_listener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    reader->get_listener()->on_reader_matched(reader, info);
                 }
             }
         }
@@ -925,74 +923,80 @@ bool EDP::pairingWriter(
     EPROSIMA_LOG_INFO(RTPS_EDP, writer_guid << " in topic: \"" << wdata.topic_name << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-    if (!this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints())
+    const PDP::TopicProxies* topic = mp_PDP->topic_proxies(wdata.topic_name.to_string());
+    if (nullptr == topic)
     {
-        pit++;
+        return true;
     }
 
-    for (; pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    // Only the readers on the same topic may match
+    bool match_local_endpoints = mp_PDP->getRTPSParticipant()->should_match_local_endpoints();
+    const GuidPrefix_t& local_prefix = mp_PDP->getRTPSParticipant()->getGuid().guidPrefix;
+    for (size_t i = 0; i < topic->readers.size(); ++i)
     {
-        for (auto& pair : *(*pit)->m_readers)
+        ReaderProxyData* rdatait = topic->readers[i];
+        if (!match_local_endpoints && rdatait->guid.guidPrefix == local_prefix)
         {
-            ReaderProxyData* rdatait = pair.second;
-            const GUID_t& reader_guid = rdatait->guid;
-            if (reader_guid == c_Guid_Unknown)
-            {
-                continue;
-            }
+            continue;
+        }
+
+        const GUID_t& reader_guid = rdatait->guid;
+        if (reader_guid == c_Guid_Unknown)
+        {
+            continue;
+        }
 
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
 
-            if (valid)
-            {
+        if (valid)
+        {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_reader(writer_guid, (*pit)->guid,
-                        *rdatait, writer->getAttributes().security_attributes()))
-                {
-                    EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for writer " << writer_guid);
-                }
+            GUID_t remote_participant_guid(rdatait->guid.guidPrefix, c_EntityId_RTPSParticipant);
+            if (!mp_RTPSParticipant->security_manager().discovered_reader(writer_guid, remote_participant_guid,
+                    *rdatait, writer->getAttributes().security_attributes()))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for writer " << writer_guid);
+            }
 #else
-                if (writer->matched_reader_add_edp(*rdatait))
+            if (writer->matched_reader_add_edp(*rdatait))
+            {
+                EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
+                        "RP:" << rdatait->guid << " match W:" << writer_guid << ". WLoc:" <<
+                        rdatait->remote_locators);
+                //MATCHED AND ADDED CORRECTLY:
+                if (writer->get_listener() != nullptr)
                 {
-                    EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
-                            "RP:" << rdatait->guid << " match W:" << writer_guid << ". WLoc:" <<
-                            rdatait->remote_locators);
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (writer->get_listener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        writer->get_listener()->on_writer_matched(writer, info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    writer->get_listener()->on_writer_matched(writer, info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && writer->get_listener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && writer->get_listener() != nullptr)
-                {
-                    writer->get_listener()->on_offered_incompatible_qos(writer, incompatible_qos);
-                    mp_PDP->notify_incompatible_qos_matching(W->getGuid(), rdatait->guid, incompatible_qos);
-                }
+                writer->get_listener()->on_offered_incompatible_qos(writer, incompatible_qos);
+                mp_PDP->notify_incompatible_qos_matching(W->getGuid(), rdatait->guid, incompatible_qos);
+            }
 
-                //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->guid<<RTPS_DEF<<endl);
-                if (writer->matched_reader_is_matched(reader_guid) && writer->matched_reader_remove(reader_guid))
-                {
+            //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->guid<<RTPS_DEF<<endl);
+            if (writer->matched_reader_is_matched(reader_guid) && writer->matched_reader_remove(reader_guid))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_reader(writer_guid, participant_guid, reader_guid);
+                mp_RTPSParticipant->security_manager().remove_reader(writer_guid, participant_guid, reader_guid);
 #endif // if HAVE_SECURITY
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (writer->get_listener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        writer->get_listener()->on_writer_matched(writer, info);
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if (writer->get_listener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    writer->get_listener()->on_writer_matched(writer, info);
                 }
             }
         }
@@ -1008,74 +1012,90 @@ bool EDP::pairing_reader_proxy_with_any_local_writer(
 
     EPROSIMA_LOG_INFO(RTPS_EDP, rdata->guid << " in topic: \"" << rdata->topic_name << "\"");
 
-    mp_RTPSParticipant->forEachUserWriter([&, rdata](BaseWriter& w) -> bool
-            {
-                auto temp_writer_proxy_data = get_temporary_writer_proxies_pool().get();
-                GUID_t writerGUID = w.getGuid();
+    // Only the local writers on the same topic may match. The matching is computed with the PDP mutex taken,
+    // and the writers are updated once it is released, as the participant's endpoint list is locked before it.
+    std::vector<LocalEndpointMatching> local_writers;
+    {
+        std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-                if (mp_PDP->lookupWriterProxyData(writerGUID, *temp_writer_proxy_data))
-                {
-                    MatchingFailureMask no_match_reason;
-                    fastdds::dds::PolicyMask incompatible_qos;
-                    bool valid = valid_matching(temp_writer_proxy_data.get(), rdata, no_match_reason, incompatible_qos);
-                    const GUID_t& reader_guid = rdata->guid;
+        const PDP::TopicProxies* topic = mp_PDP->topic_proxies(rdata->topic_name.to_string());
+        if (nullptr == topic)
+        {
+            return true;
+        }
+
+        const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
+        for (WriterProxyData* wdata : topic->writers)
+        {
+            if (wdata->guid.guidPrefix == local_prefix)
+            {
+                local_writers.emplace_back();
+                LocalEndpointMatching& matching = local_writers.back();
+                matching.guid = wdata->guid;
+                matching.valid = valid_matching(wdata, rdata, matching.no_match_reason, matching.incompatible_qos);
+            }
+        }
+    }
 
-                    temp_writer_proxy_data.reset();
+    const GUID_t& reader_guid = rdata->guid;
+    for (const LocalEndpointMatching& matching : local_writers)
+    {
+        BaseWriter* w = mp_RTPSParticipant->find_local_writer(matching.guid);
+        if (nullptr == w)
+        {
+            continue;
+        }
 
-                    if (valid)
-                    {
+        if (matching.valid)
+        {
 #if HAVE_SECURITY
-                        if (!mp_RTPSParticipant->security_manager().discovered_reader(writerGUID, participant_guid,
-                        *rdata, w.getAttributes().security_attributes()))
-                        {
-                            EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for writer " << writerGUID);
-                        }
+            if (!mp_RTPSParticipant->security_manager().discovered_reader(matching.guid, participant_guid,
+                    *rdata, w->getAttributes().security_attributes()))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for writer " << matching.guid);
+            }
 #else
-                        if (w.matched_reader_add_edp(*rdata))
-                        {
-                            EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
-                            "RP:" << rdata->guid << " match W:" << w.getGuid() << ". RLoc:" <<
-                                rdata->remote_locators);
-                            //MATCHED AND ADDED CORRECTLY:
-                            if (w.get_listener() != nullptr)
-                            {
-                                MatchingInfo info;
-                                info.status = MATCHED_MATCHING;
-                                info.remoteEndpointGuid = reader_guid;
-                                w.get_listener()->on_writer_matched(&w, info);
-                            }
-                        }
+            if (w->matched_reader_add_edp(*rdata))
+            {
+                EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
+                        "RP:" << rdata->guid << " match W:" << matching.guid << ". RLoc:" <<
+                        rdata->remote_locators);
+                //MATCHED AND ADDED CORRECTLY:
+                if (w->get_listener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    w->get_listener()->on_writer_matched(w, info);
+                }
+            }
 #endif // if HAVE_SECURITY
-                    }
-                    else
-                    {
-                        if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && w.get_listener() != nullptr)
-                        {
-                            w.get_listener()->on_offered_incompatible_qos(&w, incompatible_qos);
-                            mp_PDP->notify_incompatible_qos_matching(w.getGuid(), rdata->guid, incompatible_qos);
-                        }
+        }
+        else
+        {
+            if (matching.no_match_reason.test(MatchingFailureMask::incompatible_qos) && w->get_listener() != nullptr)
+            {
+                w->get_listener()->on_offered_incompatible_qos(w, matching.incompatible_qos);
+                mp_PDP->notify_incompatible_qos_matching(matching.guid, rdata->guid, matching.incompatible_qos);
+            }
 
-                        if (w.matched_reader_is_matched(reader_guid)
-                        && w.matched_reader_remove(reader_guid))
-                        {
+            if (w->matched_reader_is_matched(reader_guid)
+                    && w->matched_reader_remove(reader_guid))
+            {
 #if HAVE_SECURITY
-                            mp_RTPSParticipant->security_manager().remove_reader(
-                                w.getGuid(), participant_guid, reader_guid);
+                mp_RTPSParticipant->security_manager().remove_reader(matching.guid, participant_guid, reader_guid);
 #endif // if HAVE_SECURITY
-                            //MATCHED AND ADDED CORRECTLY:
-                            if (w.get_listener() != nullptr)
-                            {
-                                MatchingInfo info;
-                                info.status = REMOVED_MATCHING;
-                                info.remoteEndpointGuid = reader_guid;
-                                w.get_listener()->on_writer_matched(&w, info);
-                            }
-                        }
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if (w->get_listener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    w->get_listener()->on_writer_matched(w, info);
                 }
-                // next iteration
-                return true;
-            });
+            }
+        }
+    }
 
     return true;
 }
@@ -1201,74 +1221,92 @@ bool EDP::pairing_writer_proxy_with_any_local_reader(
 
     EPROSIMA_LOG_INFO(RTPS_EDP, wdata->guid << " in topic: \"" << wdata->topic_name << "\"");
 
-    mp_RTPSParticipant->forEachUserReader([&, wdata](BaseReader& r) -> bool
-            {
-                auto temp_reader_proxy_data = get_temporary_reader_proxies_pool().get();
-                GUID_t readerGUID = r.getGuid();
+    // Only the local readers on the same topic may match. The matching is computed with the PDP mutex taken,
+    // and the readers are updated once it is released, as the participant's endpoint list is locked before it.
+    std::vector<LocalEndpointMatching> local_readers;
+    {
+        std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-                if (mp_PDP->lookupReaderProxyData(readerGUID, *temp_reader_proxy_data))
-                {
-                    MatchingFailureMask no_match_reason;
-                    fastdds::dds::PolicyMask incompatible_qos;
-                    bool valid = valid_matching(temp_reader_proxy_data.get(), wdata, no_match_reason, incompatible_qos);
-                    const GUID_t& writer_guid = wdata->guid;
+        const PDP::TopicProxies* topic = mp_PDP->topic_proxies(wdata->topic_name.to_string());
+        if (nullptr == topic)
+        {
+            return true;
+        }
+
+        const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
+        for (ReaderProxyData* rdata : topic->readers)
+        {
+            if (rdata->guid.guidPrefix == local_prefix)
+            {
+                local_readers.emplace_back();
+                LocalEndpointMatching& matching = local_readers.back();
+                matching.guid = rdata->guid;
+                matching.valid = valid_matching(rdata, wdata, matching.no_match_reason, matching.incompatible_qos);
+            }
+        }
+    }
 
-                    temp_reader_proxy_data.reset();
+    const GUID_t& writer_guid = wdata->guid;
+    for (const LocalEndpointMatching& matching : local_readers)
+    {
+        // Keeps the reader alive while it is updated
+        LocalReaderPointer::Instance local_reader(mp_RTPSParticipant->find_local_reader(matching.guid));
+        if (!local_reader)
+        {
+            continue;
+        }
+        BaseReader* r = local_reader.operator ->();
 
-                    if (valid)
-                    {
+        if (matching.valid)
+        {
 #if HAVE_SECURITY
-                        if (!mp_RTPSParticipant->security_manager().discovered_writer(readerGUID, participant_guid,
-                        *wdata, r.getAttributes().security_attributes()))
-                        {
-                            EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for reader " << readerGUID);
-                        }
+            if (!mp_RTPSParticipant->security_manager().discovered_writer(matching.guid, participant_guid,
+                    *wdata, r->getAttributes().security_attributes()))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for reader " << matching.guid);
+            }
 #else
-                        if (r.matched_writer_add_edp(*wdata))
-                        {
-                            EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
-                            "WP:" << wdata->guid << " match R:" << r.getGuid() << ". WLoc:" <<
-                                wdata->remote_locators);
-                            //MATCHED AND ADDED CORRECTLY:
-                            if (r.get_listener() != nullptr)
-                            {
-                                MatchingInfo info;
-                                info.status = MATCHED_MATCHING;
-                                info.remoteEndpointGuid = writer_guid;
-                                r.get_listener()->on_reader_matched(&r, info);
-                            }
-                        }
+            if (r->matched_writer_add_edp(*wdata))
+            {
+                EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
+                        "WP:" << wdata->guid << " match R:" << matching.guid << ". WLoc:" <<
+                        wdata->remote_locators);
+                //MATCHED AND ADDED CORRECTLY:
+                if (r->get_listener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    r->get_listener()->on_reader_matched(r, info);
+                }
+            }
 #endif // if HAVE_SECURITY
-                    }
-                    else
-                    {
-                        if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && r.get_listener() != nullptr)
-                        {
-                            r.get_listener()->on_requested_incompatible_qos(&r, incompatible_qos);
-                            mp_PDP->notify_incompatible_qos_matching(r.getGuid(), wdata->guid, incompatible_qos);
-                        }
+        }
+        else
+        {
+            if (matching.no_match_reason.test(MatchingFailureMask::incompatible_qos) && r->get_listener() != nullptr)
+            {
+                r->get_listener()->on_requested_incompatible_qos(r, matching.incompatible_qos);
+                mp_PDP->notify_incompatible_qos_matching(matching.guid, wdata->guid, matching.incompatible_qos);
+            }
 
-                        if (r.matched_writer_is_matched(writer_guid)
-                        && r.matched_writer_remove(writer_guid))
-                        {
+            if (r->matched_writer_is_matched(writer_guid)
+                    && r->matched_writer_remove(writer_guid))
+            {
 #if HAVE_SECURITY
-                            mp_RTPSParticipant->security_manager().remove_writer(readerGUID, participant_guid,
-                            writer_guid);
+                mp_RTPSParticipant->security_manager().remove_writer(matching.guid, participant_guid, writer_guid);
 #endif // if HAVE_SECURITY
-                            //MATCHED AND ADDED CORRECTLY:
-                            if (r.get_listener() != nullptr)
-                            {
-                                MatchingInfo info;
-                                info.status = REMOVED_MATCHING;
-                                info.remoteEndpointGuid = writer_guid;
-                                r.get_listener()->on_reader_matched(&r, info);
-                            }
-                        }
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if (r->get_listener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    r->get_listener()->on_reader_matched(r, info);
                 }
-                // keep looking
-                return true;
-            });
+            }
+        }
+    }
 
     return true;
 }
@@ -29,6 +29,7 @@
 
 #include <rtps/builtin/data/ReaderProxyData.hpp>
 #include <rtps/builtin/data/WriterProxyData.hpp>
+#include <rtps/builtin/discovery/endpoint/PartitionMatcher.hpp>
 #include <utils/ProxyPool.hpp>
 
 #define MATCH_FAILURE_REASON_COUNT size_t(16)
@@ -364,6 +365,9 @@ private:
     bool checkDataRepresentationQos(
             const WriterProxyData* wdata,
             const ReaderProxyData* rdata) const;
+
+    //! Matcher for the partitions of writers and readers with non-empty partition lists.
+    PartitionMatcher partition_matcher_;
 };
 
 } // namespace rtps
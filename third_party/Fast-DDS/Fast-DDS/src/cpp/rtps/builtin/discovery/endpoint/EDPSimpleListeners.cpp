@@ -67,7 +67,8 @@ void EDPBasePUBListener::add_writer_from_change(
         CacheChange_t* change,
         EDP* edp,
         bool release_change /*= true*/,
-        const EndpointAddedCallback& writer_added_callback /* = nullptr*/)
+        const EndpointAddedCallback& writer_added_callback /* = nullptr*/,
+        uint64_t processed_data_hash /* = 0*/)
 {
     //LOAD INFORMATION IN DESTINATION WRITER PROXY DATA
     NetworkFactory& network = edp->mp_RTPSParticipant->network_factory();
@@ -83,9 +84,16 @@ void EDPBasePUBListener::add_writer_from_change(
             return;
         }
 
+        // Copy the DATA to be recorded, as the change may be released before the callback is called
+        PDP::ProcessedData processed_data;
+        if (0 != processed_data_hash)
+        {
+            processed_data = PDP::processed_data(*change, processed_data_hash);
+        }
+
         // Callback function to continue after typelookup is complete
         fastdds::dds::builtin::AsyncGetTypeWriterCallback after_typelookup_callback =
-                [reader, change, edp, &network, writer_added_callback]
+                [reader, change, edp, &network, writer_added_callback, processed_data]
                     (eprosima::fastdds::dds::ReturnCode_t request_ret_status,
                         eprosima::fastdds::rtps::WriterProxyData* temp_writer_data)
                 {
@@ -118,6 +126,14 @@ void EDPBasePUBListener::add_writer_from_change(
                     if (writer_data != nullptr)
                     {
                         edp->pairing_writer_proxy_with_any_local_reader(participant_guid, writer_data);
+
+                        // Repeated announcements are skipped, unless the type lookup has to be retried
+                        if (0 != processed_data.hash &&
+                                (fastdds::dds::RETCODE_OK == request_ret_status ||
+                                !temp_writer_data->type_information.assigned()))
+                        {
+                            edp->mp_PDP->set_processed_data(writer_data->guid, processed_data);
+                        }
                         if (nullptr != writer_added_callback)
                         {
                             writer_added_callback(reader, change);
@@ -135,10 +151,15 @@ void EDPBasePUBListener::add_writer_from_change(
         // At this point, we can release the reader lock because the change is not used
         reader->getMutex().unlock();
 
-        auto typelookup_manager = edp->mp_RTPSParticipant->typelookup_manager();
+        // The manager is only requested when needed, since a deferred one is created on first use
+        fastdds::dds::builtin::TypeLookupManager* typelookup_manager = nullptr;
+        if (temp_writer_data->type_information.assigned())
+        {
+            typelookup_manager = edp->mp_RTPSParticipant->typelookup_manager();
+        }
 
         // Check if TypeInformation exists to start the typelookup service
-        if (nullptr != typelookup_manager && temp_writer_data->type_information.assigned())
+        if (nullptr != typelookup_manager)
         {
             typelookup_manager->async_get_type(
                 temp_writer_data,
@@ -184,8 +205,18 @@ void EDPSimplePUBListener::on_new_cache_change_added(
     {
         PREVENT_PDP_DEADLOCK(reader, change, sedp_->mp_PDP);
 
+        // Skip the DATA if it is the same as the last one processed for this endpoint
+        uint64_t processed_data_hash = PDP::processed_data_hash(*change);
+        if (change->instanceHandle.isDefined() &&
+                sedp_->mp_PDP->is_processed_data(iHandle2GUID(change->instanceHandle), *change,
+                        processed_data_hash))
+        {
+            reader_history->remove_change(change);
+            return;
+        }
+
         // Note: change is removed from history inside this method.
-        add_writer_from_change(reader, reader_history, change, sedp_);
+        add_writer_from_change(reader, reader_history, change, sedp_, true, nullptr, processed_data_hash);
     }
     else
     {
@@ -212,7 +243,8 @@ void EDPBaseSUBListener::add_reader_from_change(
         CacheChange_t* change,
         EDP* edp,
         bool release_change /*= true*/,
-        const EndpointAddedCallback& reader_added_callback /* = nullptr*/)
+        const EndpointAddedCallback& reader_added_callback /* = nullptr*/,
+        uint64_t processed_data_hash /* = 0*/)
 {
     //LOAD INFORMATION IN TEMPORAL READER PROXY DATA
     NetworkFactory& network = edp->mp_RTPSParticipant->network_factory();
@@ -228,9 +260,16 @@ void EDPBaseSUBListener::add_reader_from_change(
             return;
         }
 
+        // Copy the DATA to be recorded, as the change may be released before the callback is called
+        PDP::ProcessedData processed_data;
+        if (0 != processed_data_hash)
+        {
+            processed_data = PDP::processed_data(*change, processed_data_hash);
+        }
+
         // Callback function to continue after typelookup is complete
         fastdds::dds::builtin::AsyncGetTypeReaderCallback after_typelookup_callback =
-                [reader, change, edp, &network, reader_added_callback]
+                [reader, change, edp, &network, reader_added_callback, processed_data]
                     (eprosima::fastdds::dds::ReturnCode_t request_ret_status,
                         eprosima::fastdds::rtps::ReaderProxyData* temp_reader_data)
                 {
@@ -264,6 +303,14 @@ void EDPBaseSUBListener::add_reader_from_change(
                     if (reader_data != nullptr) //ADDED NEW DATA
                     {
                         edp->pairing_reader_proxy_with_any_local_writer(participant_guid, reader_data);
+
+                        // Repeated announcements are skipped, unless the type lookup has to be retried
+                        if (0 != processed_data.hash &&
+                                (fastdds::dds::RETCODE_OK == request_ret_status ||
+                                !temp_reader_data->type_information.assigned()))
+                        {
+                            edp->mp_PDP->set_processed_data(reader_data->guid, processed_data);
+                        }
                         if (nullptr != reader_added_callback)
                         {
                             reader_added_callback(reader, change);
@@ -281,10 +328,15 @@ void EDPBaseSUBListener::add_reader_from_change(
         // At this point, we can release the reader lock because the change is not used
         reader->getMutex().unlock();
 
-        auto typelookup_manager = edp->mp_RTPSParticipant->typelookup_manager();
+        // The manager is only requested when needed, since a deferred one is created on first use
+        fastdds::dds::builtin::TypeLookupManager* typelookup_manager = nullptr;
+        if (temp_reader_data->type_information.assigned())
+        {
+            typelookup_manager = edp->mp_RTPSParticipant->typelookup_manager();
+        }
 
         // Check if TypeInformation exists to start the typelookup service
-        if (nullptr != typelookup_manager && temp_reader_data->type_information.assigned())
+        if (nullptr != typelookup_manager)
         {
             typelookup_manager->async_get_type(
                 temp_reader_data,
@@ -329,8 +381,18 @@ void EDPSimpleSUBListener::on_new_cache_change_added(
     {
         PREVENT_PDP_DEADLOCK(reader, change, sedp_->mp_PDP);
 
+        // Skip the DATA if it is the same as the last one processed for this endpoint
+        uint64_t processed_data_hash = PDP::processed_data_hash(*change);
+        if (change->instanceHandle.isDefined() &&
+                sedp_->mp_PDP->is_processed_data(iHandle2GUID(change->instanceHandle), *change,
+                        processed_data_hash))
+        {
+            reader_history->remove_change(change);
+            return;
+        }
+
         // Note: change is removed from history inside this method.
-        add_reader_from_change(reader, reader_history, change, sedp_);
+        add_reader_from_change(reader, reader_history, change, sedp_, true, nullptr, processed_data_hash);
     }
     else
     {
@@ -81,7 +81,8 @@ protected:
             CacheChange_t* change,
             EDP* edp,
             bool release_change = true,
-            const EndpointAddedCallback& writer_added_callback = nullptr
+            const EndpointAddedCallback& writer_added_callback = nullptr,
+            uint64_t processed_data_hash = 0
             );
 };
 
@@ -105,7 +106,8 @@ protected:
             CacheChange_t* change,
             EDP* edp,
             bool release_change = true,
-            const EndpointAddedCallback& reader_added_callback = nullptr
+            const EndpointAddedCallback& reader_added_callback = nullptr,
+            uint64_t processed_data_hash = 0
             );
 };
 
@@ -0,0 +1,251 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionMatcher.cpp
+ */
+
+#include <rtps/builtin/discovery/endpoint/PartitionMatcher.hpp>
+
+#include <utils/StringMatching.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+constexpr size_t PartitionMatcher::max_sets;
+constexpr size_t PartitionMatcher::max_results;
+
+#if defined(_WIN32)
+// PathMatchSpecA is case insensitive and accepts lists of patterns, so every name goes through StringMatching
+static constexpr bool compile_names = false;
+#else
+static constexpr bool compile_names = true;
+#endif // if defined(_WIN32)
+
+static bool is_ascii(
+        const std::string& name)
+{
+    for (char c : name)
+    {
+        if (0 != (static_cast<unsigned char>(c) & 0x80u))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PartitionMatcher::match(
+        const dds::PartitionQosPolicy& writer_partitions,
+        const dds::PartitionQosPolicy& reader_partitions)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    // Make room for both lists before taking references to them
+    if (sets_.size() + 2 > max_sets)
+    {
+        sets_.clear();
+        results_.clear();
+    }
+
+    const PartitionSet& writer_set = compile(writer_partitions, writer_key_);
+    const PartitionSet& reader_set = compile(reader_partitions, reader_key_);
+
+    uint64_t result_key = (static_cast<uint64_t>(writer_set.id) << 32) | reader_set.id;
+    auto result = results_.find(result_key);
+    if (result != results_.end())
+    {
+        return result->second;
+    }
+
+    bool matched = match(writer_set, reader_set);
+    if (results_.size() >= max_results)
+    {
+        results_.clear();
+    }
+    results_.emplace(result_key, matched);
+    return matched;
+}
+
+const PartitionMatcher::PartitionSet& PartitionMatcher::compile(
+        const dds::PartitionQosPolicy& partitions,
+        std::string& key)
+{
+    key.clear();
+    for (auto it = partitions.begin(); it != partitions.end(); ++it)
+    {
+        key.append(it->name());
+        key.push_back('\0');
+    }
+
+    auto found = sets_.find(key);
+    if (found != sets_.end())
+    {
+        return found->second;
+    }
+
+    PartitionSet& set = sets_[key];
+    set.id = next_id_++;
+    for (auto it = partitions.begin(); it != partitions.end(); ++it)
+    {
+        std::string name(it->name());
+        if (compile_names && std::string::npos == name.find_first_of("*?["))
+        {
+            set.non_ascii_names = set.non_ascii_names || !is_ascii(name);
+            set.names.insert(std::move(name));
+            continue;
+        }
+
+        Pattern pattern;
+        pattern.use_string_matching = !compile_names || std::string::npos != name.find('[') || !is_ascii(name);
+        if (!pattern.use_string_matching)
+        {
+            size_t start = 0;
+            size_t star = 0;
+            while (std::string::npos != (star = name.find('*', start)))
+            {
+                pattern.parts.emplace_back(name, start, star - start);
+                start = star + 1;
+            }
+            pattern.parts.emplace_back(name, start);
+        }
+        pattern.text = std::move(name);
+        set.patterns.push_back(std::move(pattern));
+    }
+
+    return set;
+}
+
+bool PartitionMatcher::match(
+        const PartitionSet& set_1,
+        const PartitionSet& set_2)
+{
+    // Names without wildcards only match the same name
+    const PartitionSet& smaller = set_1.names.size() <= set_2.names.size() ? set_1 : set_2;
+    const PartitionSet& larger = &smaller == &set_1 ? set_2 : set_1;
+    for (const std::string& name : smaller.names)
+    {
+        if (larger.names.count(name) > 0)
+        {
+            return true;
+        }
+    }
+
+    for (const Pattern& pattern : set_1.patterns)
+    {
+        for (const std::string& name : set_2.names)
+        {
+            if (match(pattern, name, set_2.non_ascii_names))
+            {
+                return true;
+            }
+        }
+
+        // Each pattern may match the text of the other one
+        for (const Pattern& other : set_2.patterns)
+        {
+            if (pattern.use_string_matching || other.use_string_matching)
+            {
+                if (StringMatching::matchString(pattern.text.c_str(), other.text.c_str()))
+                {
+                    return true;
+                }
+            }
+            else if (match(pattern, other.text, false) || match(other, pattern.text, false))
+            {
+                return true;
+            }
+        }
+    }
+
+    for (const Pattern& pattern : set_2.patterns)
+    {
+        for (const std::string& name : set_1.names)
+        {
+            if (match(pattern, name, set_1.non_ascii_names))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool PartitionMatcher::match(
+        const Pattern& pattern,
+        const std::string& name,
+        bool non_ascii_name)
+{
+    // fnmatch may take several bytes as a single character on multibyte locales
+    if (pattern.use_string_matching || non_ascii_name)
+    {
+        return StringMatching::matchPattern(pattern.text.c_str(), name.c_str());
+    }
+
+    const std::vector<std::string>& parts = pattern.parts;
+    if (1 == parts.size())
+    {
+        return name.size() == parts[0].size() && match_part(parts[0], name, 0);
+    }
+
+    // The first and last parts are anchored to the ends of the name
+    const std::string& first = parts.front();
+    const std::string& last = parts.back();
+    if (name.size() < first.size() + last.size() ||
+            !match_part(first, name, 0) ||
+            !match_part(last, name, name.size() - last.size()))
+    {
+        return false;
+    }
+
+    // The rest are taken at their leftmost position
+    size_t pos = first.size();
+    size_t end = name.size() - last.size();
+    for (size_t i = 1; i + 1 < parts.size(); ++i)
+    {
+        const std::string& part = parts[i];
+        while (pos + part.size() <= end && !match_part(part, name, pos))
+        {
+            ++pos;
+        }
+        if (pos + part.size() > end)
+        {
+            return false;
+        }
+        pos += part.size();
+    }
+
+    return true;
+}
+
+bool PartitionMatcher::match_part(
+        const std::string& part,
+        const std::string& name,
+        size_t pos)
+{
+    for (size_t i = 0; i < part.size(); ++i)
+    {
+        if ('?' != part[i] && part[i] != name[pos + i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
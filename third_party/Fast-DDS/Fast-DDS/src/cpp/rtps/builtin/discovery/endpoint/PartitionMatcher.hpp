@@ -0,0 +1,130 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionMatcher.hpp
+ */
+
+#ifndef FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT__PARTITIONMATCHER_HPP
+#define FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT__PARTITIONMATCHER_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Matches the partitions of a writer against the partitions of a reader, with the same result as calling
+ * StringMatching::matchString on every pair of names.
+ *
+ * Each distinct list of partitions is compiled once: names without wildcards are kept on a hash set, and patterns
+ * using only '*' and '?' are split on their stars. Patterns with bracket expressions, and any name on platforms
+ * where StringMatching does not follow fnmatch, are matched with StringMatching. The result for each pair of lists
+ * is also cached, so the matchings repeated during discovery do not look at the names again.
+ *
+ * @ingroup DISCOVERY_MODULE
+ */
+class PartitionMatcher
+{
+public:
+
+    /**
+     * Check whether any partition of a writer matches any partition of a reader.
+     * @param writer_partitions Partitions of the writer. Should not be empty.
+     * @param reader_partitions Partitions of the reader. Should not be empty.
+     * @return True if at least one pair of names match.
+     */
+    bool match(
+            const dds::PartitionQosPolicy& writer_partitions,
+            const dds::PartitionQosPolicy& reader_partitions);
+
+private:
+
+    //! Pattern using only '*' and '?' wildcards.
+    struct Pattern
+    {
+        //! Text of the pattern.
+        std::string text;
+        //! Parts of the pattern between stars. There are no stars when it has a single part.
+        std::vector<std::string> parts;
+        //! Whether the pattern should be matched with StringMatching.
+        bool use_string_matching = false;
+    };
+
+    //! Compiled list of partitions.
+    struct PartitionSet
+    {
+        //! Identifier of the list on the result cache.
+        uint32_t id = 0;
+        //! Names without wildcards.
+        std::unordered_set<std::string> names;
+        //! Whether some of the names have non ASCII characters.
+        bool non_ascii_names = false;
+        //! Names with wildcards.
+        std::vector<Pattern> patterns;
+    };
+
+    //! Maximum number of compiled lists before the caches are cleared.
+    static constexpr size_t max_sets = 256;
+
+    //! Maximum number of cached results before they are cleared.
+    static constexpr size_t max_results = 4096;
+
+    const PartitionSet& compile(
+            const dds::PartitionQosPolicy& partitions,
+            std::string& key);
+
+    static bool match(
+            const PartitionSet& set_1,
+            const PartitionSet& set_2);
+
+    static bool match(
+            const Pattern& pattern,
+            const std::string& name,
+            bool non_ascii_name);
+
+    static bool match_part(
+            const std::string& part,
+            const std::string& name,
+            size_t pos);
+
+    std::mutex mutex_;
+
+    //! Compiled lists, indexed by the names of the list separated by null characters.
+    std::unordered_map<std::string, PartitionSet> sets_;
+
+    //! Results of previous matchings, indexed by the identifiers of the writer and reader lists.
+    std::unordered_map<uint64_t, bool> results_;
+
+    //! Identifier for the next compiled list.
+    uint32_t next_id_ = 0;
+
+    //! Buffers for the keys of the lists, kept to avoid allocations.
+    std::string writer_key_;
+    std::string reader_key_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT__PARTITIONMATCHER_HPP
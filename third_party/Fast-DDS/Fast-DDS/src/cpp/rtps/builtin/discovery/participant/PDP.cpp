@@ -19,8 +19,10 @@
 
 #include <rtps/builtin/discovery/participant/PDP.h>
 
+#include <algorithm>
 #include <mutex>
 #include <chrono>
+#include <cstring>
 
 #include <fastdds/config.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
@@ -61,6 +63,7 @@
 #include <rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #endif // if HAVE_SECURITY
 #include <utils/BuiltinTopicKeyConversions.hpp>
+#include <utils/Fnv1a.hpp>
 #include <utils/shared_mutex.hpp>
 #include <utils/SystemInfo.hpp>
 #include <utils/TimeConversion.hpp>
@@ -301,6 +304,20 @@ std::string PDP::check_participant_type(
     }
 }
 
+static void add_typelookup_builtin_endpoints(
+        ParticipantProxyData* participant_data)
+{
+    participant_data->m_available_builtin_endpoints |=
+            fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_READER;
+    participant_data->m_available_builtin_endpoints |=
+            fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REPLY_DATA_WRITER;
+
+    participant_data->m_available_builtin_endpoints |=
+            fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_WRITER;
+    participant_data->m_available_builtin_endpoints |=
+            fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REPLY_DATA_READER;
+}
+
 void PDP::initializeParticipantProxyData(
         ParticipantProxyData* participant_data)
 {
@@ -345,17 +362,10 @@ void PDP::initializeParticipantProxyData(
             (dds::utils::TypePropagation::TYPEPROPAGATION_ENABLED == type_propagation) ||
             (dds::utils::TypePropagation::TYPEPROPAGATION_MINIMAL_BANDWIDTH == type_propagation);
 
-    if (should_announce_typelookup)
+    // A deferred TypeLookupManager announces its endpoints once it is created
+    if (should_announce_typelookup && !mp_builtin->defer_typelookup_manager_)
     {
-        participant_data->m_available_builtin_endpoints |=
-                fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_READER;
-        participant_data->m_available_builtin_endpoints |=
-                fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REPLY_DATA_WRITER;
-
-        participant_data->m_available_builtin_endpoints |=
-                fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_WRITER;
-        participant_data->m_available_builtin_endpoints |=
-                fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REPLY_DATA_READER;
+        add_typelookup_builtin_endpoints(participant_data);
     }
 
 #if HAVE_SECURITY
@@ -521,7 +531,7 @@ bool PDP::enable()
     resend_participant_info_event_ = new TimedEvent(mp_RTPSParticipant->getEventResource(),
                     [&]() -> bool
                     {
-                        announceParticipantState(false);
+                        announce_periodically();
                         set_next_announcement_interval();
                         return true;
                     },
@@ -672,6 +682,43 @@ void PDP::stopParticipantAnnouncement()
     }
 }
 
+void PDP::announce_typelookup_endpoints()
+{
+    {
+        std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+        add_typelookup_builtin_endpoints(getLocalParticipantProxyData());
+    }
+    announceParticipantState(true);
+}
+
+void PDP::assign_added_builtin_endpoints(
+        const ParticipantProxyData& pdata,
+        uint32_t added_endpoints)
+{
+    constexpr uint32_t typelookup_endpoints =
+            fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_WRITER |
+            fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REQUEST_DATA_READER |
+            fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REPLY_DATA_WRITER |
+            fastdds::rtps::BUILTIN_ENDPOINT_TYPELOOKUP_SERVICE_REPLY_DATA_READER;
+
+    // Only the TypeLookup service endpoints can be created after the participant has been announced
+    if (0 == (added_endpoints & typelookup_endpoints))
+    {
+        return;
+    }
+
+    auto typelookup_manager = mp_builtin->typelookup_manager_.load();
+    if (nullptr != typelookup_manager)
+    {
+        typelookup_manager->assign_remote_endpoints(pdata);
+    }
+}
+
+void PDP::announce_periodically()
+{
+    announceParticipantState(false);
+}
+
 void PDP::resetParticipantAnnouncement()
 {
     if (resend_participant_info_event_)
@@ -817,6 +864,8 @@ bool PDP::removeReaderProxyData(
 #endif // ifdef FASTDDS_STATISTICS
 
                 // Clear reader proxy data and move to pool in order to allow reuse
+                remove_from_topic_index(pR->topic_name.to_string(), pR);
+                processed_data_.erase(reader_guid);
                 pR->clear();
                 pit->m_readers->erase(rit);
                 reader_proxies_pool_.push_back(pR);
@@ -864,6 +913,8 @@ bool PDP::removeWriterProxyData(
 #endif // ifdef FASTDDS_STATISTICS
 
                 // Clear writer proxy data and move to pool in order to allow reuse
+                remove_from_topic_index(pW->topic_name.to_string(), pW);
+                processed_data_.erase(writer_guid);
                 pW->clear();
                 pit->m_writers->erase(wit);
                 writer_proxies_pool_.push_back(pW);
@@ -908,6 +959,133 @@ bool PDP::lookup_participant_key(
     return false;
 }
 
+const PDP::TopicProxies* PDP::topic_proxies(
+        const std::string& topic_name) const
+{
+    auto it = topic_proxies_.find(topic_name);
+    return it == topic_proxies_.end() ? nullptr : &it->second;
+}
+
+uint64_t PDP::processed_data_hash(
+        const CacheChange_t& change)
+{
+    uint64_t hash = fnv1a_64(change.vendor_id.data(), change.vendor_id.size());
+    hash = fnv1a_64(change.serializedPayload.data, change.serializedPayload.length, hash);
+
+    // Zero is kept for unknown hashes
+    return 0 == hash ? 1 : hash;
+}
+
+PDP::ProcessedData PDP::processed_data(
+        const CacheChange_t& change,
+        uint64_t hash)
+{
+    ProcessedData ret;
+    ret.hash = hash;
+    const SerializedPayload_t& payload = change.serializedPayload;
+    ret.data.reserve(2u + payload.length);
+    ret.data.push_back(change.vendor_id[0]);
+    ret.data.push_back(change.vendor_id[1]);
+    ret.data.insert(ret.data.end(), payload.data, payload.data + payload.length);
+    return ret;
+}
+
+bool PDP::is_processed_data(
+        const GUID_t& guid,
+        const CacheChange_t& change,
+        uint64_t hash) const
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*mp_mutex);
+    auto it = processed_data_.find(guid);
+    if (it == processed_data_.end() || it->second.hash != hash)
+    {
+        return false;
+    }
+
+    // Same hash: compare the whole message, so a collision never drops an update
+    const std::vector<octet>& data = it->second.data;
+    const SerializedPayload_t& payload = change.serializedPayload;
+    return data.size() == 2u + payload.length &&
+           data[0] == change.vendor_id[0] && data[1] == change.vendor_id[1] &&
+           (0 == payload.length || 0 == memcmp(&data[2], payload.data, payload.length));
+}
+
+void PDP::set_processed_data(
+        const GUID_t& guid,
+        ProcessedData data)
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*mp_mutex);
+    processed_data_[guid] = std::move(data);
+}
+
+template<typename ProxyData>
+static void add_proxy(
+        std::vector<ProxyData*>& proxies,
+        ProxyData* proxy)
+{
+    if (std::find(proxies.begin(), proxies.end(), proxy) == proxies.end())
+    {
+        proxies.push_back(proxy);
+    }
+}
+
+template<typename ProxyData>
+static void remove_proxy(
+        std::vector<ProxyData*>& proxies,
+        ProxyData* proxy)
+{
+    auto it = std::find(proxies.begin(), proxies.end(), proxy);
+    if (it != proxies.end())
+    {
+        *it = proxies.back();
+        proxies.pop_back();
+    }
+}
+
+void PDP::add_to_topic_index(
+        const std::string& topic_name,
+        ReaderProxyData* rdata)
+{
+    add_proxy(topic_proxies_[topic_name].readers, rdata);
+}
+
+void PDP::add_to_topic_index(
+        const std::string& topic_name,
+        WriterProxyData* wdata)
+{
+    add_proxy(topic_proxies_[topic_name].writers, wdata);
+}
+
+void PDP::remove_from_topic_index(
+        const std::string& topic_name,
+        ReaderProxyData* rdata)
+{
+    auto it = topic_proxies_.find(topic_name);
+    if (it != topic_proxies_.end())
+    {
+        remove_proxy(it->second.readers, rdata);
+        if (it->second.readers.empty() && it->second.writers.empty())
+        {
+            topic_proxies_.erase(it);
+        }
+    }
+}
+
+void PDP::remove_from_topic_index(
+        const std::string& topic_name,
+        WriterProxyData* wdata)
+{
+    auto it = topic_proxies_.find(topic_name);
+    if (it != topic_proxies_.end())
+    {
+        remove_proxy(it->second.writers, wdata);
+        if (it->second.readers.empty() && it->second.writers.empty())
+        {
+            topic_proxies_.erase(it);
+        }
+    }
+}
+
 ReaderProxyData* PDP::addReaderProxyData(
         const GUID_t& reader_guid,
         GUID_t& participant_guid,
@@ -934,12 +1112,19 @@ ReaderProxyData* PDP::addReaderProxyData(
             if ( rpi != pit->m_readers->end())
             {
                 ret_val = rpi->second;
+                std::string old_topic_name = ret_val->topic_name.to_string();
 
                 if (!initializer_func(ret_val, true, *pit))
                 {
                     return nullptr;
                 }
 
+                if (old_topic_name != ret_val->topic_name.to_string())
+                {
+                    remove_from_topic_index(old_topic_name, ret_val);
+                }
+                add_to_topic_index(ret_val->topic_name.to_string(), ret_val);
+
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
                 if (listener)
                 {
@@ -994,6 +1179,8 @@ ReaderProxyData* PDP::addReaderProxyData(
                 return nullptr;
             }
 
+            add_to_topic_index(ret_val->topic_name.to_string(), ret_val);
+
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
             if (listener)
             {
@@ -1036,12 +1223,19 @@ WriterProxyData* PDP::addWriterProxyData(
             if (wpi != pit->m_writers->end())
             {
                 ret_val = wpi->second;
+                std::string old_topic_name = ret_val->topic_name.to_string();
 
                 if (!initializer_func(ret_val, true, *pit))
                 {
                     return nullptr;
                 }
 
+                if (old_topic_name != ret_val->topic_name.to_string())
+                {
+                    remove_from_topic_index(old_topic_name, ret_val);
+                }
+                add_to_topic_index(ret_val->topic_name.to_string(), ret_val);
+
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
                 if (listener)
                 {
@@ -1095,6 +1289,8 @@ WriterProxyData* PDP::addWriterProxyData(
                 return nullptr;
             }
 
+            add_to_topic_index(ret_val->topic_name.to_string(), ret_val);
+
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
             if (listener)
             {
@@ -1342,9 +1538,10 @@ void PDP::actions_on_remote_participant_removed(
         mp_builtin->mp_WLP->removeRemoteEndpoints(pdata);
     }
 
-    if (nullptr != mp_builtin->typelookup_manager_)
+    auto typelookup_manager = mp_builtin->typelookup_manager_.load();
+    if (nullptr != typelookup_manager)
     {
-        mp_builtin->typelookup_manager_->remove_remote_endpoints(pdata);
+        typelookup_manager->remove_remote_endpoints(pdata);
     }
 
     mp_EDP->removeRemoteEndpoints(pdata);
@@ -1386,6 +1583,8 @@ void PDP::actions_on_remote_participant_removed(
         // Return reader proxy objects to pool
         for (auto pit : *pdata->m_readers)
         {
+            remove_from_topic_index(pit.second->topic_name.to_string(), pit.second);
+            processed_data_.erase(pit.second->guid);
             pit.second->clear();
             reader_proxies_pool_.push_back(pit.second);
         }
@@ -1394,11 +1593,15 @@ void PDP::actions_on_remote_participant_removed(
         // Return writer proxy objects to pool
         for (auto pit : *pdata->m_writers)
         {
+            remove_from_topic_index(pit.second->topic_name.to_string(), pit.second);
+            processed_data_.erase(pit.second->guid);
             pit.second->clear();
             writer_proxies_pool_.push_back(pit.second);
         }
         pdata->m_writers->clear();
 
+        processed_data_.erase(pdata->guid);
+
         // Cancel lease event
         if (nullptr != pdata->lease_duration_event)
         {
@@ -1534,6 +1737,12 @@ void PDP::resend_ininitial_announcements()
     }
 }
 
+bool PDP::is_sending_initial_announcements()
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*mp_mutex);
+    return initial_announcements_.count > 0;
+}
+
 void PDP::set_external_participant_properties_(
         ParticipantProxyData* participant_data)
 {
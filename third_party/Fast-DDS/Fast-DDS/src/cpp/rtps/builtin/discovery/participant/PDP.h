@@ -24,9 +24,11 @@
 #include <atomic>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <fastcdr/cdr/fixed_size_string.hpp>
@@ -182,6 +184,29 @@ public:
             bool new_change,
             bool dispose = false);
 
+    /**
+     * Periodic announcement of our local DPD, triggered by the resend event.
+     * Resends the last change by default.
+     */
+    virtual void announce_periodically();
+
+    /**
+     * Add the TypeLookup service endpoints to our local DPD and announce it.
+     * Used when the TypeLookupManager is created after the participant has been initialized.
+     */
+    void announce_typelookup_endpoints();
+
+    /**
+     * Match the builtin endpoints a known remote participant announced after its first DATA(p),
+     * as the TypeLookup service endpoints of a participant that creates them on first use.
+     * Should be called with the PDP mutex taken.
+     * @param pdata Updated ParticipantProxyData of the remote participant.
+     * @param added_endpoints Builtin endpoint mask not announced by previous DATA(p)s.
+     */
+    void assign_added_builtin_endpoints(
+            const ParticipantProxyData& pdata,
+            uint32_t added_endpoints);
+
     //!Stop the RTPSParticipantAnnouncement (only used in tests).
     virtual void stopParticipantAnnouncement();
 
@@ -372,6 +397,72 @@ public:
         return participant_proxies_.end();
     }
 
+    //! Proxies of the known endpoints on a topic.
+    struct TopicProxies
+    {
+        std::vector<ReaderProxyData*> readers;
+        std::vector<WriterProxyData*> writers;
+    };
+
+    /**
+     * Get the proxies of the known endpoints on a topic, including the local ones.
+     * The PDP mutex should be taken while using the returned object.
+     * @param topic_name Name of the topic.
+     * @return Pointer to the proxies on the topic, nullptr if no endpoint on the topic is known.
+     */
+    const TopicProxies* topic_proxies(
+            const std::string& topic_name) const;
+
+    //! Copy of the last DATA message processed for a remote participant or endpoint
+    struct ProcessedData
+    {
+        //! Hash of the DATA message, as returned by @ref processed_data_hash. Zero when unknown.
+        uint64_t hash = 0;
+        //! Vendor of the change followed by the serialized payload
+        std::vector<octet> data;
+    };
+
+    /**
+     * Compute the hash used to detect repeated DATA messages.
+     * @param change CacheChange_t with the serialized DATA.
+     * @return Non-zero hash of the serialized payload and the vendor of the change.
+     */
+    static uint64_t processed_data_hash(
+            const CacheChange_t& change);
+
+    /**
+     * Copy a DATA message, so it can be recorded after the change has been released.
+     * @param change CacheChange_t with the serialized DATA.
+     * @param hash Hash of the DATA message, as returned by @ref processed_data_hash.
+     * @return Copy of the vendor and the serialized payload of the change.
+     */
+    static ProcessedData processed_data(
+            const CacheChange_t& change,
+            uint64_t hash);
+
+    /**
+     * Check whether a DATA message is the same as the last one processed for a remote participant or endpoint.
+     * The payload is only compared byte by byte when the hashes match.
+     * @param guid GUID of the participant or endpoint.
+     * @param change CacheChange_t with the serialized DATA.
+     * @param hash Hash of the DATA message, as returned by @ref processed_data_hash.
+     * @return true when the DATA message does not need to be processed again.
+     */
+    bool is_processed_data(
+            const GUID_t& guid,
+            const CacheChange_t& change,
+            uint64_t hash) const;
+
+    /**
+     * Record the last DATA message processed for a remote participant or endpoint.
+     * The record is removed together with the proxy data of the participant or endpoint.
+     * @param guid GUID of the participant or endpoint.
+     * @param data Copy of the DATA message, as returned by @ref processed_data.
+     */
+    void set_processed_data(
+            const GUID_t& guid,
+            ProcessedData data);
+
     /**
      * Get the number of participant proxies.
      * @return size_t.
@@ -539,6 +630,10 @@ protected:
     size_t writer_proxies_number_;
     //!Pool of writer proxy data objects ready for reuse
     ResourceLimitedVector<WriterProxyData*> writer_proxies_pool_;
+    //!Reader and writer proxy data objects in use, indexed by topic name
+    std::unordered_map<std::string, TopicProxies> topic_proxies_;
+    //!Last DATA messages processed for each remote participant and endpoint
+    std::map<GUID_t, ProcessedData> processed_data_;
     //!Variable to indicate if any parameter has changed.
     std::atomic_bool m_hasChangedLocalPDP;
     //! ProxyPool for temporary reader proxies
@@ -552,6 +647,42 @@ protected:
     //!Tell if object is enabled
     std::atomic<bool> enabled_ {false};
 
+    /**
+     * Adds a reader proxy data object to the topic index, if it is not already there.
+     * @param topic_name Name of the topic of the reader.
+     * @param rdata Reader proxy data object.
+     */
+    void add_to_topic_index(
+            const std::string& topic_name,
+            ReaderProxyData* rdata);
+
+    /**
+     * Adds a writer proxy data object to the topic index, if it is not already there.
+     * @param topic_name Name of the topic of the writer.
+     * @param wdata Writer proxy data object.
+     */
+    void add_to_topic_index(
+            const std::string& topic_name,
+            WriterProxyData* wdata);
+
+    /**
+     * Removes a reader proxy data object from the topic index.
+     * @param topic_name Name of the topic the reader was indexed with.
+     * @param rdata Reader proxy data object.
+     */
+    void remove_from_topic_index(
+            const std::string& topic_name,
+            ReaderProxyData* rdata);
+
+    /**
+     * Removes a writer proxy data object from the topic index.
+     * @param topic_name Name of the topic the writer was indexed with.
+     * @param wdata Writer proxy data object.
+     */
+    void remove_from_topic_index(
+            const std::string& topic_name,
+            WriterProxyData* wdata);
+
     /**
      * Adds an entry to the collection of participant proxy information.
      * May use one of the entries present in the pool.
@@ -629,6 +760,12 @@ protected:
      */
     void resend_ininitial_announcements();
 
+    /**
+     * Check whether the initial announcements are still being sent.
+     * @return true while there are initial announcements left.
+     */
+    bool is_sending_initial_announcements();
+
 #ifdef FASTDDS_STATISTICS
 
     std::atomic<const fastdds::statistics::rtps::IProxyObserver*> proxy_observer_;
@@ -546,9 +546,10 @@ void PDPClient::perform_builtin_endpoints_matching(
         mp_builtin->mp_WLP->assignRemoteEndpoints(pdata, true);
     }
 
-    if (nullptr != mp_builtin->typelookup_manager_)
+    auto typelookup_manager = mp_builtin->typelookup_manager_.load();
+    if (nullptr != typelookup_manager)
     {
-        mp_builtin->typelookup_manager_->assign_remote_endpoints(pdata);
+        typelookup_manager->assign_remote_endpoints(pdata);
     }
 }
 
@@ -99,6 +99,16 @@ void PDPListener::on_new_cache_change_added(
             return;
         }
 
+        // Periodic announcements repeat the last DATA(p), which does not need to be parsed again.
+        // A new DATA(p) with the same content as the last one processed is not parsed either.
+        uint64_t processed_data_hash = PDP::processed_data_hash(*change);
+        if (is_already_processed(guid, *change) || parent_pdp_->is_processed_data(guid, *change, processed_data_hash))
+        {
+            lock.unlock();
+            parent_pdp_->builtin_endpoints_->remove_from_pdp_reader_history(change);
+            return;
+        }
+
         // Access to temp_participant_data_ is protected by reader lock
 
         // Load information on temp_participant_data_
@@ -128,35 +138,26 @@ void PDPListener::on_new_cache_change_added(
                     pattr.builtin.metatraffic_external_unicast_locators, pattr.default_external_unicast_locators,
                     pattr.ignore_non_matching_locators);
 
-            // Check if participant already exists (updated info)
+            // Check if participant already exists (updated info).
+            // Repeated DATA(p) messages have already been discarded before parsing.
             ParticipantProxyData* pdata = nullptr;
-            bool already_processed = false;
             for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
             {
                 if (guid == it->guid)
                 {
                     pdata = it;
-
-                    // This means this is the same DATA(p) that we have already processed.
-                    // We do not compare sample_identity directly because it is not properly filled
-                    // in the change during desearialization.
-                    if (it->m_sample_identity.writer_guid() == change->writerGUID &&
-                            it->m_sample_identity.sequence_number() == change->sequenceNumber)
-                    {
-                        already_processed = true;
-                    }
-
                     break;
                 }
             }
 
-            // Only process the DATA(p) if it is not a repeated one
-            if (!already_processed)
+            temp_participant_data_.m_sample_identity.writer_guid(change->writerGUID);
+            temp_participant_data_.m_sample_identity.sequence_number(change->sequenceNumber);
+            if (nullptr != pdata)
             {
-                temp_participant_data_.m_sample_identity.writer_guid(change->writerGUID);
-                temp_participant_data_.m_sample_identity.sequence_number(change->sequenceNumber);
-                process_alive_data(pdata, temp_participant_data_, writer_guid, reader, lock);
+                // Only updates are recorded, as a new participant may be rejected
+                parent_pdp_->set_processed_data(guid, PDP::processed_data(*change, processed_data_hash));
             }
+            process_alive_data(pdata, temp_participant_data_, writer_guid, reader, lock);
         }
     }
     else if (reader->matched_writer_is_matched(writer_guid))
@@ -184,6 +185,23 @@ void PDPListener::on_new_cache_change_added(
     parent_pdp_->builtin_endpoints_->remove_from_pdp_reader_history(change);
 }
 
+bool PDPListener::is_already_processed(
+        const GUID_t& guid,
+        const CacheChange_t& change) const
+{
+    for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
+    {
+        if (guid == it->guid)
+        {
+            // We do not compare sample_identity directly because it is not properly filled
+            // in the change during desearialization.
+            return it->m_sample_identity.writer_guid() == change.writerGUID &&
+                   it->m_sample_identity.sequence_number() == change.sequenceNumber;
+        }
+    }
+    return false;
+}
+
 void PDPListener::process_alive_data(
         ParticipantProxyData* old_data,
         ParticipantProxyData& new_data,
@@ -226,6 +244,8 @@ void PDPListener::process_alive_data(
     }
     else
     {
+        uint32_t added_builtin_endpoints =
+                new_data.m_available_builtin_endpoints & ~old_data->m_available_builtin_endpoints;
         old_data->update_data(new_data);
         old_data->is_alive = true;
 
@@ -241,6 +261,8 @@ void PDPListener::process_alive_data(
             parent_pdp_->mp_EDP->assignRemoteEndpoints(*old_data, true);
         }
 
+        parent_pdp_->assign_added_builtin_endpoints(*old_data, added_builtin_endpoints);
+
         // Copy proxy to be passed forward before releasing PDP mutex
         ParticipantBuiltinTopicData old_proxy_data_copy(*old_data);
 
@@ -92,6 +92,18 @@ protected:
     virtual bool check_discovery_conditions(
             ParticipantProxyData& participant_data);
 
+    /**
+     * Check whether an incoming DATA(p) is the last one processed for its participant.
+     * Both the reader lock and the PDP lock should be held when calling this method.
+     *
+     * @param guid    GUID of the participant taken from the instance handle of the change.
+     * @param change  CacheChange_t with the DATA(p).
+     * @return true when the DATA(p) was already processed.
+     */
+    bool is_already_processed(
+            const GUID_t& guid,
+            const CacheChange_t& change) const;
+
     /**
      * Get the key of a CacheChange_t
      * @param change Pointer to the CacheChange_t
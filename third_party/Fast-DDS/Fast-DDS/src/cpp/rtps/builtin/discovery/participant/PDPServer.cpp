@@ -17,6 +17,7 @@
  *
  */
 
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <mutex>
@@ -32,6 +33,8 @@
 
 #include <fastdds/builtin/type_lookup_service/TypeLookupManager.hpp>
 #include <rtps/builtin/BuiltinProtocols.h>
+#include <rtps/builtin/discovery/database/DiscoveryParticipantChangeData.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
 #include <rtps/builtin/discovery/endpoint/EDPServer.hpp>
 #include <rtps/builtin/discovery/endpoint/EDPServerListeners.hpp>
@@ -124,6 +127,7 @@ bool PDPServer::init(
     uint32_t id_for_thread = static_cast<uint32_t>(part_attr.participantID);
     const fastdds::rtps::ThreadSettings& thr_config = part_attr.discovery_server_thread;
     resource_event_thread_.init_thread(thr_config, "dds.ds_ev.%u", id_for_thread);
+    discovery_db_.init_matching_threads(thr_config, id_for_thread);
 
     /*
         Given the fact that a participant is either a client or a server the
@@ -138,21 +142,40 @@ bool PDPServer::init(
 
 void PDPServer::pre_enable_actions()
 {
-    std::vector<nlohmann::json> backup_queue;
     // Restore the DDB from file if this is a BACKUP server
     if (durability_ == TRANSIENT)
     {
-        nlohmann::json backup_json;
         // If the DS is BACKUP, try to restore DDB from file
         discovery_db().backup_in_progress(true);
-        if (read_backup(backup_json, backup_queue))
+        bool restored = false;
         {
-            if (process_backup_discovery_database_restore(backup_json))
+            ddb::BinaryBackupFile backup_binary;
+            if (backup_binary.open(get_ddb_persistence_file_name()))
             {
-                EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "DiscoveryDataBase restored correctly");
+                restored = process_backup_discovery_database_restore(backup_binary.data(), backup_binary.size());
+                if (restored)
+                {
+                    EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "DiscoveryDataBase restored correctly");
+                }
+                else
+                {
+                    EPROSIMA_LOG_WARNING(RTPS_PDP_SERVER, "Binary backup could not be restored, trying the json one");
+                }
             }
         }
-        else
+
+        // Backups stored by previous versions are still loaded
+        nlohmann::json backup_json;
+        if (!restored && read_backup(backup_json))
+        {
+            restored = process_backup_discovery_database_restore(backup_json);
+            if (restored)
+            {
+                EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "DiscoveryDataBase restored correctly from json backup");
+            }
+        }
+
+        if (!restored)
         {
             EPROSIMA_LOG_INFO(RTPS_PDP_SERVER,
                     "Error reading backup file. Corrupted or unmissing file, restarting from scratch");
@@ -160,6 +183,10 @@ void PDPServer::pre_enable_actions()
 
         discovery_db().backup_in_progress(false);
 
+        // The changes received after the last snapshot are replayed before enabling the persistence, so they are
+        // not journaled twice
+        process_backup_restore_queue();
+
         discovery_db_.persistence_enable(get_ddb_queue_persistence_file_name());
     }
     else
@@ -167,13 +194,6 @@ void PDPServer::pre_enable_actions()
         // Allows the ddb to process new messages from this point
         discovery_db_.enable();
     }
-
-    // Restoring the queue must be done after starting the routine
-    if (durability_ == TRANSIENT)
-    {
-        // This vector is empty till backup queue is implemented
-        process_backup_restore_queue(backup_queue);
-    }
 }
 
 ParticipantProxyData* PDPServer::createParticipantProxyData(
@@ -697,9 +717,10 @@ void PDPServer::perform_builtin_endpoints_matching(
         mp_builtin->mp_WLP->assignRemoteEndpoints(pdata, true);
     }
 
-    if (nullptr != mp_builtin->typelookup_manager_)
+    auto typelookup_manager = mp_builtin->typelookup_manager_.load();
+    if (nullptr != typelookup_manager)
     {
-        mp_builtin->typelookup_manager_->assign_remote_endpoints(pdata);
+        typelookup_manager->assign_remote_endpoints(pdata);
     }
 
     // Inform EDP of new RTPSParticipant data:
@@ -782,6 +803,13 @@ std::string PDPServer::get_reader_persistence_file_name() const
 }
 
 std::string PDPServer::get_ddb_persistence_file_name() const
+{
+    std::ostringstream filename = get_persistence_file_name_();
+    filename << ".ddb";
+    return filename.str();
+}
+
+std::string PDPServer::get_ddb_legacy_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
     filename << ".json";
@@ -791,7 +819,7 @@ std::string PDPServer::get_ddb_persistence_file_name() const
 std::string PDPServer::get_ddb_queue_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
-    filename << "_queue.json";
+    filename << "_queue.ddb";
     return filename.str();
 }
 
@@ -1624,14 +1652,13 @@ void PDPServer::send_announcement(
 }
 
 bool PDPServer::read_backup(
-        nlohmann::json& ddb_json,
-        std::vector<nlohmann::json>& /* new_changes */)
+        nlohmann::json& ddb_json)
 {
     std::ifstream myfile;
     bool ret = true;
     try
     {
-        myfile.open(get_ddb_persistence_file_name(), std::ios_base::in);
+        myfile.open(get_ddb_legacy_persistence_file_name(), std::ios_base::in);
         // read json object
         myfile >> ddb_json;
         myfile.close();
@@ -1640,27 +1667,166 @@ bool PDPServer::read_backup(
     {
         ret = false;
     }
+    return ret;
+}
 
-    // TODO uncomment this part when recover queues is finish
-    // try{
-    //     myfile.open(get_ddb_queue_persistence_file_name(), std::ios_base::in);
+bool PDPServer::process_backup_discovery_database_restore(
+        const fastdds::rtps::octet* ddb_binary,
+        size_t length)
+{
+    EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "Restoring DiscoveryDataBase from binary backup");
 
-    //     std::string line;
-    //     while (std::getline(myfile, line))
-    //     {
-    //         nlohmann::json change_json = nlohmann::json::parse(line);
+    // The whole snapshot is parsed before reserving anything, so a corrupted one leaves the server untouched and the
+    // json backup can be tried
+    if (!ddb::DiscoveryDataBase::check_binary(ddb_binary, length))
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "BACKUP CORRUPTED");
+        return false;
+    }
 
-    //         // Read every change, and store it in json format in a vector
-    //         new_changes.push_back(change_json);
-    //     }
+    // We need every listener to resend the changes of every entity (ALIVE) in the DDB, so the PaticipantProxy
+    // is restored
+    EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
+    EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
+    EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
 
-    //     myfile.close();
-    // }
-    // catch(const std::exception& e)
-    // {
-    //     return ret;
-    // }
-    return ret;
+    // These mutexes are necessary to send messages to the listeners
+    auto endpoints = static_cast<fastdds::rtps::DiscoveryServerPDPEndpoints*>(builtin_endpoints_.get());
+    std::unique_lock<fastdds::RecursiveTimedMutex> lock(endpoints->reader.reader_->getMutex());
+    std::unique_lock<fastdds::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
+    std::unique_lock<fastdds::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
+
+    // Change reserved for an entity of the snapshot
+    struct RestoredChange
+    {
+        // Reader the change has been reserved from, nullptr for the changes of virtual endpoints
+        StatefulReader* reader;
+        fastdds::rtps::CacheChange_t* change;
+        // Listener that must create the proxy of the entity, nullptr if there is none to create
+        fastdds::rtps::ReaderListener* listener;
+    };
+    std::vector<RestoredChange> restored;
+
+    // Auxiliar variables to load info from the snapshot. It has already been checked, so every value can be read
+    ddb::BinaryBackupReader reader(ddb_binary, length);
+    ddb::BinaryBackupChange change_read;
+    std::vector<std::pair<fastdds::rtps::GuidPrefix_t, bool>> ack_status_aux;
+    fastdds::rtps::CacheChange_t* change_aux = nullptr;
+    uint32_t count = 0;
+    bool reserved = true;
+
+    reader.read_header(ddb::binary_backup_snapshot_magic);
+    reader.read_uint32(count);
+
+    // Create every participant change. There will not be changes from own server
+    for (uint32_t i = 0; reserved && i < count; ++i)
+    {
+        fastdds::rtps::GuidPrefix_t prefix_aux;
+        ddb::DiscoveryParticipantChangeData participant_change_data;
+        reader.read_guid_prefix(prefix_aux);
+        reader.read_change(change_read);
+        reader.read_ack_status(ack_status_aux);
+        participant_change_data.from_binary(reader);
+
+        reserved = endpoints->reader.reader_->reserve_cache(change_read.length, change_aux);
+        if (reserved)
+        {
+            change_read.copy_to(*change_aux);
+            fastdds::rtps::ReaderListener* listener = nullptr;
+
+            // If the change was read as is_local we must pass it to listener with his own writer_guid
+            if (participant_change_data.is_local() &&
+                    change_aux->write_params.sample_identity().writer_guid().guidPrefix !=
+                    endpoints->writer.writer_->getGuid().guidPrefix &&
+                    change_aux->kind == fastdds::rtps::ALIVE)
+            {
+                change_aux->writerGUID = change_aux->write_params.sample_identity().writer_guid();
+                change_aux->sequenceNumber = change_aux->write_params.sample_identity().sequence_number();
+                listener = builtin_endpoints_->main_listener().get();
+            }
+            restored.push_back({endpoints->reader.reader_, change_aux, listener});
+        }
+    }
+
+    // Create every writer change and then every reader change
+    for (bool writers : {true, false})
+    {
+        StatefulReader* edp_reader = writers ? edp->publications_reader_.first : edp->subscriptions_reader_.first;
+        fastdds::rtps::ReaderListener* edp_listener = writers ?
+                static_cast<fastdds::rtps::ReaderListener*>(edp_pub_listener) :
+                static_cast<fastdds::rtps::ReaderListener*>(edp_sub_listener);
+
+        count = 0;
+        reader.read_uint32(count);
+
+        for (uint32_t i = 0; reserved && i < count; ++i)
+        {
+            fastdds::rtps::GUID_t guid_aux;
+            std::string topic;
+            reader.read_guid(guid_aux);
+            reader.read_change(change_read);
+            reader.read_ack_status(ack_status_aux);
+            reader.read_string(topic);
+
+            bool is_virtual = topic == discovery_db().virtual_topic();
+            if (is_virtual)
+            {
+                change_aux = new fastdds::rtps::CacheChange_t();
+                change_aux->serializedPayload.reserve(change_read.length);
+            }
+            else
+            {
+                reserved = edp_reader->reserve_cache(change_read.length, change_aux);
+                if (!reserved)
+                {
+                    break;
+                }
+            }
+            change_read.copy_to(*change_aux);
+
+            // Call listener to create proxy info for other entities different than server
+            bool notify = change_aux->write_params.sample_identity().writer_guid().guidPrefix !=
+                    endpoints->writer.writer_->getGuid().guidPrefix
+                    && change_aux->kind == fastdds::rtps::ALIVE
+                    && !is_virtual;
+            restored.push_back({is_virtual ? nullptr : edp_reader, change_aux, notify ? edp_listener : nullptr});
+        }
+    }
+
+    if (!reserved)
+    {
+        // Nothing has been notified yet, so every change can be given back
+        EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
+        for (const RestoredChange& restored_change : restored)
+        {
+            if (nullptr != restored_change.reader)
+            {
+                restored_change.reader->release_cache(restored_change.change);
+            }
+            else
+            {
+                delete restored_change.change;
+            }
+        }
+        return false;
+    }
+
+    // Insert into the map so the DDB can store them, and create the proxies of participants before endpoints
+    std::map<eprosima::fastdds::rtps::InstanceHandle_t, fastdds::rtps::CacheChange_t*> changes_map;
+    for (const RestoredChange& restored_change : restored)
+    {
+        changes_map.insert(std::make_pair(restored_change.change->instanceHandle, restored_change.change));
+    }
+    for (const RestoredChange& restored_change : restored)
+    {
+        if (nullptr != restored_change.listener)
+        {
+            restored_change.listener->on_new_cache_change_added(restored_change.reader, restored_change.change);
+        }
+    }
+
+    // Load database. It cannot fail, as the snapshot has already been checked
+    return discovery_db_.from_binary(ddb_binary, length, changes_map);
 }
 
 bool PDPServer::process_backup_discovery_database_restore(
@@ -1809,151 +1975,148 @@ bool PDPServer::process_backup_discovery_database_restore(
     return true;
 }
 
-bool PDPServer::process_backup_restore_queue(
-        std::vector<nlohmann::json>& /* new_changes */)
+bool PDPServer::process_backup_restore_queue()
 {
-    // fastdds::rtps::SampleIdentity sample_identity_aux;
-    // fastdds::rtps::InstanceHandle_t instance_handle_aux;
-    // uint32_t length;
-
-    // EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
-    // EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
-    // EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
-
-    // std::unique_lock<fastdds::RecursiveTimedMutex> lock(endpoints->reader.reader_->getMutex());
-    // std::unique_lock<fastdds::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
-    // std::unique_lock<fastdds::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
-
-    // TODO uncomment this funcionality and update with pools when queue functionality is implemented
-    // try
-    // {
-    //     // Read every change and push it to the listener that it belongs
-    //     for (nlohmann::json& json_change : new_changes)
-    //     {
-    //         // std::cout << json_change << std::endl;
-    //         fastdds::rtps::CacheChange_t* change_aux;
-    //         length = json_change["serialized_payload"]["length"].get<std::uint32_t>();
-    //         (std::istringstream) json_change["sample_identity"].get<std::string>() >> sample_identity_aux;
-    //         (std::istringstream) json_change["instance_handle"].get<std::string>() >> instance_handle_aux;
-
-    //         // Belongs to own server
-    //         if (sample_identity_aux.writer_guid() == endpoints->writer.writer_->getGuid())
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!endpoints->writer.history_->reserve_Cache(&change_aux, length))
-    //                             [this]() -> uint32_t
-    //                             {
-    //                                 return mp_PDP->builtin_attributes().readerPayloadSize;
-    //                             },
-    //                             &change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     listener_->on_new_cache_change_added(endpoints->reader.reader_, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->on_new_cache_change_added(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->on_new_cache_change_added(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //         // It came from outside
-    //         else
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!endpoints->reader.history_->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     listener_->on_new_cache_change_added(endpoints->reader.reader_, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->on_new_cache_change_added(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->on_new_cache_change_added(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //     }
-    // }
-    // catch (std::ios_base::failure&)
-    // {
-    //     // TODO clean changes in case it has been an error
-    //     EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "QUEUE BACKUP CORRUPTED");
-    //     return false;
-    // }
+    std::string file_name = get_ddb_queue_persistence_file_name();
+    ddb::BinaryBackupFile journal;
+    if (!journal.open(file_name))
+    {
+        // No change has been received since the last snapshot
+        return true;
+    }
+
+    EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "Restoring the changes received after the binary backup");
+
+    EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
+    EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
+    EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
+
+    // These mutexes are necessary to send messages to the listeners
+    auto endpoints = static_cast<fastdds::rtps::DiscoveryServerPDPEndpoints*>(builtin_endpoints_.get());
+    std::unique_lock<fastdds::RecursiveTimedMutex> lock(endpoints->reader.reader_->getMutex());
+    std::unique_lock<fastdds::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
+    std::unique_lock<fastdds::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
+
+    ddb::BinaryBackupReader reader(journal.data(), journal.size());
+    ddb::BinaryBackupChange change_read;
+    size_t valid_length = 0;
+    uint32_t replayed = 0;
+
+    if (reader.read_header(ddb::binary_backup_journal_magic))
+    {
+        valid_length = reader.position();
+        while (!reader.at_end())
+        {
+            // A record partially written when the server stopped ends the journal
+            uint32_t record_length = 0;
+            size_t record_position = reader.position() + 4;
+            if (!reader.read_uint32(record_length) || !reader.skip(record_length))
+            {
+                break;
+            }
+            ddb::BinaryBackupReader record(journal.data() + record_position, record_length);
+            if (!record.read_change(change_read) || !record.at_end())
+            {
+                break;
+            }
+            valid_length = reader.position();
+
+            // The change is passed to the listener of its kind, as if it had just been received
+            fastdds::rtps::GUID_t guid = fastdds::rtps::iHandle2GUID(change_read.instance_handle);
+            StatefulReader* change_reader = nullptr;
+            fastdds::rtps::ReaderListener* listener = nullptr;
+            if (ddb::DiscoveryDataBase::is_participant(guid))
+            {
+                change_reader = endpoints->reader.reader_;
+                listener = builtin_endpoints_->main_listener().get();
+            }
+            else if (ddb::DiscoveryDataBase::is_writer(guid))
+            {
+                change_reader = edp->publications_reader_.first;
+                listener = edp_pub_listener;
+            }
+            else if (ddb::DiscoveryDataBase::is_reader(guid))
+            {
+                change_reader = edp->subscriptions_reader_.first;
+                listener = edp_sub_listener;
+            }
+            else
+            {
+                continue;
+            }
+
+            fastdds::rtps::CacheChange_t* change = nullptr;
+            if (!change_reader->reserve_cache(change_read.length, change))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
+                continue;
+            }
+            change_read.copy_to(*change);
+
+            // The listeners remove the change from the history of the reader when they are done with it
+            if (!change_reader->get_history()->add_change(change))
+            {
+                change_reader->release_cache(change);
+                continue;
+            }
+            listener->on_new_cache_change_added(change_reader, change);
+            ++replayed;
+        }
+    }
+
+    EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, replayed << " changes restored from " << file_name);
+
+    if (valid_length != journal.size())
+    {
+        // Keep only the complete records, so the new ones are not appended after a broken one
+        EPROSIMA_LOG_WARNING(RTPS_PDP_SERVER, "Discarding the incomplete end of " << file_name);
+        std::string tmp_file_name = file_name + ".tmp";
+        std::ofstream journal_file(tmp_file_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        journal_file.write(reinterpret_cast<const char*>(journal.data()), valid_length);
+        journal_file.close();
+        journal.close();
+        bool replaced = static_cast<bool>(journal_file);
+#ifdef _WIN32
+        replaced = replaced && 0 == std::remove(file_name.c_str());
+#endif // ifdef _WIN32
+        replaced = replaced && 0 == std::rename(tmp_file_name.c_str(), file_name.c_str());
+        if (!replaced)
+        {
+            // The restored changes are already in the DDB, and will be in the next snapshot
+            std::remove(file_name.c_str());
+            std::remove(tmp_file_name.c_str());
+            return false;
+        }
+    }
     return true;
 }
 
 void PDPServer::process_backup_store()
 {
-    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Dump DDB in json backup");
-
-    // This will erase the last backup stored
-    std::ofstream backup_json_file;
-    backup_json_file.open(get_ddb_persistence_file_name(), std::ios_base::out);
-
-    // Set j with the json from database dump
-    nlohmann::json j;
-    discovery_db().to_json(j);
-    // setw makes pretty print for json
-    backup_json_file << std::setw(4) << j << std::endl;
-    backup_json_file.close();
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Dump DDB in binary backup");
+
+    discovery_db().to_binary(backup_buffer_);
+
+    // The snapshot is written aside and then replaces the last backup stored, so a crash while writing it
+    // never leaves a truncated backup
+    std::string file_name = get_ddb_persistence_file_name();
+    std::string tmp_file_name = file_name + ".tmp";
+    std::ofstream backup_file(tmp_file_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    backup_file.write(reinterpret_cast<const char*>(backup_buffer_.data()), backup_buffer_.size());
+    backup_file.close();
+    if (!backup_file)
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error writing DDB backup file " << tmp_file_name);
+        return;
+    }
+#ifdef _WIN32
+    std::remove(file_name.c_str());
+#endif // ifdef _WIN32
+    if (0 != std::rename(tmp_file_name.c_str(), file_name.c_str()))
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error replacing DDB backup file " << file_name);
+        return;
+    }
 
     // Clear queue ddb backup
     discovery_db_.clean_backup();
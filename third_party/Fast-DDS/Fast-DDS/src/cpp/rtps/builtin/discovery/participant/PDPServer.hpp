@@ -169,6 +169,9 @@ public:
     //! Get filename for discovery database file
     std::string get_ddb_persistence_file_name() const;
 
+    //! Get filename for discovery database file stored in json by previous versions
+    std::string get_ddb_legacy_persistence_file_name() const;
+
     //! Get filename for discovery database file
     std::string get_ddb_queue_persistence_file_name() const;
 
@@ -264,18 +267,22 @@ protected:
     bool process_backup_discovery_database_restore(
             nlohmann::json& ddb_json);
 
-    // Restore the backup file with the changes that were added to the DDB queues (and so acked)
+    // Method to restore de DiscoveryDataBase from a binary snapshot, like the json one
+    // The whole snapshot is checked and every change reserved before passing any of them to the listeners,
+    // so nothing is kept when it returns false
+    bool process_backup_discovery_database_restore(
+            const fastdds::rtps::octet* ddb_binary,
+            size_t length);
+
+    // Restore the journal with the changes that were received after the last snapshot
     // It reserves memory for the changes depending the pool, and send them by the listener to the DDB
-    // This method must be called with the DDB variable backup_in_progress as false
-    bool process_backup_restore_queue(
-            std::vector<nlohmann::json>& new_changes);
+    // This method must be called with the DDB variable backup_in_progress as false and before enabling the
+    // persistence, so the changes are not journaled again
+    bool process_backup_restore_queue();
 
-    // Reads the two backup files and stores each json objects in both arguments
-    // The first argument has the json object to restore the DDB
-    // The second argument has the json vector object to restore the changes that must be sent again to the queue
+    // Reads the json backup stored by previous versions
     bool read_backup(
-            nlohmann::json& ddb_json,
-            std::vector<nlohmann::json>& new_changes);
+            nlohmann::json& ddb_json);
 
     // General file name for the prefix of every backup file
     std::ostringstream get_persistence_file_name_() const;
@@ -377,6 +384,9 @@ private:
     //! TRANSIENT or TRANSIENT_LOCAL durability;
     fastdds::rtps::DurabilityKind_t durability_;
 
+    //! Buffer for the binary snapshot of the discovery database, kept to avoid allocations
+    std::vector<fastdds::rtps::octet> backup_buffer_;
+
 };
 
 } // namespace rtps
@@ -273,8 +273,11 @@ void PDPServerListener::on_new_cache_change_added(
             else
             {
                 // Update proxy
+                uint32_t added_builtin_endpoints =
+                        participant_data.m_available_builtin_endpoints & ~pdata->m_available_builtin_endpoints;
                 pdata->update_data(participant_data);
                 pdata->is_alive = true;
+                pdp_server()->assign_added_builtin_endpoints(*pdata, added_builtin_endpoints);
                 // Realease PDP mutex
                 lock.unlock();
 
@@ -295,6 +295,22 @@ void PDPSimple::announceParticipantState(
     }
 }
 
+void PDPSimple::announce_periodically()
+{
+    uint32_t full_period = m_discovery.discovery_config.full_announcement_period;
+    if (!enabled_ || full_period <= 1 || m_hasChangedLocalPDP || is_sending_initial_announcements() ||
+            0 == (++periodic_announcements_ % full_period))
+    {
+        announceParticipantState(false);
+        return;
+    }
+
+    // Participants that already know us only need to keep our lease alive. New participants get the full data
+    // when they are discovered, and the full data is resent every full_period announcements.
+    auto endpoints = dynamic_cast<fastdds::rtps::SimplePDPEndpoints*>(builtin_endpoints_.get());
+    endpoints->writer.writer_->send_announcement_heartbeat();
+}
+
 bool PDPSimple::createPDPEndpoints()
 {
     EPROSIMA_LOG_INFO(RTPS_PDP, "Beginning");
@@ -736,9 +752,10 @@ void PDPSimple::assign_low_level_remote_endpoints(
         mp_builtin->mp_WLP->assignRemoteEndpoints(pdata, notify_secure_endpoints);
     }
 
-    if (nullptr != mp_builtin->typelookup_manager_)
+    auto typelookup_manager = mp_builtin->typelookup_manager_.load();
+    if (nullptr != typelookup_manager)
     {
-        mp_builtin->typelookup_manager_->assign_remote_endpoints(pdata);
+        typelookup_manager->assign_remote_endpoints(pdata);
     }
 
     if (mp_EDP != nullptr)
@@ -91,6 +91,12 @@ public:
             bool new_change,
             bool dispose = false) override;
 
+    /**
+     * Periodic announcement of our local DPD.
+     * Only one of every \c full_announcement_period announcements carries the DPD, the rest send a HEARTBEAT.
+     */
+    void announce_periodically() override;
+
     /**
      * This method assigns remote endpoints to the builtin endpoints defined in this protocol. It also calls
      * the corresponding methods in EDP and WLP.
@@ -130,6 +136,9 @@ public:
 
 private:
 
+    //! Number of periodic announcements sent after the initial ones.
+    uint32_t periodic_announcements_ = 0;
+
     void initializeParticipantProxyData(
             ParticipantProxyData* participant_data) override;
 
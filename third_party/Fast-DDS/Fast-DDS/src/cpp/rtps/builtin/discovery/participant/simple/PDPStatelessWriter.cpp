@@ -26,6 +26,7 @@
 #include <set>
 #include <vector>
 
+#include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/common/LocatorList.hpp>
 #include <fastdds/rtps/history/WriterHistory.hpp>
 #include <fastdds/rtps/transport/NetworkBuffer.hpp>
@@ -33,6 +34,8 @@
 #include <fastdds/utils/TimedMutex.hpp>
 
 #include <rtps/builtin/data/ReaderProxyData.hpp>
+#include <rtps/messages/RTPSMessageGroup.hpp>
+#include <rtps/network/NetworkFactory.hpp>
 #include <rtps/participant/RTPSParticipantImpl.hpp>
 #include <rtps/writer/StatelessWriter.hpp>
 
@@ -101,6 +104,36 @@ void PDPStatelessWriter::send_periodic_announcement()
     reschedule_all_samples();
 }
 
+void PDPStatelessWriter::send_announcement_heartbeat()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    if (0 == history_->getHistorySize())
+    {
+        return;
+    }
+
+    SequenceNumber_t sequence_number = (*history_->changesBegin())->sequenceNumber;
+    mark_all_readers_interested();
+
+    LocatorSelectorSender& locator_selector = get_general_locator_selector();
+    std::lock_guard<LocatorSelectorSender> locator_selector_guard(locator_selector);
+    locator_selector.locator_selector.reset(true);
+    if (locator_selector.locator_selector.state_has_changed())
+    {
+        mp_RTPSParticipant->network_factory().select_locators(locator_selector.locator_selector);
+    }
+
+    try
+    {
+        RTPSMessageGroup group(mp_RTPSParticipant, this, &locator_selector);
+        group.add_heartbeat(sequence_number, sequence_number, ++heartbeat_count_, true, false);
+    }
+    catch (const RTPSMessageGroup::timeout&)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PDP, "Max blocking time reached");
+    }
+}
+
 bool PDPStatelessWriter::send_to_fixed_locators(
         const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
         const uint32_t& total_bytes,
@@ -84,6 +84,12 @@ public:
      */
     void send_periodic_announcement();
 
+    /**
+     * Send a HEARTBEAT with the sequence number of the current announcement to all the destinations,
+     * instead of the announcement itself.
+     */
+    void send_announcement_heartbeat();
+
 protected:
 
     bool send_to_fixed_locators(
@@ -144,6 +150,8 @@ private:
     mutable ResourceLimitedVector<GUID_t> interested_readers_;
     //! Whether we have set that all destinations are interested
     mutable bool should_reach_all_destinations_ = false;
+    //! Count of the HEARTBEATs sent instead of announcements
+    Count_t heartbeat_count_ = 0;
 
 };
 
@@ -0,0 +1,65 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstanceHandleHash.hpp
+ */
+
+#ifndef FASTDDS_RTPS_COMMON__INSTANCEHANDLEHASH_HPP
+#define FASTDDS_RTPS_COMMON__INSTANCEHANDLEHASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <fastdds/rtps/common/InstanceHandle.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Hash functor for InstanceHandle_t.
+ *
+ * The key hash is only an MD5 digest for big keys. Small keys are copied verbatim and padded with zeros, so all
+ * the 16 octets are mixed.
+ */
+struct InstanceHandleHash
+{
+    size_t operator ()(
+            const InstanceHandle_t& handle) const noexcept
+    {
+        const octet* value = handle.value;
+        uint64_t low = 0;
+        uint64_t high = 0;
+        std::memcpy(&low, value, sizeof(low));
+        std::memcpy(&high, value + sizeof(low), sizeof(high));
+
+        // Finalizer of MurmurHash3
+        uint64_t hash = low ^ (high * 0x9E3779B97F4A7C15ull);
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+        return static_cast<size_t>(hash);
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_COMMON__INSTANCEHANDLEHASH_HPP
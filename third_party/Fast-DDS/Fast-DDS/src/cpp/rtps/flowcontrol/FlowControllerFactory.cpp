@@ -1,12 +1,42 @@
 #include "FlowControllerFactory.hpp"
 #include "FlowControllerImpl.hpp"
+#include "FlowControllerShardedImpl.hpp"
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.hpp>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+/*!
+ * Create a flow controller whose writers are distributed among several sender threads.
+ *
+ * @param participant Participant owner of the flow controller.
+ * @param flow_controller_descr FlowController descriptor.
+ * @param sender_threads Number of sender threads.
+ * @param async_index Index used to identify the first sender thread.
+ * @param sender_thread_settings Settings of the sender threads.
+ * @return Pointer to the new flow controller.
+ */
+template<typename SampleScheduling>
+static FlowController* create_sharded_flow_controller(
+        RTPSParticipantImpl* participant,
+        const FlowControllerDescriptor& flow_controller_descr,
+        uint32_t sender_threads,
+        uint32_t async_index,
+        const ThreadSettings& sender_thread_settings)
+{
+    if (0 < flow_controller_descr.max_bytes_per_period)
+    {
+        return new FlowControllerShardedImpl<FlowControllerLimitedAsyncPublishMode, SampleScheduling>(participant,
+                       &flow_controller_descr, sender_threads, async_index, sender_thread_settings);
+    }
+
+    return new FlowControllerShardedImpl<FlowControllerAsyncPublishMode, SampleScheduling>(participant,
+                   &flow_controller_descr, sender_threads, async_index, sender_thread_settings);
+}
+
 void FlowControllerFactory::init(
         fastdds::rtps::RTPSParticipantImpl* participant)
 {
@@ -60,7 +90,48 @@ void FlowControllerFactory::register_flow_controller (
 
     const ThreadSettings& sender_thread_settings = flow_controller_descr.sender_thread;
 
-    if (0 < flow_controller_descr.max_bytes_per_period)
+    uint32_t sender_threads = get_sender_threads(flow_controller_descr.name);
+
+    if (1 < sender_threads)
+    {
+        // Writers distributed among several sender threads, splitting the bandwidth limitation if any.
+        FlowController* flow_controller = nullptr;
+        switch (flow_controller_descr.scheduler)
+        {
+            case FlowControllerSchedulerPolicy::FIFO:
+                flow_controller = create_sharded_flow_controller<FlowControllerFifoSchedule>(participant_,
+                                flow_controller_descr, sender_threads, async_controller_index_, sender_thread_settings);
+                break;
+            case FlowControllerSchedulerPolicy::ROUND_ROBIN:
+                flow_controller = create_sharded_flow_controller<FlowControllerRoundRobinSchedule>(participant_,
+                                flow_controller_descr, sender_threads, async_controller_index_, sender_thread_settings);
+                break;
+            case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
+                flow_controller = create_sharded_flow_controller<FlowControllerHighPrioritySchedule>(participant_,
+                                flow_controller_descr, sender_threads, async_controller_index_, sender_thread_settings);
+                break;
+            case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
+                flow_controller = create_sharded_flow_controller<FlowControllerPriorityWithReservationSchedule>(
+                    participant_, flow_controller_descr, sender_threads, async_controller_index_,
+                    sender_thread_settings);
+                break;
+            case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                flow_controller = create_sharded_flow_controller<FlowControllerEarliestDeadlineFirstSchedule>(
+                    participant_, flow_controller_descr, sender_threads, async_controller_index_,
+                    sender_thread_settings);
+                break;
+            default:
+                assert(false);
+        }
+
+        if (nullptr != flow_controller)
+        {
+            async_controller_index_ += sender_threads;
+            flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                        flow_controller_descr.name, std::unique_ptr<FlowController>(flow_controller)));
+        }
+    }
+    else if (0 < flow_controller_descr.max_bytes_per_period)
     {
         switch (flow_controller_descr.scheduler)
         {
@@ -96,6 +167,14 @@ void FlowControllerFactory::register_flow_controller (
                                 FlowControllerPriorityWithReservationSchedule>(participant_,
                                 &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
                 break;
+            case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                                FlowControllerEarliestDeadlineFirstSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
             default:
                 assert(false);
         }
@@ -136,12 +215,47 @@ void FlowControllerFactory::register_flow_controller (
                                 FlowControllerPriorityWithReservationSchedule>(participant_,
                                 &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
                 break;
+            case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
+                                FlowControllerEarliestDeadlineFirstSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
             default:
                 assert(false);
         }
     }
 }
 
+uint32_t FlowControllerFactory::get_sender_threads(
+        const std::string& flow_controller_name) const
+{
+    uint32_t sender_threads = 1;
+
+    if (nullptr != participant_)
+    {
+        const std::string* sender_threads_property = PropertyPolicyHelper::find_property(
+            participant_->get_attributes().properties,
+            "fastdds.flow_controller." + flow_controller_name + ".sender_threads");
+        if (nullptr != sender_threads_property)
+        {
+            try
+            {
+                sender_threads = static_cast<uint32_t>((std::max)(std::stoul(*sender_threads_property), 1ul));
+            }
+            catch (const std::exception& e)
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT, "Error parsing sender_threads property of FlowController " <<
+                        flow_controller_name << ": " << e.what());
+            }
+        }
+    }
+
+    return sender_threads;
+}
+
 /*!
  * Get a FlowController given its name.
  *
@@ -62,6 +62,16 @@ public:
 
 private:
 
+    /*!
+     * Get the number of sender threads of a flow controller, configured on the participant's property
+     * "fastdds.flow_controller.<name>.sender_threads".
+     *
+     * @param flow_controller_name Name of the FlowController.
+     * @return Number of sender threads. 1 if not configured.
+     */
+    uint32_t get_sender_threads(
+            const std::string& flow_controller_name) const;
+
     fastdds::rtps::RTPSParticipantImpl* participant_ = nullptr;
 
     //! Stores the created flow controllers.
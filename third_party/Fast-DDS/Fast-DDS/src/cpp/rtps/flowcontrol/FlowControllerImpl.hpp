@@ -4,8 +4,13 @@
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <algorithm>
+#include <functional>
+#include <limits>
 #include <map>
+#include <queue>
 #include <unordered_map>
+#include <vector>
 
 #include "FlowController.hpp"
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
@@ -183,6 +188,118 @@ private:
     ListInfo old_ones_;
 };
 
+/*!
+ * Bandwidth limitation shared by several sender threads.
+ *
+ * Time is split in consecutive periods of fixed length, and at most max_bytes_per_period bytes are granted on each of
+ * them. The number of the current period and the bytes already granted on it are kept together on a single atomic
+ * word, so granting bytes never blocks and bytes granted on a period are never accounted on the next one.
+ */
+class FlowControllerTokenBucket
+{
+public:
+
+    FlowControllerTokenBucket(
+            uint32_t max_bytes_per_period,
+            uint64_t period_ms)
+        : origin_(std::chrono::steady_clock::now())
+        , period_((std::max)(std::chrono::steady_clock::duration(std::chrono::milliseconds(period_ms)),
+                std::chrono::steady_clock::duration(1)))
+        , max_bytes_per_period_(max_bytes_per_period)
+    {
+    }
+
+    //! @return Number of the current period.
+    uint32_t current_period() const
+    {
+        return static_cast<uint32_t>((std::chrono::steady_clock::now() - origin_) / period_);
+    }
+
+    /*!
+     * Get the time point when a period ends.
+     *
+     * @param period Number of the period.
+     * @return Time point where the period ends.
+     */
+    std::chrono::steady_clock::time_point period_end(
+            uint32_t period) const
+    {
+        return origin_ + period_ * (static_cast<uint64_t>(period) + 1);
+    }
+
+    /*!
+     * Try to take bytes from the current period.
+     *
+     * @param [in] bytes Number of bytes requested.
+     * @param [out] period Number of the period on which the bytes were granted.
+     * @return Number of bytes granted, which can be lower than the requested ones, or 0 if the current period has
+     * been exhausted.
+     */
+    uint32_t acquire(
+            uint32_t bytes,
+            uint32_t& period)
+    {
+        period = current_period();
+        uint64_t state = state_.load(std::memory_order_relaxed);
+        uint64_t desired = 0;
+        uint32_t granted = 0;
+
+        do
+        {
+            uint32_t state_period = static_cast<uint32_t>(state >> 32);
+            if (0 < static_cast<int32_t>(state_period - period))
+            {
+                // Another thread already moved to a later period.
+                period = state_period;
+            }
+
+            uint32_t used = (period == state_period) ? static_cast<uint32_t>(state & 0xFFFFFFFFu) : 0u;
+            granted = (std::min)(bytes, max_bytes_per_period_ - used);
+            if (0 == granted)
+            {
+                break;
+            }
+            desired = (static_cast<uint64_t>(period) << 32) | (used + granted);
+        } while (!state_.compare_exchange_weak(state, desired, std::memory_order_relaxed));
+
+        return granted;
+    }
+
+    /*!
+     * Give back bytes that were granted but not sent.
+     * Nothing is done when the period on which they were granted has already finished.
+     *
+     * @param bytes Number of bytes to give back.
+     * @param period Number of the period on which the bytes were granted.
+     */
+    void release(
+            uint32_t bytes,
+            uint32_t period)
+    {
+        uint64_t state = state_.load(std::memory_order_relaxed);
+
+        do
+        {
+            uint32_t used = static_cast<uint32_t>(state & 0xFFFFFFFFu);
+            if (0 == bytes || period != static_cast<uint32_t>(state >> 32) || used < bytes)
+            {
+                break;
+            }
+        } while (!state_.compare_exchange_weak(state, state - bytes, std::memory_order_relaxed));
+    }
+
+private:
+
+    const std::chrono::steady_clock::time_point origin_;
+
+    const std::chrono::steady_clock::duration period_;
+
+    const uint32_t max_bytes_per_period_;
+
+    //! Number of the period on the high word, bytes granted on that period on the low word.
+    std::atomic<uint64_t> state_ {0};
+};
+
 /** Classes used to specify FlowController's publication model **/
 
 //! Only sends new samples synchronously. There is no mechanism to send old ones.
@@ -307,7 +424,18 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
         }
 
-        bool ret = (max_bytes_per_period - group.get_current_bytes_processed()) > size_to_check;
+        bool ret = false;
+
+        if (nullptr == token_bucket)
+        {
+            ret = (max_bytes_per_period - group.get_current_bytes_processed()) > size_to_check;
+        }
+        else
+        {
+            ret = remaining_credit() > size_to_check ||
+                    (0 < take_credit((std::max)(credit_quantum, size_to_check + 1)) &&
+                    remaining_credit() > size_to_check);
+        }
 
         if (!ret)
         {
@@ -326,6 +454,11 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
     bool wait(
             std::unique_lock<fastdds::TimedMutex>& lock)
     {
+        if (nullptr != token_bucket)
+        {
+            return wait_shared_period(lock);
+        }
+
         auto lapse = std::chrono::steady_clock::now() - last_period_;
         bool reset_limit = true;
 
@@ -357,7 +490,8 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
     {
         if (DeliveryRetCode::EXCEEDED_LIMIT == ret_value)
         {
-            force_wait_ = true;
+            // With a shared bandwidth, the bytes left on the period may still be taken from the other threads.
+            force_wait_ = nullptr == token_bucket || 0 == take_credit(credit_quantum);
         }
     }
 
@@ -365,8 +499,88 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
     std::chrono::milliseconds period_ms;
 
+    //! Bandwidth shared with other sender threads, or nullptr when this thread has the whole limitation.
+    FlowControllerTokenBucket* token_bucket = nullptr;
+
+    //! Bytes taken at once from token_bucket.
+    uint32_t credit_quantum = 0;
+
 private:
 
+    //! @return Bytes granted by token_bucket on the current period which have not been sent yet.
+    uint32_t remaining_credit() const
+    {
+        uint32_t processed = group.get_current_bytes_processed();
+        return granted_bytes_ > processed ? granted_bytes_ - processed : 0u;
+    }
+
+    /*!
+     * Take bytes from token_bucket and allow the group to send them.
+     *
+     * @param bytes Number of bytes requested.
+     * @return Number of bytes granted.
+     */
+    uint32_t take_credit(
+            uint32_t bytes)
+    {
+        uint32_t period = 0;
+        uint32_t granted = token_bucket->acquire(bytes, period);
+        if (period != granted_period_)
+        {
+            // The bytes granted on a previous period cannot be used anymore.
+            granted_period_ = period;
+            granted_bytes_ = 0;
+            group.reset_current_bytes_processed();
+        }
+        granted_bytes_ += granted;
+        limit_group_to_credit();
+        return granted;
+    }
+
+    /*!
+     * Wait until there is a new change added or the current period of token_bucket ends.
+     * The bytes not sent are given back before waiting for a new change, so they can be used by other threads.
+     *
+     * @return false if the condition_variable was awaken because a new change was added. true if the period ended.
+     */
+    bool wait_shared_period(
+            std::unique_lock<fastdds::TimedMutex>& lock)
+    {
+        if (!force_wait_)
+        {
+            uint32_t unused = remaining_credit();
+            token_bucket->release(unused, granted_period_);
+            granted_bytes_ -= unused;
+            limit_group_to_credit();
+        }
+
+        auto period_end = token_bucket->period_end(granted_period_);
+        auto now = std::chrono::steady_clock::now();
+        if (now < period_end && std::cv_status::no_timeout == cv.wait_for(lock, period_end - now))
+        {
+            return false;
+        }
+
+        granted_period_ = token_bucket->current_period();
+        granted_bytes_ = 0;
+        force_wait_ = false;
+        group.reset_current_bytes_processed();
+        limit_group_to_credit();
+        return true;
+    }
+
+    void limit_group_to_credit()
+    {
+        // A limitation of 0 bytes would disable it.
+        group.set_sent_bytes_limitation((std::max)(granted_bytes_, 1u));
+    }
+
+    //! Period of token_bucket on which granted_bytes_ were taken.
+    uint32_t granted_period_ = 0;
+
+    //! Bytes taken from token_bucket on granted_period_, including the ones already sent.
+    uint32_t granted_bytes_ = 0;
+
     bool force_wait_ = false;
 
     std::chrono::steady_clock::time_point last_period_ = std::chrono::steady_clock::now();
@@ -921,6 +1135,278 @@ private:
     uint32_t size_being_processed_ = 0;
 };
 
+//! Earliest deadline first scheduling
+struct FlowControllerEarliestDeadlineFirstSchedule
+{
+    void register_writer(
+            BaseWriter* writer)
+    {
+        assert(nullptr != writer);
+        // Writers without a deadline are sent after the ones with it, in the order their samples were added.
+        int64_t relative_deadline_ns = no_deadline_ns;
+        auto property = PropertyPolicyHelper::find_property(
+            writer->getAttributes().properties, "fastdds.sfc.deadline_us");
+
+        if (nullptr != property)
+        {
+            char* ptr = nullptr;
+            unsigned long long deadline_us = strtoull(property->c_str(), &ptr, 10);
+
+            if (property->c_str() != ptr)     // A valid integer was read.
+            {
+                // Longer deadlines are clamped, but still sent before writers without a deadline.
+                relative_deadline_ns = static_cast<int64_t>(
+                    (std::min)(deadline_us, static_cast<unsigned long long>(max_deadline_ns / 1000)) * 1000);
+            }
+            else
+            {
+                EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                        "Not numerical value for fastdds.sfc.deadline_us property. Writer scheduled without deadline");
+            }
+        }
+
+        auto ret = writers_queue_.emplace(writer, WriterQueue());
+        (void)ret;
+        assert(ret.second);
+        ret.first->second.relative_deadline_ns = relative_deadline_ns;
+    }
+
+    void unregister_writer(
+            BaseWriter* writer)
+    {
+        auto it = writers_queue_.find(writer);
+        assert(it != writers_queue_.end());
+        writers_queue_.erase(it);
+
+        pending_writers_.erase(std::remove(pending_writers_.begin(), pending_writers_.end(), writer),
+                pending_writers_.end());
+
+        if (writer == writer_being_processed_)
+        {
+            writer_being_processed_ = nullptr;
+        }
+
+        // The entry of the unregistered writer is removed, so it cannot be taken by a writer registered later on the
+        // same address.
+        compact_heap();
+    }
+
+    void work_done()
+    {
+        // The head of the writer just processed has changed.
+        if (nullptr != writer_being_processed_)
+        {
+            schedule(writer_being_processed_, writers_queue_.at(writer_being_processed_));
+            writer_being_processed_ = nullptr;
+        }
+    }
+
+    void add_new_sample(
+            BaseWriter* writer,
+            CacheChange_t* change)
+    {
+        add_sample(writer, change, false);
+    }
+
+    void add_old_sample(
+            BaseWriter* writer,
+            CacheChange_t* change)
+    {
+        add_sample(writer, change, true);
+    }
+
+    /*!
+     * Returns the queued sample with the earliest due time.
+     *
+     * Each writer has at most one valid entry on the heap. Entries are not updated when a sample is removed from a
+     * queue. They are validated against the current head of their writer's queue when they reach the top of the heap.
+     */
+    CacheChange_t* get_next_change_nts()
+    {
+        if (nullptr != writer_being_processed_)
+        {
+            // The previous sample was not sent, so its writer has to be scheduled again.
+            schedule(writer_being_processed_, writers_queue_.at(writer_being_processed_));
+            writer_being_processed_ = nullptr;
+        }
+
+        while (!due_heap_.empty())
+        {
+            element top = due_heap_.top();
+            due_heap_.pop();
+
+            auto writer = writers_queue_.find(top.second);
+            if (writers_queue_.end() == writer || !is_current_entry(writer->second, top.first))
+            {
+                // Stale entry.
+                continue;
+            }
+
+            writer->second.queued = false;
+            CacheChange_t* change = writer->second.queue.get_next_change();
+
+            if (nullptr != change && change->writer_info.due_time_ns == top.first)
+            {
+                writer_being_processed_ = top.second;
+                return change;
+            }
+
+            // The head was removed from the queue since the entry was pushed.
+            schedule(top.second, writer->second);
+        }
+
+        return nullptr;
+    }
+
+    void add_interested_changes_to_queue_nts()
+    {
+        // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
+        for (BaseWriter* writer : pending_writers_)
+        {
+            WriterQueue& writer_queue = writers_queue_.at(writer);
+            writer_queue.queue.add_interested_changes_to_queue();
+
+            if (writer != writer_being_processed_)
+            {
+                schedule(writer, writer_queue);
+            }
+        }
+        pending_writers_.clear();
+    }
+
+    void set_bandwith_limitation(
+            uint32_t) const
+    {
+    }
+
+    void trigger_bandwidth_limit_reset() const
+    {
+    }
+
+private:
+
+    //! Relative deadline of writers without one. Their due times are later than the ones of any writer with deadline.
+    static constexpr int64_t no_deadline_ns = (std::numeric_limits<int64_t>::max)() / 2;
+
+    //! Maximum relative deadline of writers with one.
+    static constexpr int64_t max_deadline_ns = no_deadline_ns / 2;
+
+    //! Due time in steady clock nanoseconds, and writer whose queue has a sample with that due time on its head.
+    using element = std::pair<int64_t, BaseWriter*>;
+
+    using heap = std::priority_queue<element, std::vector<element>, std::greater<element>>;
+
+    struct WriterQueue
+    {
+        FlowQueue queue;
+
+        //! Relative deadline in nanoseconds.
+        int64_t relative_deadline_ns = 0;
+
+        //! Whether the writer has a valid entry on the heap.
+        bool queued = false;
+
+        //! Due time of the valid entry of the writer on the heap.
+        int64_t queued_due_time_ns = 0;
+    };
+
+    static bool is_current_entry(
+            const WriterQueue& writer_queue,
+            int64_t due_time_ns)
+    {
+        return writer_queue.queued && writer_queue.queued_due_time_ns == due_time_ns;
+    }
+
+    void add_sample(
+            BaseWriter* writer,
+            CacheChange_t* change,
+            bool is_old)
+    {
+        auto it = writers_queue_.find(writer);
+        assert(it != writers_queue_.end());
+        if (!change->writer_info.is_linked.load())
+        {
+            change->writer_info.due_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count() + it->second.relative_deadline_ns;
+        }
+
+        if (is_old)
+        {
+            it->second.queue.add_old_sample(change);
+        }
+        else
+        {
+            it->second.queue.add_new_sample(change);
+        }
+
+        if (pending_writers_.end() == std::find(pending_writers_.begin(), pending_writers_.end(), writer))
+        {
+            pending_writers_.push_back(writer);
+        }
+    }
+
+    /*!
+     * Ensures the writer's entry on the heap matches the head of its queue.
+     * A previous entry of the writer, if any, becomes stale.
+     */
+    void schedule(
+            BaseWriter* writer,
+            WriterQueue& writer_queue)
+    {
+        CacheChange_t* head = writer_queue.queue.get_next_change();
+        if (nullptr == head)
+        {
+            writer_queue.queued = false;
+            return;
+        }
+
+        if (is_current_entry(writer_queue, head->writer_info.due_time_ns))
+        {
+            return;
+        }
+
+        writer_queue.queued = true;
+        writer_queue.queued_due_time_ns = head->writer_info.due_time_ns;
+        due_heap_.emplace(head->writer_info.due_time_ns, writer);
+
+        // Stale entries are dropped when they reach the top, but bound them in case they never do.
+        if (due_heap_.size() > 2 * writers_queue_.size() + 16)
+        {
+            compact_heap();
+        }
+    }
+
+    //! Rebuild the heap with only the valid entries.
+    void compact_heap()
+    {
+        std::vector<element> entries;
+        entries.reserve(writers_queue_.size());
+        while (!due_heap_.empty())
+        {
+            const element& top = due_heap_.top();
+            auto writer = writers_queue_.find(top.second);
+            if (writers_queue_.end() != writer && is_current_entry(writer->second, top.first))
+            {
+                entries.push_back(top);
+            }
+            due_heap_.pop();
+        }
+        due_heap_ = heap(std::greater<element>(), std::move(entries));
+    }
+
+    //! Queue, relative deadline and heap entry of each writer.
+    std::unordered_map<BaseWriter*, WriterQueue> writers_queue_;
+
+    //! Writers with interested samples not yet added to their queue.
+    //! Should be protected with changes_interested_mutex.
+    std::vector<BaseWriter*> pending_writers_;
+
+    //! Min-heap of queue heads by due time. Holds at most one valid entry per writer.
+    heap due_heap_;
+
+    BaseWriter* writer_being_processed_ = nullptr;
+};
+
 template<typename PublishMode, typename SampleScheduling>
 class FlowControllerImpl : public FlowController
 {
@@ -1050,6 +1536,25 @@ public:
         return get_max_payload_impl();
     }
 
+    /*!
+     * Shares the bandwidth limitation with other flow controllers, instead of having the whole of it.
+     * Only available with FlowControllerLimitedAsyncPublishMode. Must be called before @ref init.
+     *
+     * @param token_bucket Bucket all the bytes sent are taken from. Must outlive this object.
+     * @param credit_quantum Bytes taken from the bucket at once.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, void>::type
+    share_bandwidth(
+            FlowControllerTokenBucket* token_bucket,
+            uint32_t credit_quantum)
+    {
+        async_mode.token_bucket = token_bucket;
+        async_mode.credit_quantum = credit_quantum;
+        // Nothing can be sent until bytes are taken from the bucket.
+        async_mode.group.set_sent_bytes_limitation(1);
+    }
+
 private:
 
     /*!
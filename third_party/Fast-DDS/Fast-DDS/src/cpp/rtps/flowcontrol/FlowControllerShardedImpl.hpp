@@ -0,0 +1,185 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlowControllerShardedImpl.hpp
+ */
+
+#ifndef FASTDDS_RTPS_FLOWCONTROL__FLOWCONTROLLERSHARDEDIMPL_HPP
+#define FASTDDS_RTPS_FLOWCONTROL__FLOWCONTROLLERSHARDEDIMPL_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "FlowController.hpp"
+#include "FlowControllerImpl.hpp"
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
+
+#include <rtps/participant/RTPSParticipantImpl.hpp>
+#include <rtps/writer/BaseWriter.hpp>
+#include <utils/Fnv1a.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Asynchronous flow controller whose writers are distributed among several sender threads.
+ *
+ * Each shard is a complete FlowControllerImpl, with its own scheduler, queues, mutexes and sender thread, and each
+ * writer is assigned to one shard by the hash of its GUID, so writers on different shards never contend.
+ * When the bandwidth is limited, all the shards take the bytes they send from a single FlowControllerTokenBucket, so
+ * together they never send more than the configured limitation, and a single busy shard can use the bandwidth left
+ * by the idle ones.
+ */
+template<typename PublishMode, typename SampleScheduling>
+class FlowControllerShardedImpl : public FlowController
+{
+    using shard = FlowControllerImpl<PublishMode, SampleScheduling>;
+
+public:
+
+    /*!
+     * @param participant Participant owner of the flow controller.
+     * @param descriptor Descriptor of the flow controller.
+     * @param num_shards Number of sender threads. Must be greater than 1.
+     * @param async_index Index used to identify the thread of the first shard. The following shards use the following
+     * indexes.
+     * @param thread_settings Settings of the sender threads.
+     */
+    FlowControllerShardedImpl(
+            RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor,
+            uint32_t num_shards,
+            uint32_t async_index,
+            ThreadSettings thread_settings)
+    {
+        assert(nullptr != descriptor);
+        assert(1 < num_shards);
+
+        uint32_t credit_quantum = 0;
+        if (0 < descriptor->max_bytes_per_period)
+        {
+            uint32_t max_bytes_per_period = static_cast<uint32_t>(descriptor->max_bytes_per_period);
+            token_bucket_.reset(new FlowControllerTokenBucket(max_bytes_per_period, descriptor->period_ms));
+            // Bytes taken from the bucket at once, so shards do not hit the shared atomic on every sample.
+            credit_quantum = (std::max)(max_bytes_per_period / (4 * num_shards), 1u);
+        }
+
+        shards_.reserve(num_shards);
+        for (uint32_t i = 0; i < num_shards; ++i)
+        {
+            shards_.emplace_back(new shard(participant, descriptor, async_index + i, thread_settings));
+            share_bandwidth(*shards_.back(), credit_quantum);
+        }
+    }
+
+    virtual ~FlowControllerShardedImpl() noexcept
+    {
+    }
+
+    /*!
+     * Initializes the flow controller, starting the sender thread of each shard.
+     */
+    void init() override
+    {
+        for (auto& s : shards_)
+        {
+            s->init();
+        }
+    }
+
+    void register_writer(
+            BaseWriter* writer) override
+    {
+        shard_of(writer->getGuid()).register_writer(writer);
+    }
+
+    void unregister_writer(
+            BaseWriter* writer) override
+    {
+        shard_of(writer->getGuid()).unregister_writer(writer);
+    }
+
+    bool add_new_sample(
+            BaseWriter* writer,
+            CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        return shard_of(writer->getGuid()).add_new_sample(writer, change, max_blocking_time);
+    }
+
+    bool add_old_sample(
+            BaseWriter* writer,
+            CacheChange_t* change) override
+    {
+        return shard_of(writer->getGuid()).add_old_sample(writer, change);
+    }
+
+    bool remove_change(
+            CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        assert(nullptr != change);
+        return shard_of(change->writerGUID).remove_change(change, max_blocking_time);
+    }
+
+    uint32_t get_max_payload() override
+    {
+        return shards_.front()->get_max_payload();
+    }
+
+private:
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, void>::type
+    share_bandwidth(
+            shard& s,
+            uint32_t credit_quantum)
+    {
+        s.share_bandwidth(token_bucket_.get(), credit_quantum);
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, void>::type
+    share_bandwidth(
+            shard&,
+            uint32_t)
+    {
+    }
+
+    shard& shard_of(
+            const GUID_t& guid)
+    {
+        return *shards_[fnv1a_32(guid) % shards_.size()];
+    }
+
+    //! Bandwidth limitation shared by all the shards. Declared before them, as they use it until destroyed.
+    std::unique_ptr<FlowControllerTokenBucket> token_bucket_;
+
+    std::vector<std::unique_ptr<shard>> shards_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_FLOWCONTROL__FLOWCONTROLLERSHARDEDIMPL_HPP
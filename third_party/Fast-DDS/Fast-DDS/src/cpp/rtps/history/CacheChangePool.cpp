@@ -26,19 +26,37 @@
 #include <cstring>
 #include <cassert>
 #include <limits>
+#include <new>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+//! Number of caches allocated at once when a DYNAMIC_REUSABLE_MEMORY_MODE pool grows.
+static constexpr uint32_t reusable_slab_size = 16;
+
 CacheChangePool::~CacheChangePool()
 {
     EPROSIMA_LOG_INFO(RTPS_UTILS, "ChangePool destructor");
 
-    // Deletion process does not depend on the memory management policy
-    for (CacheChange_t* cache : all_caches_)
+    if (slabs_.empty())
+    {
+        // Caches were allocated one by one
+        for (CacheChange_t* cache : all_caches_)
+        {
+            destroy_change(cache);
+        }
+    }
+    else
     {
-        destroy_change(cache);
+        for (const auto& slab : slabs_)
+        {
+            for (uint32_t i = 0; i < slab.second; ++i)
+            {
+                slab.first[i].~CacheChange_t();
+            }
+            ::operator delete(slab.first);
+        }
     }
 }
 
@@ -109,8 +127,70 @@ void CacheChangePool::return_cache_to_pool(
     ch->write_params.related_sample_identity(SampleIdentity::unknown());
     ch->setFragmentSize(0);
     ch->vendor_id = c_VendorId_Unknown;
-    assert(free_caches_.end() == std::find(free_caches_.begin(), free_caches_.end(), ch));
-    free_caches_.push_back(ch);
+#ifndef NDEBUG
+    for (CacheChange_t* free_ch = free_caches_head_; nullptr != free_ch; free_ch = free_ch->writer_info.next)
+    {
+        assert(free_ch != ch);
+    }
+#endif // ifndef NDEBUG
+    push_free_cache(ch);
+}
+
+void CacheChangePool::push_free_cache(
+        CacheChange_t* ch)
+{
+    ch->writer_info.next = free_caches_head_;
+    free_caches_head_ = ch;
+    ++free_caches_count_;
+}
+
+CacheChange_t* CacheChangePool::pop_free_cache()
+{
+    CacheChange_t* ch = free_caches_head_;
+    assert(nullptr != ch);
+    free_caches_head_ = ch->writer_info.next;
+    ch->writer_info.next = nullptr;
+    --free_caches_count_;
+    return ch;
+}
+
+void CacheChangePool::allocate_slab(
+        uint32_t num_caches)
+{
+    CacheChange_t* slab = static_cast<CacheChange_t*>(::operator new(sizeof(CacheChange_t) * num_caches));
+    for (uint32_t i = 0; i < num_caches; ++i)
+    {
+        new (&slab[i]) CacheChange_t();
+    }
+    slabs_.emplace_back(slab, num_caches);
+
+    all_caches_.reserve(all_caches_.size() + num_caches);
+    for (uint32_t i = 0; i < num_caches; ++i)
+    {
+        all_caches_.push_back(&slab[i]);
+    }
+
+    // Push in reverse order, so caches are reserved in memory order
+    for (uint32_t i = num_caches; i > 0; --i)
+    {
+        push_free_cache(&slab[i - 1]);
+    }
+
+    current_pool_size_ += num_caches;
+}
+
+bool CacheChangePool::grow_reusable()
+{
+    assert(use_slabs_ && memory_mode_ == DYNAMIC_REUSABLE_MEMORY_MODE);
+
+    if (current_pool_size_ >= max_pool_size_)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_HISTORY, "Maximum number of allowed reserved caches reached");
+        return false;
+    }
+
+    allocate_slab((std::min)(reusable_slab_size, max_pool_size_ - current_pool_size_));
+    return true;
 }
 
 bool CacheChangePool::allocateGroup(
@@ -135,14 +215,19 @@ bool CacheChangePool::allocateGroup(
         return false;
     }
 
+    if (use_slabs_)
+    {
+        allocate_slab(group_size);
+        return true;
+    }
+
     all_caches_.reserve(desired_size);
-    free_caches_.reserve(free_caches_.size() + group_size);
 
     while (current_pool_size_ < desired_size)
     {
         CacheChange_t* ch = create_change();
         all_caches_.push_back(ch);
-        free_caches_.push_back(ch);
+        push_free_cache(ch);
         ++current_pool_size_;
     }
 
@@ -191,7 +276,7 @@ bool CacheChangePool::reserve_cache(
 {
     cache_change = nullptr;
 
-    if (free_caches_.empty())
+    if (nullptr == free_caches_head_)
     {
         switch (memory_mode_)
         {
@@ -203,8 +288,19 @@ bool CacheChangePool::reserve_cache(
                 }
                 break;
 
-            case DYNAMIC_RESERVE_MEMORY_MODE:
             case DYNAMIC_REUSABLE_MEMORY_MODE:
+                if (use_slabs_)
+                {
+                    if (!grow_reusable())
+                    {
+                        return false;
+                    }
+                    break;
+                }
+                cache_change = allocateSingle(); //Allocates a single, empty CacheChange
+                return cache_change != nullptr;
+
+            case DYNAMIC_RESERVE_MEMORY_MODE:
                 cache_change = allocateSingle(); //Allocates a single, empty CacheChange
                 return cache_change != nullptr;
 
@@ -213,8 +309,23 @@ bool CacheChangePool::reserve_cache(
         }
     }
 
-    cache_change = free_caches_.back();
-    free_caches_.pop_back();
+    cache_change = pop_free_cache();
+    return true;
+}
+
+bool CacheChangePool::release_caches(
+        CacheChange_t* const* cache_changes,
+        size_t num_changes)
+{
+    if (DYNAMIC_RESERVE_MEMORY_MODE == memory_mode_)
+    {
+        return IChangePool::release_caches(cache_changes, num_changes);
+    }
+
+    for (size_t i = 0; i < num_changes; ++i)
+    {
+        return_cache_to_pool(cache_changes[i]);
+    }
     return true;
 }
 
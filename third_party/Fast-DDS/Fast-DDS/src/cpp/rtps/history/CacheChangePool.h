@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstddef>
+#include <utility>
 
 namespace eprosima {
 namespace fastdds {
@@ -37,6 +38,10 @@ namespace rtps {
 /**
  * Class CacheChangePool, used by the HistoryCache to pre-reserve a number of CacheChange_t to avoid dynamically
  * reserving memory in the middle of execution loops.
+ *
+ * Free cache changes are kept on an intrusive list linked through @c writer_info.next, so reserving and releasing
+ * a cache change does not touch any container. Unless a derived class allocates the cache changes itself, they are
+ * allocated in contiguous slabs.
  * @ingroup COMMON_MODULE
  */
 class CacheChangePool : public IChangePool
@@ -55,6 +60,7 @@ public:
     CacheChangePool(
             const PoolConfig& config,
             UnaryFunction f)
+        : use_slabs_(true)
     {
         init(config);
         std::for_each(all_caches_.begin(), all_caches_.end(), f);
@@ -67,6 +73,7 @@ public:
      */
     CacheChangePool(
             const PoolConfig& config)
+        : use_slabs_(true)
     {
         init(config);
     }
@@ -77,6 +84,10 @@ public:
     bool release_cache(
             CacheChange_t* cache_change) override;
 
+    bool release_caches(
+            CacheChange_t* const* cache_changes,
+            size_t num_changes) override;
+
     //!Get the size of the cache vector; all of them (reserved and not reserved).
     size_t get_allCachesSize()
     {
@@ -86,7 +97,7 @@ public:
     //!Get the number of free caches.
     size_t get_freeCachesSize()
     {
-        return free_caches_.size();
+        return free_caches_count_;
     }
 
 protected:
@@ -116,12 +127,34 @@ private:
     uint32_t max_pool_size_ = 0;
     MemoryManagementPolicy_t memory_mode_ = MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
 
-    std::vector<CacheChange_t*> free_caches_;
+    //! Head of the intrusive list of free caches, linked through writer_info.next.
+    CacheChange_t* free_caches_head_ = nullptr;
+    //! Number of caches on the free list.
+    size_t free_caches_count_ = 0;
     std::vector<CacheChange_t*> all_caches_;
 
+    //! Whether the caches are allocated in slabs instead of calling create_change.
+    bool use_slabs_ = false;
+    //! Slabs of contiguous caches, with their number of elements.
+    std::vector<std::pair<CacheChange_t*, uint32_t>> slabs_;
+
     bool allocateGroup(
             uint32_t num_caches);
 
+    //! Allocates a slab of caches, adding them to all_caches_ and to the free list.
+    void allocate_slab(
+            uint32_t num_caches);
+
+    //! Grows the pool of a DYNAMIC_REUSABLE_MEMORY_MODE pool allocating caches in slabs.
+    bool grow_reusable();
+
+    //! Pushes a cache on the free list.
+    void push_free_cache(
+            CacheChange_t* ch);
+
+    //! Pops a cache from the free list.
+    CacheChange_t* pop_free_cache();
+
     CacheChange_t* allocateSingle();
 
     //! Returns a CacheChange to the free caches pool
@@ -210,6 +210,7 @@ bool ReaderHistory::remove_fragmented_changes_until(
     }
 
     std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+    std::vector<CacheChange_t*> removed_changes;
     std::vector<CacheChange_t*>::iterator chit = m_changes.begin();
     while (chit != m_changes.end())
     {
@@ -221,7 +222,8 @@ bool ReaderHistory::remove_fragmented_changes_until(
                 if (item->is_fully_assembled() == false)
                 {
                     EPROSIMA_LOG_INFO(RTPS_READER_HISTORY, "Removing change " << item->sequenceNumber);
-                    chit = remove_change_nts(chit);
+                    removed_changes.push_back(item);
+                    chit = remove_change_nts(chit, false);
                     continue;
                 }
             }
@@ -233,6 +235,11 @@ bool ReaderHistory::remove_fragmented_changes_until(
         ++chit;
     }
 
+    if (!removed_changes.empty())
+    {
+        do_release_caches(removed_changes.data(), removed_changes.size());
+    }
+
     return true;
 }
 
@@ -262,6 +269,13 @@ void ReaderHistory::do_release_cache(
     BaseReader::downcast(mp_reader)->release_cache(ch);
 }
 
+void ReaderHistory::do_release_caches(
+        CacheChange_t* const* changes,
+        size_t num_changes)
+{
+    BaseReader::downcast(mp_reader)->release_caches(changes, num_changes);
+}
+
 } /* namespace rtps */
 } /* namespace fastdds */
 } /* namespace eprosima */
@@ -26,10 +26,55 @@
 
 #include <memory>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif // if defined(__linux__)
+
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
+
+#include <utils/SystemInfo.hpp>
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+//! Environment variable enabling huge pages for the payloads of preallocated pools.
+static constexpr const char* huge_pages_env_var = "FASTDDS_PAYLOAD_POOL_HUGE_PAGES";
+
+#if defined(__linux__)
+//! Size of the huge pages slabs are rounded to.
+static constexpr size_t huge_page_size = 2u * 1024u * 1024u;
+#endif // if defined(__linux__)
+
+TopicPayloadPool::~TopicPayloadPool()
+{
+    EPROSIMA_LOG_INFO(RTPS_UTILS, "PayloadPool destructor");
+
+    for (PayloadNode* payload : all_payloads_)
+    {
+        delete payload;
+    }
+
+    for (auto& segment : slot_segments_)
+    {
+        delete[] segment.load(std::memory_order_relaxed);
+    }
+
+    for (const Slab& slab : slabs_)
+    {
+#if defined(__linux__)
+        if (slab.is_mapped)
+        {
+            munmap(slab.memory, slab.size);
+            continue;
+        }
+#endif // if defined(__linux__)
+        free(slab.memory);
+    }
+}
+
 bool TopicPayloadPool::get_payload(
         uint32_t size,
         SerializedPayload_t& payload)
@@ -44,6 +89,47 @@ bool TopicPayloadPool::do_get_payload(
 {
     PayloadNode* payload_node = nullptr;
 
+    if (lock_free_)
+    {
+        payload_node = pop_free_payload();
+        if (payload_node == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            // Some payload may have been released meanwhile
+            payload_node = pop_free_payload();
+            if (payload_node == nullptr)
+            {
+                payload_node = allocate(size);
+            }
+        }
+
+        if (payload_node == nullptr)
+        {
+            payload.data = nullptr;
+            payload.max_size = 0;
+            payload.payload_owner = nullptr;
+            return false;
+        }
+
+        if (resizeable && size > payload_node->data_size() && !payload_node->resize(size))
+        {
+            // Failed to resize, but we can still keep it for later.
+            push_free_payload(payload_node);
+            EPROSIMA_LOG_ERROR(RTPS_HISTORY, "Failed to resize the payload");
+
+            payload.data = nullptr;
+            payload.max_size = 0;
+            payload.payload_owner = nullptr;
+            return false;
+        }
+
+        payload_node->reference();
+        payload.data = payload_node->data();
+        payload.max_size = payload_node->data_size();
+        payload.payload_owner = this;
+        return true;
+    }
+
     std::unique_lock<std::mutex> lock(mutex_);
     if (free_payloads_.empty())
     {
@@ -127,9 +213,16 @@ bool TopicPayloadPool::release_payload(
 
     if (PayloadNode::dereference(payload.data))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        PayloadNode* payload_node = all_payloads_.at(PayloadNode::data_index(payload.data));
-        free_payloads_.push_back(payload_node);
+        if (lock_free_)
+        {
+            push_free_payload(slot(PayloadNode::data_index(payload.data)).node);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            PayloadNode* payload_node = all_payloads_.at(PayloadNode::data_index(payload.data));
+            free_payloads_.push_back(payload_node);
+        }
     }
 
     payload.length = 0;
@@ -182,7 +275,16 @@ TopicPayloadPool::PayloadNode* TopicPayloadPool::do_allocate(
 
     if (payload != nullptr)
     {
-        payload->data_index(static_cast<uint32_t>(all_payloads_.size()));
+        if (lock_free_)
+        {
+            uint32_t index = acquire_slot();
+            slot(index).node = payload;
+            payload->data_index(index);
+        }
+        else
+        {
+            payload->data_index(static_cast<uint32_t>(all_payloads_.size()));
+        }
         all_payloads_.push_back(payload);
     }
     else
@@ -237,6 +339,34 @@ void TopicPayloadPool::reserve (
 {
     assert (min_num_payloads <= max_pool_size_);
 
+    if (lock_free_)
+    {
+        uint32_t num_payloads = min_num_payloads > all_payloads_.size() ?
+                min_num_payloads - static_cast<uint32_t>(all_payloads_.size()) : 0u;
+        octet* slab = (use_huge_pages_ && 0 < num_payloads) ? allocate_slab(num_payloads, size) : nullptr;
+        size_t stride = slab_stride(size);
+
+        for (uint32_t i = 0; i < num_payloads; ++i)
+        {
+            PayloadNode* payload = (nullptr == slab) ? do_allocate(size) :
+                    new (std::nothrow) PayloadNode(size, slab + i * stride);
+
+            if (payload != nullptr)
+            {
+                if (nullptr != slab)
+                {
+                    uint32_t index = acquire_slot();
+                    slot(index).node = payload;
+                    payload->data_index(index);
+                    all_payloads_.push_back(payload);
+                }
+                push_free_payload(payload);
+            }
+        }
+
+        return;
+    }
+
     for (size_t i = all_payloads_.size(); i < min_num_payloads; ++i)
     {
         PayloadNode* payload = do_allocate(size);
@@ -253,6 +383,34 @@ bool TopicPayloadPool::shrink (
 {
     assert(payload_pool_allocated_size() - payload_pool_available_size() <= max_num_payloads);
 
+    if (lock_free_)
+    {
+        while (max_num_payloads < all_payloads_.size())
+        {
+            PayloadNode* payload = pop_free_payload();
+            if (payload == nullptr)
+            {
+                // Payloads taken since the precondition was checked
+                return false;
+            }
+
+            uint32_t index = payload->data_index();
+            slot(index).node = nullptr;
+            unused_slots_.push_back(index);
+
+            // Payload positions on all_payloads_ are not their data index on these pools
+            auto it = std::find(all_payloads_.begin(), all_payloads_.end(), payload);
+            assert(it != all_payloads_.end());
+            *it = all_payloads_.back();
+            all_payloads_.pop_back();
+
+            // Memory of payloads on a slab is released with the pool
+            delete payload;
+        }
+
+        return true;
+    }
+
     while (max_num_payloads < all_payloads_.size())
     {
         PayloadNode* payload = free_payloads_.back();
@@ -268,6 +426,139 @@ bool TopicPayloadPool::shrink (
     return true;
 }
 
+void TopicPayloadPool::push_free_payload(
+        PayloadNode* payload)
+{
+    uint32_t index = payload->data_index();
+    NodeSlot& entry = slot(index);
+    uint64_t head = free_head_.load(std::memory_order_relaxed);
+    uint64_t new_head = 0;
+
+    do
+    {
+        entry.next_free.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        new_head = (((head >> 32) + 1) << 32) | (static_cast<uint64_t>(index) + 1);
+    } while (!free_head_.compare_exchange_weak(head, new_head, std::memory_order_release,
+            std::memory_order_relaxed));
+
+    free_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+TopicPayloadPool::PayloadNode* TopicPayloadPool::pop_free_payload()
+{
+    uint64_t head = free_head_.load(std::memory_order_acquire);
+
+    while (0 != static_cast<uint32_t>(head))
+    {
+        uint32_t index = static_cast<uint32_t>(head) - 1;
+        // The entry may be reused meanwhile, in which case the tag makes the exchange fail.
+        uint32_t next = slot(index).next_free.load(std::memory_order_relaxed);
+        uint64_t new_head = (((head >> 32) + 1) << 32) | next;
+
+        if (free_head_.compare_exchange_weak(head, new_head, std::memory_order_acquire,
+                std::memory_order_acquire))
+        {
+            free_count_.fetch_sub(1, std::memory_order_relaxed);
+            return slot(index).node;
+        }
+    }
+
+    return nullptr;
+}
+
+TopicPayloadPool::NodeSlot& TopicPayloadPool::slot(
+        uint32_t index) const
+{
+    // Segment s holds entries [first_slot_segment_size * (2^s - 1), first_slot_segment_size * (2^(s+1) - 1))
+    uint32_t value = index / first_slot_segment_size + 1;
+#if _MSC_VER
+    unsigned long segment;
+    _BitScanReverse(&segment, value);
+#else
+    uint32_t segment = 31u - static_cast<uint32_t>(__builtin_clz(value));
+#endif // if _MSC_VER
+    uint32_t first_index = first_slot_segment_size * ((1u << segment) - 1u);
+    return slot_segments_[segment].load(std::memory_order_acquire)[index - first_index];
+}
+
+uint32_t TopicPayloadPool::acquire_slot()
+{
+    if (!unused_slots_.empty())
+    {
+        uint32_t index = unused_slots_.back();
+        unused_slots_.pop_back();
+        return index;
+    }
+
+    uint32_t index = num_slots_++;
+    uint32_t value = index / first_slot_segment_size + 1;
+    if (0 == (value & (value - 1)) && 0 == index % first_slot_segment_size)
+    {
+        // First entry of a new segment
+#if _MSC_VER
+        unsigned long segment;
+        _BitScanReverse(&segment, value);
+#else
+        uint32_t segment = 31u - static_cast<uint32_t>(__builtin_clz(value));
+#endif // if _MSC_VER
+        assert(segment < max_slot_segments);
+        slot_segments_[segment].store(new NodeSlot[first_slot_segment_size << segment],
+                std::memory_order_release);
+    }
+
+    return index;
+}
+
+size_t TopicPayloadPool::slab_stride(
+        uint32_t size)
+{
+    // Each payload starts on its own cache line
+    return (PayloadNode::buffer_size(size) + 63u) & ~static_cast<size_t>(63u);
+}
+
+octet* TopicPayloadPool::allocate_slab(
+        uint32_t num_payloads,
+        uint32_t size)
+{
+    size_t bytes = slab_stride(size) * num_payloads;
+    void* memory = nullptr;
+    bool is_mapped = false;
+
+#if defined(__linux__)
+    bytes = ((bytes + huge_page_size - 1) / huge_page_size) * huge_page_size;
+    memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (MAP_FAILED == memory)
+    {
+        // No huge pages reserved on the system, fall back to transparent huge pages
+        memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED == memory)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_HISTORY, "Failure to map a slab of " << bytes << " bytes");
+            return nullptr;
+        }
+        madvise(memory, bytes, MADV_HUGEPAGE);
+    }
+    is_mapped = true;
+#else
+    memory = calloc(bytes, sizeof(octet));
+    if (nullptr == memory)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_HISTORY, "Failure to allocate a slab of " << bytes << " bytes");
+        return nullptr;
+    }
+#endif // if defined(__linux__)
+
+    slabs_.push_back({memory, bytes, is_mapped});
+    return static_cast<octet*>(memory);
+}
+
+static bool use_huge_pages()
+{
+    std::string value;
+    return fastdds::dds::RETCODE_OK == SystemInfo::get_env(huge_pages_env_var, value) &&
+           (value == "1" || value == "TRUE" || value == "true");
+}
+
 std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
         const BasicPoolConfig& config)
 {
@@ -281,10 +572,10 @@ std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
     switch (config.memory_policy)
     {
         case PREALLOCATED_MEMORY_MODE:
-            ret_val = new PreallocatedTopicPayloadPool(config.payload_initial_size);
+            ret_val = new PreallocatedTopicPayloadPool(config.payload_initial_size, use_huge_pages());
             break;
         case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
-            ret_val = new PreallocatedReallocTopicPayloadPool(config.payload_initial_size);
+            ret_val = new PreallocatedReallocTopicPayloadPool(config.payload_initial_size, use_huge_pages());
             break;
         case DYNAMIC_RESERVE_MEMORY_MODE:
             ret_val = new DynamicTopicPayloadPool();
@@ -26,8 +26,10 @@
 #include <rtps/history/PoolConfig.h>
 #include <rtps/history/ITopicPayloadPool.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -44,15 +46,7 @@ public:
 
     TopicPayloadPool() = default;
 
-    virtual ~TopicPayloadPool()
-    {
-        EPROSIMA_LOG_INFO(RTPS_UTILS, "PayloadPool destructor");
-
-        for (PayloadNode* payload : all_payloads_)
-        {
-            delete payload;
-        }
-    }
+    virtual ~TopicPayloadPool();
 
     bool get_payload(
             uint32_t size,
@@ -124,7 +118,7 @@ public:
 
     size_t payload_pool_available_size() const override
     {
-        return free_payloads_.size();
+        return lock_free_ ? free_count_.load(std::memory_order_relaxed) : free_payloads_.size();
     }
 
     static std::unique_ptr<ITopicPayloadPool> get(
@@ -132,6 +126,19 @@ public:
 
 protected:
 
+    /**
+     * Constructor for pools keeping the free payloads on a lock-free list.
+     *
+     * @param use_huge_pages Whether the payloads preallocated by @c reserve should be placed on slabs backed by
+     *                       huge pages.
+     */
+    explicit TopicPayloadPool(
+            bool use_huge_pages)
+        : lock_free_(true)
+        , use_huge_pages_(use_huge_pages)
+    {
+    }
+
     class PayloadNode
     {
     public:
@@ -160,10 +167,34 @@ protected:
             data_size(size);
         }
 
+        /**
+         * Constructs a node on a buffer it does not own, which should have at least @c buffer_size(size)
+         * zero-initialized bytes.
+         */
+        PayloadNode(
+                uint32_t size,
+                octet* slab_buffer)
+            : buffer(slab_buffer)
+            , owns_buffer_(false)
+        {
+            new (buffer) NodeInfo();
+            data_size(size);
+        }
+
         ~PayloadNode()
         {
             info().~NodeInfo();
-            free(buffer);
+            if (owns_buffer_)
+            {
+                free(buffer);
+            }
+        }
+
+        //! @return Number of bytes needed for a node with @c size bytes of data.
+        static size_t buffer_size(
+                uint32_t size)
+        {
+            return (std::max)(static_cast<size_t>(size) + data_offset, sizeof(NodeInfo));
         }
 
         bool resize (
@@ -171,6 +202,21 @@ protected:
         {
             assert(size > data_size());
 
+            if (!owns_buffer_)
+            {
+                // The slab cannot be reallocated, so the node is moved out of it.
+                octet* new_buffer = (octet*)calloc(size + data_offset, sizeof(octet));
+                if (!new_buffer)
+                {
+                    return false;
+                }
+                memcpy(new_buffer, buffer, data_offset + data_size());
+                buffer = new_buffer;
+                owns_buffer_ = true;
+                data_size(size);
+                return true;
+            }
+
             octet* old_buffer = buffer;
             buffer = (octet*)realloc(buffer, size + data_offset);
             if (!buffer)
@@ -256,6 +302,9 @@ protected:
 
         octet* buffer = nullptr;
 
+        //! Whether buffer was allocated by this node, or lives on a slab owned by the pool.
+        bool owns_buffer_ = true;
+
         // Payload data comes after the metadata
         static constexpr size_t data_offset = offsetof(NodeInfo, data);
 
@@ -351,6 +400,21 @@ protected:
 
     virtual MemoryManagementPolicy_t memory_policy() const = 0;
 
+    /**
+     * Pushes a payload on the lock-free list of free payloads.
+     * Can be called without holding @c mutex_.
+     */
+    void push_free_payload(
+            PayloadNode* payload);
+
+    /**
+     * Pops a payload from the lock-free list of free payloads.
+     * Can be called without holding @c mutex_.
+     *
+     * @return The payload, or nullptr when the list is empty.
+     */
+    PayloadNode* pop_free_payload();
+
     uint32_t max_pool_size_             = 0;  //< Maximum size of the pool
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
@@ -360,6 +424,72 @@ protected:
 
     std::mutex mutex_;
 
+private:
+
+    /**
+     * Entry of the table of payloads of a pool with a lock-free list of free payloads.
+     * The data index of a payload is the position of its entry on the table.
+     */
+    struct NodeSlot
+    {
+        //! Payload using this entry. Only read by the thread that popped the entry from the free list.
+        PayloadNode* node = nullptr;
+        //! Data index plus one of the next free payload, or 0 for the last one.
+        std::atomic<uint32_t> next_free{0};
+    };
+
+    //! Entries on the first segment of the table. Every segment doubles the size of the previous one.
+    static constexpr uint32_t first_slot_segment_size = 64;
+
+    //! Enough segments to hold 2^32 entries.
+    static constexpr uint32_t max_slot_segments = 26;
+
+    NodeSlot& slot(
+            uint32_t index) const;
+
+    //! Gets an entry on the table for a new payload, allocating a new segment if needed. Called with mutex_ locked.
+    uint32_t acquire_slot();
+
+    //! @return Distance between consecutive payloads of @c size bytes on a slab.
+    static size_t slab_stride(
+            uint32_t size);
+
+    //! Allocates a slab of memory for @c num_payloads payloads of @c size bytes. Called with mutex_ locked.
+    octet* allocate_slab(
+            uint32_t num_payloads,
+            uint32_t size);
+
+    struct Slab
+    {
+        void* memory;
+        size_t size;
+        bool is_mapped;
+    };
+
+    //! Whether free payloads are kept on the lock-free list instead of free_payloads_.
+    const bool lock_free_ = false;
+
+    //! Whether the payloads preallocated by reserve are placed on slabs backed by huge pages.
+    const bool use_huge_pages_ = false;
+
+    //! Segments of the table of payloads. They are never released until the pool is destroyed.
+    std::atomic<NodeSlot*> slot_segments_[max_slot_segments] = {};
+
+    //! Number of entries ever used on the table. Protected by mutex_.
+    uint32_t num_slots_ = 0;
+
+    //! Entries of the table released by shrink. Protected by mutex_.
+    std::vector<uint32_t> unused_slots_;
+
+    //! Head of the lock-free list of free payloads: ABA tag on the high word, data index plus one on the low word.
+    std::atomic<uint64_t> free_head_{0};
+
+    //! Number of payloads on the lock-free list.
+    std::atomic<size_t> free_count_{0};
+
+    //! Slabs backing preallocated payloads. Protected by mutex_.
+    std::vector<Slab> slabs_;
+
 };
 
 
@@ -21,17 +21,149 @@
 
 #include <rtps/history/TopicPayloadPool.hpp>
 
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+/**
+ * Payload pool segregating payloads in power of two size classes.
+ *
+ * A request is served with a payload of the smallest class fitting it, so payloads are never reallocated and small
+ * samples never hold large buffers. Each class keeps at most as many free payloads as needed to reach the highest
+ * number of payloads of that class in use during the last trim period, so memory follows the working set of the
+ * topic. A trim period ends every @c trim_period payloads taken from the pool.
+ */
 class DynamicReusableTopicPayloadPool : public TopicPayloadPool
 {
+public:
+
     bool get_payload(
             uint32_t size,
             SerializedPayload_t& payload) override
     {
-        return do_get_payload(size, payload, true);
+        uint32_t size_class = size_class_of(size);
+        PayloadNode* payload_node = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            SizeClass& cls = classes_[size_class];
+
+            if (!cls.free_payloads.empty())
+            {
+                payload_node = cls.free_payloads.back();
+                cls.free_payloads.pop_back();
+                --num_free_payloads_;
+            }
+            else
+            {
+                uint32_t node_size = class_size(size_class, size);
+                if (all_payloads_.size() >= max_pool_size_)
+                {
+                    // Make room releasing a free payload of another class
+                    release_one_free_payload();
+                }
+                payload_node = allocate(node_size);
+            }
+
+            if (payload_node != nullptr)
+            {
+                ++cls.in_use;
+                cls.period_peak = (std::max)(cls.period_peak, cls.in_use);
+            }
+
+            if (++period_uses_ >= trim_period)
+            {
+                period_uses_ = 0;
+                for (SizeClass& size_class_info : classes_)
+                {
+                    end_trim_period(size_class_info);
+                }
+            }
+        }
+
+        if (payload_node == nullptr)
+        {
+            payload.data = nullptr;
+            payload.max_size = 0;
+            payload.payload_owner = nullptr;
+            return false;
+        }
+
+        payload_node->reference();
+        payload.data = payload_node->data();
+        payload.max_size = payload_node->data_size();
+        payload.payload_owner = this;
+        return true;
+    }
+
+    bool release_payload(
+            SerializedPayload_t& payload) override
+    {
+        assert(payload.payload_owner == this);
+
+        if (PayloadNode::dereference(payload.data))
+        {
+            PayloadNode* payload_node = nullptr;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                payload_node = all_payloads_.at(PayloadNode::data_index(payload.data));
+                uint32_t size_class = size_class_of(payload_node->data_size());
+                SizeClass& cls = classes_[size_class];
+                assert(0 < cls.in_use);
+                --cls.in_use;
+
+                if (huge_class == size_class || cls.in_use + cls.free_payloads.size() >= cls.limit)
+                {
+                    remove_payload(payload_node);
+                }
+                else
+                {
+                    cls.free_payloads.push_back(payload_node);
+                    ++num_free_payloads_;
+                    payload_node = nullptr;
+                }
+            }
+
+            // Now delete the data, if the class had enough free payloads
+            delete payload_node;
+        }
+
+        payload.length = 0;
+        payload.pos = 0;
+        payload.max_size = 0;
+        payload.data = nullptr;
+        payload.payload_owner = nullptr;
+        return true;
+    }
+
+    bool release_history(
+            const PoolConfig& config,
+            bool /*is_reader*/) override
+    {
+        assert(config.memory_policy == memory_policy());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        update_maximum_size(config, false);
+
+        while (max_pool_size_ < all_payloads_.size() && release_one_free_payload())
+        {
+        }
+
+        return true;
+    }
+
+    size_t payload_pool_available_size() const override
+    {
+        return num_free_payloads_;
     }
 
 protected:
@@ -45,6 +177,113 @@ private:
 
     using TopicPayloadPool::get_payload;
 
+    //! Payloads of the smallest class have 2^min_class_bits bytes.
+    static constexpr uint32_t min_class_bits = 6;
+
+    //! Class for payloads larger than 2^31 bytes, which are never kept free.
+    static constexpr uint32_t huge_class = 32;
+
+    //! Number of payloads taken from the pool after which the limits of the classes are recomputed.
+    static constexpr uint32_t trim_period = 1024;
+
+    struct SizeClass
+    {
+        //! Free payloads of this class
+        std::vector<PayloadNode*> free_payloads;
+        //! Number of payloads of this class in use
+        uint32_t in_use = 0;
+        //! Highest number of payloads of this class in use during the current trim period
+        uint32_t period_peak = 0;
+        //! Maximum number of payloads of this class, in use or free, allowed when one is released
+        uint32_t limit = (std::numeric_limits<uint32_t>::max)();
+    };
+
+    static uint32_t size_class_of(
+            uint32_t size)
+    {
+        if (size <= (1u << min_class_bits))
+        {
+            return min_class_bits;
+        }
+        if (size > (1u << 31))
+        {
+            return huge_class;
+        }
+
+        // Number of bits needed to represent size - 1
+        uint32_t value = size - 1;
+#if _MSC_VER
+        unsigned long bit;
+        _BitScanReverse(&bit, value);
+        return static_cast<uint32_t>(bit) + 1;
+#else
+        return 32u - static_cast<uint32_t>(__builtin_clz(value));
+#endif // if _MSC_VER
+    }
+
+    static uint32_t class_size(
+            uint32_t size_class,
+            uint32_t size)
+    {
+        return huge_class == size_class ? size : (1u << size_class);
+    }
+
+    /**
+     * Sets the limit of a class to the highest usage observed during the period just finished, and releases the
+     * free payloads exceeding it.
+     */
+    void end_trim_period(
+            SizeClass& cls)
+    {
+        cls.limit = cls.period_peak;
+        cls.period_peak = cls.in_use;
+
+        while (!cls.free_payloads.empty() && cls.in_use + cls.free_payloads.size() > cls.limit)
+        {
+            PayloadNode* payload_node = cls.free_payloads.back();
+            cls.free_payloads.pop_back();
+            --num_free_payloads_;
+            remove_payload(payload_node);
+            delete payload_node;
+        }
+    }
+
+    //! Releases a free payload of the largest class having any. @return false if there are no free payloads.
+    bool release_one_free_payload()
+    {
+        for (auto cls = classes_.rbegin(); cls != classes_.rend(); ++cls)
+        {
+            if (!cls->free_payloads.empty())
+            {
+                PayloadNode* payload_node = cls->free_payloads.back();
+                cls->free_payloads.pop_back();
+                --num_free_payloads_;
+                remove_payload(payload_node);
+                delete payload_node;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //! Removes a payload from all_payloads_, without deleting it.
+    void remove_payload(
+            PayloadNode* payload_node)
+    {
+        uint32_t data_index = payload_node->data_index();
+        all_payloads_.at(data_index) = all_payloads_.back();
+        all_payloads_.back()->data_index(data_index);
+        all_payloads_.pop_back();
+    }
+
+    std::array<SizeClass, huge_class + 1> classes_;
+
+    size_t num_free_payloads_ = 0;
+
+    //! Number of payloads taken from the pool during the current trim period.
+    uint32_t period_uses_ = 0;
+
 };
 
 }  // namespace rtps
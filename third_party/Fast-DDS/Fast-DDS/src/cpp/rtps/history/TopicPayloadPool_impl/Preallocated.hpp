@@ -30,8 +30,10 @@ class PreallocatedTopicPayloadPool : public TopicPayloadPool
 public:
 
     explicit PreallocatedTopicPayloadPool(
-            uint32_t payload_size)
-        : payload_size_(payload_size)
+            uint32_t payload_size,
+            bool use_huge_pages = false)
+        : TopicPayloadPool(use_huge_pages)
+        , payload_size_(payload_size)
         , minimum_pool_size_(0)
     {
         assert(payload_size_ > 0);
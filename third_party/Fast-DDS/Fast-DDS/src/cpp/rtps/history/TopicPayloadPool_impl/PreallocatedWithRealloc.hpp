@@ -30,8 +30,10 @@ class PreallocatedReallocTopicPayloadPool : public TopicPayloadPool
 public:
 
     explicit PreallocatedReallocTopicPayloadPool(
-            uint32_t payload_size)
-        : min_payload_size_(payload_size)
+            uint32_t payload_size,
+            bool use_huge_pages = false)
+        : TopicPayloadPool(use_huge_pages)
+        , min_payload_size_(payload_size)
         , minimum_pool_size_(0)
     {
         assert(min_payload_size_ > 0);
@@ -428,6 +428,22 @@ void RTPSMessageGroup::sender(
     sender_ = msg_sender;
 }
 
+void RTPSMessageGroup::endpoint(
+        Endpoint* endpoint)
+{
+    assert(nullptr != endpoint && nullptr != sender_);
+
+#if HAVE_SECURITY
+    // RTPS protection is applied to the whole datagram, so it cannot mix endpoints with different support.
+    if (nullptr != endpoint_ && endpoint_->supports_rtps_protection() != endpoint->supports_rtps_protection())
+    {
+        flush_and_reset();
+    }
+#endif // if HAVE_SECURITY
+
+    endpoint_ = endpoint;
+}
+
 void RTPSMessageGroup::check_and_maybe_flush(
         const GuidPrefix_t& destination_guid_prefix)
 {
@@ -800,13 +816,49 @@ bool RTPSMessageGroup::add_heartbeat(
 
     check_and_maybe_flush();
 
+    const EntityId_t& readerId = get_entity_id(sender_->remote_guids());
+
+    if (!create_heartbeat_submessage(firstSN, lastSN, count, isFinal, livelinessFlag, readerId))
+    {
+        return false;
+    }
+
+    return insert_submessage(false);
+}
+
+bool RTPSMessageGroup::add_heartbeat(
+        const SequenceNumber_t& firstSN,
+        const SequenceNumber_t& lastSN,
+        const Count_t count,
+        bool isFinal,
+        bool livelinessFlag,
+        const GUID_t& reader_guid)
+{
+    assert(nullptr != sender_);
+
+    check_and_maybe_flush(reader_guid.guidPrefix);
+
+    if (!create_heartbeat_submessage(firstSN, lastSN, count, isFinal, livelinessFlag, reader_guid.entityId))
+    {
+        return false;
+    }
+
+    return insert_submessage(reader_guid.guidPrefix, false);
+}
+
+bool RTPSMessageGroup::create_heartbeat_submessage(
+        const SequenceNumber_t& firstSN,
+        const SequenceNumber_t& lastSN,
+        const Count_t count,
+        bool isFinal,
+        bool livelinessFlag,
+        const EntityId_t& reader_id)
+{
 #if HAVE_SECURITY
     uint32_t from_buffer_position = submessage_msg_->pos;
 #endif // if HAVE_SECURITY
 
-    const EntityId_t& readerId = get_entity_id(sender_->remote_guids());
-
-    if (!RTPSMessageCreator::addSubmessageHeartbeat(submessage_msg_, readerId, endpoint_->getGuid().entityId,
+    if (!RTPSMessageCreator::addSubmessageHeartbeat(submessage_msg_, reader_id, endpoint_->getGuid().entityId,
             firstSN, lastSN, count, isFinal, livelinessFlag))
     {
         EPROSIMA_LOG_ERROR(RTPS_WRITER, "Cannot add HEARTBEAT submsg to the CDRMessage. Buffer too small");
@@ -839,7 +891,7 @@ bool RTPSMessageGroup::add_heartbeat(
     }
 #endif // if HAVE_SECURITY
 
-    return insert_submessage(false);
+    return true;
 }
 
 // TODO (Ricardo) Check with standard 8.3.7.4.5
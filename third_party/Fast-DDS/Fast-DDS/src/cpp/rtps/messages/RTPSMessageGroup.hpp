@@ -150,6 +150,25 @@ public:
             bool is_final,
             bool liveliness_flag);
 
+    /**
+     * Adds a HEARTBEAT message to the group, addressed to a specific reader.
+     * @param first_seq First available sequence number.
+     * @param last_seq Last available sequence number.
+     * @param count Counting identifier.
+     * @param is_final Should final flag be set?
+     * @param liveliness_flag Should liveliness flag be set?
+     * @param reader_guid GUID of the destination reader. An unknown entity id addresses all the readers of the
+     * destination participant.
+     * @return True when message was added to the group.
+     */
+    bool add_heartbeat(
+            const SequenceNumber_t& first_seq,
+            const SequenceNumber_t& last_seq,
+            Count_t count,
+            bool is_final,
+            bool liveliness_flag,
+            const GUID_t& reader_guid);
+
     /**
      * Adds one or more GAP messages to the group.
      * @param changes_seq_numbers Set of missed sequence numbers.
@@ -225,6 +244,16 @@ public:
             Endpoint* endpoint,
             RTPSMessageSenderInterface* msg_sender);
 
+    /*!
+     * Change dynamically the endpoint of next RTPS submessages, keeping the current sender and the pending submessages.
+     * This allows submessages of several endpoints addressed to the same destinations to share a datagram.
+     *
+     * @param endpoint Pointer to next Endpoint sender.
+     * @pre A sender was previously set.
+     */
+    void endpoint(
+            Endpoint* endpoint);
+
     //! Maximum fragment size minus the headers
     static inline constexpr uint32_t get_max_fragment_payload_size()
     {
@@ -313,6 +342,14 @@ private:
     bool add_info_ts_in_buffer(
             const Time_t& timestamp);
 
+    bool create_heartbeat_submessage(
+            const SequenceNumber_t& first_seq,
+            const SequenceNumber_t& last_seq,
+            Count_t count,
+            bool is_final,
+            bool liveliness_flag,
+            const EntityId_t& reader_id);
+
     bool create_gap_submessage(
             const SequenceNumber_t& gap_initial_sequence,
             const SequenceNumberSet_t& gap_bitmap,
@@ -65,6 +65,8 @@
 #include <rtps/reader/StatefulReader.hpp>
 #include <rtps/reader/StatelessPersistentReader.hpp>
 #include <rtps/reader/StatelessReader.hpp>
+#include <rtps/writer/DeliveryThreadPool.hpp>
+#include <rtps/writer/HeartbeatAggregator.hpp>
 #include <rtps/writer/StatefulPersistentWriter.hpp>
 #include <rtps/writer/StatefulWriter.hpp>
 #include <rtps/writer/StatelessPersistentWriter.hpp>
@@ -193,6 +195,46 @@ static void set_builtin_transports_from_env_var(
     attr.setup_transports(ret_val);
 }
 
+/**
+ * Fill the settings of the parallel delivery threads from the properties of the participant.
+ * Settings not present on the properties are left with their default value.
+ */
+static ThreadSettings get_delivery_thread_settings(
+        const RTPSParticipantAttributes& attr)
+{
+    ThreadSettings settings;
+    const std::string prefix = "fastdds.parallel_delivery_threads.";
+    const std::string* value = nullptr;
+    try
+    {
+        value = PropertyPolicyHelper::find_property(attr.properties, prefix + "scheduling_policy");
+        if (nullptr != value)
+        {
+            settings.scheduling_policy = static_cast<int32_t>(std::stol(*value));
+        }
+        value = PropertyPolicyHelper::find_property(attr.properties, prefix + "priority");
+        if (nullptr != value)
+        {
+            settings.priority = static_cast<int32_t>(std::stol(*value));
+        }
+        value = PropertyPolicyHelper::find_property(attr.properties, prefix + "affinity");
+        if (nullptr != value)
+        {
+            settings.affinity = static_cast<uint64_t>(std::stoull(*value, nullptr, 0));
+        }
+        value = PropertyPolicyHelper::find_property(attr.properties, prefix + "stack_size");
+        if (nullptr != value)
+        {
+            settings.stack_size = static_cast<int32_t>(std::stol(*value));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT, "Error parsing parallel_delivery_threads settings: " << e.what());
+    }
+    return settings;
+}
+
 static EntityId_t TrustedWriter(
         const EntityId_t& reader)
 {
@@ -552,6 +594,27 @@ void RTPSParticipantImpl::setup_timed_events()
     uint32_t id_for_thread = static_cast<uint32_t>(m_att.participantID);
     const ThreadSettings& thr_config = m_att.timed_events_thread;
     mp_event_thr.init_thread(thr_config, "dds.ev.%u", id_for_thread);
+
+    const std::string* hb_aggregation_property =
+            PropertyPolicyHelper::find_property(m_att.properties, "fastdds.heartbeat_aggregation_period");
+    if (hb_aggregation_property != nullptr)
+    {
+        try
+        {
+            // Period of the shared heartbeat tick, in milliseconds. Zero keeps one timer per writer.
+            unsigned long period_ms = std::stoul(*hb_aggregation_property);
+            if (0 < period_ms)
+            {
+                dds::Duration_t tick_period(static_cast<int32_t>(period_ms / 1000),
+                        static_cast<uint32_t>((period_ms % 1000) * 1000000));
+                heartbeat_aggregator_.reset(new HeartbeatAggregator(this, tick_period));
+            }
+        }
+        catch (const std::exception& e)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT, "Error parsing heartbeat_aggregation_period property: " << e.what());
+        }
+    }
 }
 
 void RTPSParticipantImpl::setup_meta_traffic()
@@ -706,6 +769,28 @@ void RTPSParticipantImpl::setup_output_traffic()
         }
     }
 
+    {
+        const std::string* delivery_threads_property =
+                PropertyPolicyHelper::find_property(m_att.properties, "fastdds.parallel_delivery_threads");
+        if (delivery_threads_property != nullptr)
+        {
+            try
+            {
+                // Number of worker threads, apart from the writing thread. Zero keeps delivering serially.
+                unsigned long num_threads = std::stoul(*delivery_threads_property);
+                if (0 < num_threads)
+                {
+                    delivery_thread_pool_.reset(new DeliveryThreadPool(static_cast<uint32_t>(num_threads),
+                            get_delivery_thread_settings(m_att), static_cast<uint32_t>(m_att.participantID)));
+                }
+            }
+            catch (const std::exception& e)
+            {
+                EPROSIMA_LOG_ERROR(RTPS_WRITER, "Error parsing parallel_delivery_threads property: " << e.what());
+            }
+        }
+    }
+
     bool allow_growing_buffers = m_att.allocation.send_buffers.dynamic;
     size_t num_send_buffers = m_att.allocation.send_buffers.preallocated_number;
     if (num_send_buffers == 0)
@@ -2505,7 +2590,7 @@ WLP* RTPSParticipantImpl::wlp()
 
 fastdds::dds::builtin::TypeLookupManager* RTPSParticipantImpl::typelookup_manager() const
 {
-    return mp_builtinProtocols->typelookup_manager_;
+    return mp_builtinProtocols->typelookup_manager();
 }
 
 IPersistenceService* RTPSParticipantImpl::get_persistence_service(
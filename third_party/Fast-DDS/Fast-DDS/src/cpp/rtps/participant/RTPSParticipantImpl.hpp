@@ -130,6 +130,8 @@ class ReaderAttributes;
 class ReaderHistory;
 class ReaderListener;
 class StatefulReader;
+class DeliveryThreadPool;
+class HeartbeatAggregator;
 class PDP;
 class PDPSimple;
 class IPersistenceService;
@@ -287,6 +289,24 @@ public:
         return mp_event_thr;
     }
 
+    /**
+     * Get the participant-level scheduler of the periodic heartbeats of user writers.
+     * @return Pointer to the aggregator, or nullptr when heartbeat aggregation is not enabled.
+     */
+    HeartbeatAggregator* heartbeat_aggregator() const
+    {
+        return heartbeat_aggregator_.get();
+    }
+
+    /**
+     * Get the pool of threads used by user writers to deliver samples to several local readers in parallel.
+     * @return Pointer to the pool, or nullptr when parallel delivery is not enabled.
+     */
+    DeliveryThreadPool* delivery_thread_pool() const
+    {
+        return delivery_thread_pool_.get();
+    }
+
     /**
      * Send a message to several locations
      * @param buffers Vector of buffers to send.
@@ -585,6 +605,10 @@ private:
     std::unique_ptr<SendBuffersManager> send_buffers_;
     //! Maximum number of bytes allowed for an RTPS datagram generated by this writer.
     uint32_t max_output_message_size_ = std::numeric_limits<uint32_t>::max();
+    //! Shared scheduler of the periodic heartbeats of user writers. Only created when enabled by property.
+    std::unique_ptr<HeartbeatAggregator> heartbeat_aggregator_;
+    //! Threads shared by user writers to deliver samples to local readers in parallel. Only created by property.
+    std::unique_ptr<DeliveryThreadPool> delivery_thread_pool_;
 
     /**
      * Client override flag: SIMPLE participant that has been overriden with the environment variable and transformed
@@ -19,10 +19,13 @@
 #include <rtps/reader/BaseReader.hpp>
 
 #include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <mutex>
+#include <string>
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.hpp>
 #include <fastdds/rtps/Endpoint.hpp>
 #include <fastdds/rtps/builtin/data/PublicationBuiltinTopicData.hpp>
 #include <fastdds/rtps/common/CacheChange.hpp>
@@ -115,9 +118,9 @@ BaseReader::~BaseReader()
 {
     EPROSIMA_LOG_INFO(RTPS_READER, "Removing reader " << this->getGuid().entityId);
 
-    for (auto it = history_->changesBegin(); it != history_->changesEnd(); ++it)
+    if (history_->changesBegin() != history_->changesEnd())
     {
-        release_cache(*it);
+        release_caches(&(*history_->changesBegin()), history_->getHistorySize());
     }
 
     delete history_state_;
@@ -151,6 +154,15 @@ void BaseReader::set_listener(
     listener_ = target;
 }
 
+bool BaseReader::may_call_user_listener() const
+{
+    if (user_listener_check_)
+    {
+        return user_listener_check_();
+    }
+    return nullptr != get_listener();
+}
+
 bool BaseReader::expects_inline_qos() const
 {
     return expects_inline_qos_;
@@ -317,6 +329,23 @@ void BaseReader::release_cache(
     change_pool_->release_cache(change);
 }
 
+void BaseReader::release_caches(
+        fastdds::rtps::CacheChange_t* const* changes,
+        size_t num_changes)
+{
+    std::lock_guard<decltype(mp_mutex)> guard(mp_mutex);
+
+    for (size_t i = 0; i < num_changes; ++i)
+    {
+        fastdds::rtps::IPayloadPool* pool = changes[i]->serializedPayload.payload_owner;
+        if (pool)
+        {
+            pool->release_payload(changes[i]->serializedPayload);
+        }
+    }
+    change_pool_->release_caches(changes, num_changes);
+}
+
 void BaseReader::update_liveliness_changed_status(
         const fastdds::rtps::GUID_t& writer,
         int32_t alive_change,
@@ -522,11 +551,29 @@ void BaseReader::setup_datasharing(
             getGuid(), att.endpoint.data_sharing_configuration().shm_directory());
         if (notification)
         {
+            // Time the listener busy waits for new data before blocking. Zero, the default, blocks right away.
+            std::chrono::nanoseconds spin_duration(0);
+            const std::string* spin_property = PropertyPolicyHelper::find_property(att.endpoint.properties,
+                            "fastdds.datasharing_listener_spin_us");
+            if (nullptr != spin_property)
+            {
+                try
+                {
+                    spin_duration = std::chrono::microseconds(std::stoul(*spin_property));
+                }
+                catch (const std::exception& e)
+                {
+                    EPROSIMA_LOG_ERROR(RTPS_READER,
+                            "Error parsing datasharing_listener_spin_us property: " << e.what());
+                }
+            }
+
             is_datasharing_compatible_ = true;
             datasharing_listener_.reset(new DataSharingListener(
                         notification,
                         att.endpoint.data_sharing_configuration().shm_directory(),
                         att.data_sharing_listener_thread,
+                        spin_duration,
                         att.matched_writers_allocation,
                         this));
 
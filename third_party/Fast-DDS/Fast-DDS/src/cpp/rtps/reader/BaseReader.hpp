@@ -20,6 +20,7 @@
 #define FASTDDS_RTPS_READER__BASEREADER_HPP
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
@@ -124,6 +125,26 @@ public:
     static BaseReader* downcast(
             fastdds::rtps::Endpoint* endpoint);
 
+    /**
+     * @brief Set a function telling whether user listeners may be called when this reader receives a sample.
+     * Used by upper layers whose ReaderListener forwards the notifications to listeners set by the user.
+     *
+     * @param check  Function returning true when a user listener may be called.
+     */
+    void set_user_listener_check(
+            std::function<bool()> check)
+    {
+        user_listener_check_ = std::move(check);
+    }
+
+    /**
+     * @brief Whether receiving a sample may call user code, which could in turn use the writer delivering it.
+     * Local writers only deliver samples to this reader from other threads when this returns false.
+     *
+     * @return true when the reception of a sample may call a user listener.
+     */
+    bool may_call_user_listener() const;
+
     /**
      * @brief Set the entity ID of the trusted writer.
      *
@@ -193,6 +214,16 @@ public:
     void release_cache(
             fastdds::rtps::CacheChange_t* change);
 
+    /**
+     * @brief Release a number of CacheChange_t, taking the reader's mutex only once.
+     *
+     * @param changes      Array with the pointers to the changes to release.
+     * @param num_changes  Number of changes to release.
+     */
+    void release_caches(
+            fastdds::rtps::CacheChange_t* const* changes,
+            size_t num_changes);
+
     /**
      * @brief Method to notify the reader that a change has been removed from its history.
      *
@@ -438,6 +469,8 @@ protected:
 
     /// Pointer to the listener associated with this reader.
     fastdds::rtps::ReaderListener* listener_;
+    /// Function telling whether the listener forwards the notifications to user listeners.
+    std::function<bool()> user_listener_check_;
     /// Whether the reader accepts messages from unmatched writers.
     bool accept_messages_from_unkown_writers_;
     /// Whether the reader expects inline QoS.
@@ -0,0 +1,460 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReceivedChangesBitmap.hpp
+ */
+
+#ifndef FASTDDS_RTPS_READER__RECEIVEDCHANGESBITMAP_HPP
+#define FASTDDS_RTPS_READER__RECEIVEDCHANGESBITMAP_HPP
+
+#include <bitset>
+#include <cstdint>
+#include <iterator>
+#include <set>
+#include <vector>
+
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
+
+#include <fastdds/rtps/common/SequenceNumber.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Sliding window of sequence numbers received out of order.
+ *
+ * Sequence numbers are kept as bits on 32-bit words aligned to absolute sequence numbers, with the most significant
+ * bit first, as on the bitmap of a SequenceNumberSet_t. Words before the window are dropped lazily, so advancing the
+ * window is O(1) amortized.
+ *
+ * The window spans a limited number of sequence numbers, so a sequence number far ahead (i.e. after a writer restart,
+ * or on a forged message) does not allocate memory proportional to the gap. Sequence numbers out of the window are
+ * kept one by one on an ordered set, and moved to the bitmap when the window reaches them.
+ *
+ * @ingroup READER_MODULE
+ */
+class ReceivedChangesBitmap
+{
+public:
+
+    //! Minimum number of sequence numbers spanned by the window. Enough for the range of two ACKNACKs.
+    static constexpr size_t min_window_changes = 512u;
+
+    //! Maximum number of sequence numbers spanned by the window, used with unlimited histories.
+    static constexpr size_t max_window_changes = 65536u;
+
+    //! @return true when no sequence number is held.
+    bool empty() const
+    {
+        return 0 == num_set_ && overflow_.empty();
+    }
+
+    /**
+     * Configure the window of sequence numbers.
+     * @param initial_changes Number of consecutive sequence numbers the window should hold without allocating.
+     * @param max_changes     Number of consecutive sequence numbers the window may span, usually the history depth.
+     */
+    void reserve(
+            size_t initial_changes,
+            size_t max_changes)
+    {
+        if (max_changes < min_window_changes)
+        {
+            max_changes = min_window_changes;
+        }
+        else if (max_changes > max_window_changes)
+        {
+            max_changes = max_window_changes;
+        }
+        if (initial_changes > max_changes)
+        {
+            initial_changes = max_changes;
+        }
+        max_words_ = max_changes / 32u + 1u;
+        words_.reserve(initial_changes / 32u + 1u);
+    }
+
+    //! Remove all sequence numbers.
+    void clear()
+    {
+        clear_words();
+        overflow_.clear();
+    }
+
+    /**
+     * Add a sequence number.
+     * @param seq_num Sequence number to add.
+     * @return false if the sequence number was already present.
+     */
+    bool add(
+            const SequenceNumber_t& seq_num)
+    {
+        uint64_t value = seq_num.to64long();
+
+        if (!overflow_.empty() && overflow_.count(value) > 0)
+        {
+            return false;
+        }
+
+        if (!fits_window(value >> 5))
+        {
+            return overflow_.insert(value).second;
+        }
+
+        return set_bit(value);
+    }
+
+    /**
+     * Check whether a sequence number is present.
+     * @param seq_num Sequence number to check.
+     * @return true if present.
+     */
+    bool contains(
+            const SequenceNumber_t& seq_num) const
+    {
+        uint64_t value = seq_num.to64long();
+        return 0 != (word_at(value >> 5) & (0x80000000u >> (value & 31u))) ||
+               (!overflow_.empty() && overflow_.count(value) > 0);
+    }
+
+    /**
+     * Get 32 consecutive bits of the window.
+     * @param from First sequence number to get, which will be placed on the most significant bit.
+     * @return Bits for sequence numbers [from, from + 32).
+     */
+    uint32_t bits_from(
+            const SequenceNumber_t& from) const
+    {
+        uint64_t value = from.to64long();
+        uint64_t word = value >> 5;
+        uint32_t offset = static_cast<uint32_t>(value & 31u);
+        uint32_t bits = word_at(word) << offset;
+        if (0 != offset)
+        {
+            bits |= word_at(word + 1) >> (32u - offset);
+        }
+
+        for (auto it = overflow_.lower_bound(value); it != overflow_.end() && *it < value + 32u; ++it)
+        {
+            bits |= 0x80000000u >> static_cast<uint32_t>(*it - value);
+        }
+        return bits;
+    }
+
+    /**
+     * Remove all the consecutive sequence numbers present after a low mark, advancing it.
+     * @param low_mark Sequence number to advance.
+     */
+    void advance(
+            SequenceNumber_t& low_mark)
+    {
+        for (;;)
+        {
+            advance_words(low_mark);
+
+            if (overflow_.empty() || *overflow_.begin() != low_mark.to64long() + 1)
+            {
+                break;
+            }
+            overflow_.erase(overflow_.begin());
+            ++low_mark;
+        }
+
+        move_overflow_to_window();
+    }
+
+    /**
+     * Remove all sequence numbers lower than a given one.
+     * @param seq_num First sequence number to keep.
+     * @return Number of sequence numbers removed.
+     */
+    uint64_t remove_below(
+            const SequenceNumber_t& seq_num)
+    {
+        uint64_t removed = count_words_below(seq_num);
+        uint64_t value = seq_num.to64long();
+        uint64_t word = value >> 5;
+
+        if (word >= first_word_ && word < first_word_ + (words_.size() - head_))
+        {
+            words_[head_ + static_cast<size_t>(word - first_word_)] &= ~range_mask(0u,
+                    static_cast<uint32_t>(value & 31u));
+        }
+
+        num_set_ -= removed;
+        drop_words_before(word);
+
+        if (!overflow_.empty())
+        {
+            auto end = overflow_.lower_bound(value);
+            removed += static_cast<uint64_t>(std::distance(overflow_.begin(), end));
+            overflow_.erase(overflow_.begin(), end);
+            move_overflow_to_window();
+        }
+        return removed;
+    }
+
+    /**
+     * Count the sequence numbers present lower than a given one.
+     * @param seq_num Upper bound, not included.
+     * @return Number of sequence numbers present lower than seq_num.
+     */
+    uint64_t count_below(
+            const SequenceNumber_t& seq_num) const
+    {
+        uint64_t count = count_words_below(seq_num);
+        if (!overflow_.empty())
+        {
+            count += static_cast<uint64_t>(std::distance(overflow_.begin(),
+                    overflow_.lower_bound(seq_num.to64long())));
+        }
+        return count;
+    }
+
+private:
+
+    static uint32_t range_mask(
+            uint32_t offset,
+            uint32_t n_bits)
+    {
+        if (0 == n_bits)
+        {
+            return 0u;
+        }
+        uint32_t mask = (n_bits >= 32u) ? 0xFFFFFFFFu : ~(0xFFFFFFFFu >> n_bits);
+        return mask >> offset;
+    }
+
+    void clear_words()
+    {
+        words_.clear();
+        head_ = 0;
+        first_word_ = 0;
+        num_set_ = 0;
+    }
+
+    //! Whether a word can be held on the bitmap without spanning more than max_words_.
+    bool fits_window(
+            uint64_t word) const
+    {
+        if (0 == num_set_)
+        {
+            return true;
+        }
+        if (word >= first_word_)
+        {
+            return word - first_word_ < max_words_;
+        }
+        return (first_word_ - word) + (words_.size() - head_) <= max_words_;
+    }
+
+    //! Set the bit of a sequence number whose word fits the window.
+    bool set_bit(
+            uint64_t value)
+    {
+        uint64_t word = value >> 5;
+
+        if (0 == num_set_)
+        {
+            clear_words();
+            first_word_ = word;
+        }
+        else if (word < first_word_)
+        {
+            // Received before the first one held. Uncommon, so just make room at the front.
+            size_t n_words = static_cast<size_t>(first_word_ - word);
+            if (n_words <= head_)
+            {
+                head_ -= n_words;
+            }
+            else
+            {
+                words_.insert(words_.begin() + head_, n_words - head_, 0u);
+                head_ = 0;
+            }
+            for (size_t i = 0; i < n_words; ++i)
+            {
+                words_[head_ + i] = 0u;
+            }
+            first_word_ = word;
+        }
+
+        size_t index = head_ + static_cast<size_t>(word - first_word_);
+        if (index >= words_.size())
+        {
+            words_.resize(index + 1, 0u);
+        }
+
+        uint32_t mask = 0x80000000u >> (value & 31u);
+        if (words_[index] & mask)
+        {
+            return false;
+        }
+
+        words_[index] |= mask;
+        ++num_set_;
+        return true;
+    }
+
+    //! Move to the bitmap the sequence numbers the window has reached.
+    void move_overflow_to_window()
+    {
+        auto it = overflow_.begin();
+        while (it != overflow_.end())
+        {
+            uint64_t word = *it >> 5;
+            if (!fits_window(word))
+            {
+                // The rest are further ahead
+                if (word >= first_word_)
+                {
+                    break;
+                }
+                ++it;
+                continue;
+            }
+
+            set_bit(*it);
+            it = overflow_.erase(it);
+        }
+    }
+
+    void advance_words(
+            SequenceNumber_t& low_mark)
+    {
+        while (0 != num_set_)
+        {
+            uint64_t value = low_mark.to64long() + 1;
+            uint64_t word = value >> 5;
+            if (word < first_word_ || word >= first_word_ + (words_.size() - head_))
+            {
+                break;
+            }
+
+            uint32_t offset = static_cast<uint32_t>(value & 31u);
+            uint32_t& bits = words_[head_ + static_cast<size_t>(word - first_word_)];
+
+            // Count the consecutive bits set starting on offset
+            uint32_t inverted = ~(bits << offset);
+            uint32_t n_bits = 32u - offset;
+            if (0 != inverted)
+            {
+#if _MSC_VER
+                unsigned long bit;
+                _BitScanReverse(&bit, inverted);
+                uint32_t leading = 31u ^ bit;
+#else
+                uint32_t leading = static_cast<uint32_t>(__builtin_clz(inverted));
+#endif // if _MSC_VER
+                n_bits = leading < n_bits ? leading : n_bits;
+            }
+
+            if (0 == n_bits)
+            {
+                break;
+            }
+
+            bits &= ~range_mask(offset, n_bits);
+            num_set_ -= n_bits;
+            low_mark += static_cast<int>(n_bits);
+
+            if (offset + n_bits < 32u)
+            {
+                break;
+            }
+        }
+
+        drop_words_before((low_mark.to64long() + 1) >> 5);
+    }
+
+    uint64_t count_words_below(
+            const SequenceNumber_t& seq_num) const
+    {
+        if (0 == num_set_)
+        {
+            return 0;
+        }
+
+        uint64_t value = seq_num.to64long();
+        uint64_t last_word = value >> 5;
+        uint64_t count = 0;
+        for (uint64_t word = first_word_; word < last_word && word < first_word_ + (words_.size() - head_); ++word)
+        {
+            count += std::bitset<32>(word_at(word)).count();
+        }
+        count += std::bitset<32>(word_at(last_word) & range_mask(0u, static_cast<uint32_t>(value & 31u))).count();
+        return count;
+    }
+
+    uint32_t word_at(
+            uint64_t word) const
+    {
+        if (word < first_word_ || word >= first_word_ + (words_.size() - head_))
+        {
+            return 0u;
+        }
+        return words_[head_ + static_cast<size_t>(word - first_word_)];
+    }
+
+    void drop_words_before(
+            uint64_t word)
+    {
+        if (0 == num_set_)
+        {
+            clear_words();
+            return;
+        }
+
+        if (word <= first_word_)
+        {
+            return;
+        }
+
+        size_t live = words_.size() - head_;
+        size_t n_words = static_cast<size_t>(word - first_word_);
+        n_words = n_words < live ? n_words : live;
+        head_ += n_words;
+        first_word_ += n_words;
+
+        // Dropped words are only moved out once they outnumber the live ones.
+        if (head_ >= words_.size() - head_)
+        {
+            words_.erase(words_.begin(), words_.begin() + head_);
+            head_ = 0;
+        }
+    }
+
+    //! Bitmap words. Those before head_ are no longer in use.
+    std::vector<uint32_t> words_;
+    //! Index on words_ of the first word in use.
+    size_t head_ = 0;
+    //! Absolute index (sequence number / 32) of the word at head_.
+    uint64_t first_word_ = 0;
+    //! Number of sequence numbers present on the bitmap.
+    uint64_t num_set_ = 0;
+    //! Maximum number of words spanned by the bitmap.
+    size_t max_words_ = min_window_changes / 32u + 1u;
+    //! Sequence numbers present out of the window of the bitmap.
+    std::set<uint64_t> overflow_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_READER__RECEIVEDCHANGESBITMAP_HPP
@@ -23,7 +23,6 @@
 #include <fastdds/rtps/writer/RTPSWriter.hpp>
 
 #include "rtps/RTPSDomainImpl.hpp"
-#include "utils/collections/node_size_helpers.hpp"
 #include <rtps/builtin/data/WriterProxyData.hpp>
 #include <rtps/messages/RTPSMessageCreator.hpp>
 #include <rtps/network/utils/external_locators.hpp>
@@ -65,8 +64,6 @@ WriterProxy::~WriterProxy()
     delete(heartbeat_response_);
 }
 
-using set_helper = utilities::collections::set_size_helper<SequenceNumber_t>;
-
 WriterProxy::WriterProxy(
         StatefulReader* reader,
         const RemoteLocatorsAllocationAttributes& loc_alloc,
@@ -77,10 +74,6 @@ WriterProxy::WriterProxy(
     , last_heartbeat_count_(0)
     , heartbeat_final_flag_(false)
     , is_alive_(false)
-    , changes_pool_(
-        set_helper::node_size,
-        set_helper::min_pool_size<pool_allocator_t>(changes_allocation.initial))
-    , changes_received_(changes_pool_)
     , guid_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , guid_prefix_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , is_on_same_process_(false)
@@ -91,6 +84,8 @@ WriterProxy::WriterProxy(
     , received_at_least_one_heartbeat_(false)
     , state_(StateCode::STOPPED)
 {
+    changes_received_.reserve(changes_allocation.initial, changes_allocation.maximum);
+
     //Create Events
     ResourceEvent& event_manager = reader_->getEventResource();
     auto heartbeat_lambda = [this]() -> bool
@@ -242,22 +237,10 @@ int32_t WriterProxy::lost_changes_update(
     if (seq_num > (changes_from_writer_low_mark_ + 1))
     {
         // Remove all received changes with a sequence lower than seq_num
-        ChangeIterator it = std::lower_bound(changes_received_.begin(), changes_received_.end(), seq_num);
-        if (!changes_received_.empty())
-        {
-            uint64_t tmp = (*changes_received_.begin()).to64long() - (changes_from_writer_low_mark_.to64long() + 1);
-            auto distance = std::distance(changes_received_.begin(), it);
-            tmp += seq_num.to64long() - (*changes_received_.begin()).to64long() - distance;
-            current_sample_lost = tmp > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) ?
-                    std::numeric_limits<int32_t>::max() : static_cast<int32_t>(tmp);
-        }
-        else
-        {
-            uint64_t tmp = seq_num.to64long() - (changes_from_writer_low_mark_.to64long() + 1);
-            current_sample_lost = tmp > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) ?
-                    std::numeric_limits<int32_t>::max() : static_cast<int32_t>(tmp);
-        }
-        changes_received_.erase(changes_received_.begin(), it);
+        uint64_t tmp = seq_num.to64long() - (changes_from_writer_low_mark_.to64long() + 1);
+        tmp -= changes_received_.remove_below(seq_num);
+        current_sample_lost = tmp > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) ?
+                std::numeric_limits<int32_t>::max() : static_cast<int32_t>(tmp);
 
         // Update low mark
         changes_from_writer_low_mark_ = seq_num - 1;
@@ -312,7 +295,7 @@ bool WriterProxy::received_change_set(
         }
         else
         {
-            changes_received_.insert(changes_received_.end(), seq_num);
+            changes_received_.add(seq_num);
         }
         max_sequence_number_ = seq_num;
     }
@@ -327,12 +310,10 @@ bool WriterProxy::received_change_set(
         else
         {
             // Check if already received
-            if (changes_received_.find(seq_num) != changes_received_.end())
+            if (!changes_received_.add(seq_num))
             {
                 return false;
             }
-
-            changes_received_.insert(seq_num);
         }
     }
 
@@ -349,20 +330,16 @@ SequenceNumberSet_t WriterProxy::missing_changes() const
     SequenceNumber_t max_missing = std::min(first_missing + 256UL, max_sequence_number_ + 1);
     SequenceNumberSet_t sns(first_missing);
 
-    for (SequenceNumber_t seq : changes_received_)
+    if (first_missing < max_missing)
     {
-        seq = std::min(seq, max_missing);
-        sns.add_range(first_missing, seq);
-        first_missing = seq + 1;
-        if (first_missing >= max_missing)
+        // The missing changes are the complement of the received ones, taken 32 at a time.
+        uint32_t num_bits = static_cast<uint32_t>(max_missing.to64long() - first_missing.to64long());
+        uint32_t bitmap[8];
+        for (uint32_t i = 0; i < 8u; ++i)
         {
-            break;
+            bitmap[i] = ~changes_received_.bits_from(first_missing + (i * 32u));
         }
-    }
-
-    if (first_missing < max_missing)
-    {
-        sns.add_range(first_missing, max_missing);
+        sns.bitmap_set(num_bits, bitmap);
     }
 
     return sns;
@@ -380,8 +357,7 @@ bool WriterProxy::change_was_received(
         return true;
     }
 
-    ChangeIterator chit = changes_received_.find(seq_num);
-    return chit != changes_received_.end();
+    return changes_received_.contains(seq_num);
 }
 
 const SequenceNumber_t WriterProxy::available_changes_max() const
@@ -395,17 +371,8 @@ const SequenceNumber_t WriterProxy::available_changes_max() const
 
 void WriterProxy::cleanup()
 {
-    ChangeIterator chit = changes_received_.begin();
-
-    // Jump over all consecutive received changes starting on the next to low_mark
-    while (chit != changes_received_.end() && *chit == changes_from_writer_low_mark_ + 1)
-    {
-        chit++;
-        changes_from_writer_low_mark_++;
-    }
-
-    // Remove all those changes
-    changes_received_.erase(changes_received_.begin(), chit);
+    // Jump over all consecutive received changes starting on the next to low_mark, removing them
+    changes_received_.advance(changes_from_writer_low_mark_);
 }
 
 bool WriterProxy::are_there_missing_changes() const
@@ -429,27 +396,10 @@ size_t WriterProxy::unknown_missing_changes_up_to(
     if (seq_num > changes_from_writer_low_mark_)
     {
         SequenceNumber_t first_missing = changes_from_writer_low_mark_ + 1;
-        SequenceNumberSet_t sns(first_missing);
         SequenceNumberDiff d_fun;
 
-        for (SequenceNumber_t seq : changes_received_)
-        {
-            seq = std::min(seq, seq_num);
-            if (first_missing < seq)
-            {
-                returnedValue += d_fun(seq, first_missing);
-            }
-            first_missing = seq + 1;
-            if (first_missing >= seq_num)
-            {
-                break;
-            }
-        }
-
-        if (first_missing < seq_num)
-        {
-            returnedValue += d_fun(seq_num, first_missing);
-        }
+        returnedValue = d_fun(seq_num, first_missing) -
+                static_cast<uint32_t>(changes_received_.count_below(seq_num));
     }
 
     return returnedValue;
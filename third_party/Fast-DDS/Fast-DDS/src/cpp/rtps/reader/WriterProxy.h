@@ -23,9 +23,6 @@
 #include <set>
 #include <vector>
 
-#include <foonathan/memory/container.hpp>
-#include <foonathan/memory/memory_pool.hpp>
-
 #include <fastdds/rtps/common/Types.hpp>
 #include <fastdds/rtps/common/Locator.hpp>
 #include <fastdds/rtps/common/CacheChange.hpp>
@@ -36,6 +33,7 @@
 #include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
 
 #include <rtps/builtin/data/WriterProxyData.hpp>
+#include <rtps/reader/ReceivedChangesBitmap.hpp>
 
 // Testing purpose
 #ifndef TEST_FRIENDS
@@ -388,13 +386,8 @@ private:
     //!Is the writer alive
     bool is_alive_;
 
-    using pool_allocator_t =
-            foonathan::memory::memory_pool<foonathan::memory::node_pool, foonathan::memory::heap_allocator>;
-
-    //! Memory pool allocator for changes_received_
-    pool_allocator_t changes_pool_;
-    //! Vector containing the sequence number of the received ChangeFromWriter_t objects.
-    foonathan::memory::set<SequenceNumber_t, pool_allocator_t> changes_received_;
+    //! Sequence numbers received after changes_from_writer_low_mark_ + 1.
+    ReceivedChangesBitmap changes_received_;
     //! Sequence number of the highest available change
     SequenceNumber_t changes_from_writer_low_mark_;
     //! Highest sequence number informed by writer
@@ -422,8 +415,6 @@ private:
     //! Current state of this Writer Proxy
     std::atomic<StateCode> state_;
 
-    using ChangeIterator = decltype(changes_received_)::iterator;
-
 #if !defined(NDEBUG) && defined(FASTDDS_SOURCE) && defined(__unix__)
     int get_mutex_owner() const;
 
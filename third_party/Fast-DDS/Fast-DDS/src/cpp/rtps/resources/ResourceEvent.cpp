@@ -30,13 +30,6 @@ namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
-static bool event_compare(
-        TimedEventImpl* lhs,
-        TimedEventImpl* rhs)
-{
-    return lhs->next_trigger_time() < rhs->next_trigger_time();
-}
-
 ResourceEvent::ResourceEvent()
     : thread_(new eprosima::thread())
 {
@@ -46,6 +39,7 @@ ResourceEvent::~ResourceEvent()
 {
     // All timer should be unregistered before destroying this object.
     assert(pending_timers_.empty());
+    assert(active_timers_.empty());
     assert(timers_count_ == 0);
 
     stop_thread();
@@ -104,19 +98,9 @@ void ResourceEvent::unregister_timer(
         should_notify = true;
     }
 
-    // Remove from active
-    it = std::find(active_timers_.begin(), active_timers_.end(), event);
-    if (it != active_timers_.end())
+    // Remove from active, including the list of expired timers being triggered by the service thread
+    if (active_timers_.remove(event))
     {
-        active_timers_.erase(it);
-
-        if (is_service_thread)
-        {
-            //! Warn the do_timer_actions loop to skip checking the rest of active_timers
-            //! in this iteration to prevent iterator invalidation
-            skip_checking_active_timers_.store(true);
-        }
-
         should_notify = true;
     }
 
@@ -202,9 +186,7 @@ void ResourceEvent::event_service()
 
         // Wait for the first timer to be triggered
         std::chrono::steady_clock::time_point next_trigger =
-                active_timers_.empty() ?
-                current_time_ + std::chrono::seconds(1) :
-                active_timers_[0]->next_trigger_time();
+                active_timers_.next_expiration(current_time_ + std::chrono::seconds(1));
 
         auto current_time = std::chrono::steady_clock::now();
         if (current_time > next_trigger)
@@ -227,11 +209,6 @@ void ResourceEvent::event_service()
     cv_manipulation_.notify_all();
 }
 
-void ResourceEvent::sort_timers()
-{
-    std::sort(active_timers_.begin(), active_timers_.end(), event_compare);
-}
-
 void ResourceEvent::update_current_time()
 {
     current_time_ = std::chrono::steady_clock::now();
@@ -242,72 +219,35 @@ void ResourceEvent::do_timer_actions()
     std::chrono::steady_clock::time_point cancel_time =
             current_time_ + std::chrono::hours(24);
 
-    bool did_something = false;
-
     // Process pending orders
     {
         std::lock_guard<TimedMutex> lock(mutex_);
         for (TimedEventImpl* tp : pending_timers_)
         {
-            // Remove item from active timers
-            auto current_pos = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-            current_pos = std::find(current_pos, active_timers_.end(), tp);
-            if (current_pos != active_timers_.end())
-            {
-                active_timers_.erase(current_pos);
-            }
-
             // Update timer info
             if (tp->update(current_time_, cancel_time))
             {
-                // Timer has to be activated: add to active timers
-                std::vector<TimedEventImpl*>::iterator low_bound;
-
-                // Insert on correct position
-                low_bound = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-                active_timers_.emplace(low_bound, tp);
+                // Timer has to be activated: move it to the bucket of its new trigger time
+                active_timers_.schedule(tp);
             }
+
+            // Canceled timers are left on the wheel, and dropped when their bucket is reached
         }
         pending_timers_.clear();
     }
 
     // Trigger active timers
-    skip_checking_active_timers_.store(false);
-    for (TimedEventImpl* tp : active_timers_)
+    active_timers_.advance(current_time_);
+    while (TimedEventImpl* tp = active_timers_.pop_expired())
     {
-        if (tp->next_trigger_time() <= current_time_)
-        {
-            did_something = true;
-            tp->trigger(current_time_, cancel_time);
+        tp->trigger(current_time_, cancel_time);
 
-            //! skip this iteration as active_timers has been manipulated
-            if (skip_checking_active_timers_.load())
-            {
-                break;
-            }
-        }
-        else
+        // Timer restarted by its callback
+        if (tp->next_trigger_time() < cancel_time)
         {
-            break;
+            active_timers_.schedule(tp);
         }
     }
-
-    // If an action was made, keep active_timers_ sorted
-    if (did_something)
-    {
-        sort_timers();
-        active_timers_.erase(
-            std::lower_bound(active_timers_.begin(), active_timers_.end(), nullptr,
-            [cancel_time](
-                TimedEventImpl* a,
-                TimedEventImpl* b)
-            {
-                (void)b;
-                return a->next_trigger_time() < cancel_time;
-            }),
-            active_timers_.end()
-            );
-    }
 }
 
 void ResourceEvent::init_thread(
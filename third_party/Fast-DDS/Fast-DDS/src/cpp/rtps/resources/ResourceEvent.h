@@ -31,6 +31,8 @@
 #include <fastdds/utils/TimedMutex.hpp>
 #include <fastdds/utils/TimedConditionVariable.hpp>
 
+#include <rtps/resources/TimingWheel.h>
+
 namespace eprosima {
 
 class thread;
@@ -133,11 +135,8 @@ private:
     //! Collection of events pending update action.
     std::vector<TimedEventImpl*> pending_timers_;
 
-    //! Collection of registered events waiting completion.
-    std::vector<TimedEventImpl*> active_timers_;
-
-    //! Prevents iterator invalidation when active_timers are manipulated inside loops
-    std::atomic<bool> skip_checking_active_timers_;
+    //! Registered events waiting completion.
+    TimingWheel active_timers_;
 
     //! Current time as seen by the execution thread.
     std::chrono::steady_clock::time_point current_time_;
@@ -157,9 +156,6 @@ private:
     //! Method called by the internal thread.
     void event_service();
 
-    //! Sorts waiting timers in ascending order of trigger time.
-    void sort_timers();
-
     //! Updates internal register of current time.
     void update_current_time();
 
@@ -170,7 +166,6 @@ private:
     void resize_collections()
     {
         pending_timers_.reserve(timers_count_);
-        active_timers_.reserve(timers_count_);
     }
 
 };
@@ -26,6 +26,7 @@
 #include <rtps/resources/TimedEvent.h>
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
 
 namespace eprosima {
@@ -41,6 +42,8 @@ class TimedEventImpl
 {
     using Callback = std::function<bool ()>;
 
+    friend class TimingWheel;
+
 public:
 
     enum StateCode
@@ -111,6 +114,15 @@ public:
         return next_trigger_time_;
     }
 
+    /*!
+     * @brief Returns whether the event is waiting for the event service to be triggered.
+     * @return true when the event is WAITING.
+     */
+    bool is_waiting() const
+    {
+        return StateCode::WAITING == state_.load();
+    }
+
     /*!
      * @brief Tries to set the event as READY.
      * To achieve it, the event has to be INACTIVE.
@@ -156,6 +168,15 @@ private:
 
     //! Current state of this event
     std::atomic<StateCode> state_;
+
+    //! Previous event on the same TimingWheel bucket
+    TimedEventImpl* wheel_prev_ = nullptr;
+
+    //! Next event on the same TimingWheel bucket
+    TimedEventImpl* wheel_next_ = nullptr;
+
+    //! TimingWheel bucket holding this event
+    uint32_t wheel_bucket_ = UINT32_MAX;
 };
 
 } // namespace rtps
@@ -0,0 +1,331 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimingWheel.cpp
+ */
+
+#include <rtps/resources/TimingWheel.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+#include "TimedEventImpl.h"
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+constexpr uint32_t TimingWheel::bits_per_level;
+constexpr uint32_t TimingWheel::slots_per_level;
+constexpr uint64_t TimingWheel::slot_mask;
+constexpr uint32_t TimingWheel::num_levels;
+constexpr uint32_t TimingWheel::expired_list;
+constexpr uint32_t TimingWheel::no_bucket;
+
+static uint32_t lowest_set_bit(
+        uint64_t value)
+{
+    assert(0 != value);
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#else
+    uint32_t pos = 0;
+    while (0 == (value & 1u))
+    {
+        value >>= 1;
+        ++pos;
+    }
+    return pos;
+#endif // if defined(__GNUC__) || defined(__clang__)
+}
+
+TimingWheel::TimingWheel()
+    : start_(std::chrono::steady_clock::now())
+{
+    std::fill(std::begin(heads_), std::end(heads_), nullptr);
+    std::fill(std::begin(occupied_), std::end(occupied_), 0u);
+}
+
+void TimingWheel::schedule(
+        TimedEventImpl* event)
+{
+    unlink(event);
+    link(event, bucket_for(tick_of(event->next_trigger_time())));
+}
+
+bool TimingWheel::remove(
+        TimedEventImpl* event)
+{
+    if (no_bucket == event->wheel_bucket_)
+    {
+        return false;
+    }
+
+    unlink(event);
+    return true;
+}
+
+void TimingWheel::advance(
+        time_point now)
+{
+    uint64_t target = tick_of(now);
+    while (true)
+    {
+        collect(now);
+        if (current_tick_ >= target)
+        {
+            break;
+        }
+
+        // Jump to the next non-empty bucket of the first level, or to the start of its next rotation
+        uint64_t index = current_tick_ & slot_mask;
+        uint64_t next_tick = (current_tick_ | slot_mask) + 1;
+        uint64_t later = (slot_mask == index) ? 0u : occupied_[0] >> (index + 1);
+        if (0 != later)
+        {
+            next_tick = current_tick_ + 1 + lowest_set_bit(later);
+        }
+
+        if (next_tick > target)
+        {
+            // Nothing to do between here and the target tick
+            current_tick_ = target;
+            break;
+        }
+
+        current_tick_ = next_tick;
+        if (0 == (current_tick_ & slot_mask))
+        {
+            cascade();
+        }
+    }
+}
+
+TimedEventImpl* TimingWheel::pop_expired()
+{
+    TimedEventImpl* event = heads_[expired_list];
+    if (nullptr != event)
+    {
+        unlink(event);
+    }
+    return event;
+}
+
+TimingWheel::time_point TimingWheel::next_expiration(
+        time_point limit) const
+{
+    // Earliest waiting event on the first level, where canceled events may still be linked
+    uint64_t index = current_tick_ & slot_mask;
+    uint64_t pending = occupied_[0] >> index;
+    while (0 != pending)
+    {
+        uint32_t offset = lowest_set_bit(pending);
+        bool found = false;
+        time_point earliest = limit;
+        for (TimedEventImpl* event = heads_[index + offset]; nullptr != event; event = event->wheel_next_)
+        {
+            if (event->is_waiting())
+            {
+                found = true;
+                earliest = std::min(earliest, event->next_trigger_time());
+            }
+        }
+        if (found)
+        {
+            return earliest;
+        }
+        pending &= ~(uint64_t(1) << offset);
+    }
+
+    // Start of the next bucket to be cascaded
+    for (uint32_t level = 1; level < num_levels; ++level)
+    {
+        uint32_t shift = bits_per_level * level;
+        uint64_t level_index = (current_tick_ >> shift) & slot_mask;
+        uint64_t later = (slot_mask == level_index) ? 0u : occupied_[level] >> (level_index + 1);
+        uint32_t rotation_shift = shift + bits_per_level;
+        if (0 != later)
+        {
+            uint64_t tick = ((current_tick_ >> rotation_shift) << rotation_shift) |
+                    ((level_index + 1 + lowest_set_bit(later)) << shift);
+            return std::min(time_of(tick), limit);
+        }
+
+        // Only the top level wraps: its buckets before the current one belong to its next rotation
+        uint64_t wrapped = (num_levels - 1 == level) ? occupied_[level] & ((uint64_t(1) << level_index) - 1) : 0u;
+        if (0 != wrapped)
+        {
+            uint64_t tick = (((current_tick_ >> rotation_shift) + 1) << rotation_shift) |
+                    (uint64_t(lowest_set_bit(wrapped)) << shift);
+            return std::min(time_of(tick), limit);
+        }
+    }
+
+    return limit;
+}
+
+uint64_t TimingWheel::tick_of(
+        time_point time) const
+{
+    if (time <= start_)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<tick_duration>(time - start_).count());
+}
+
+TimingWheel::time_point TimingWheel::time_of(
+        uint64_t tick) const
+{
+    return start_ + tick_duration(static_cast<tick_duration::rep>(tick));
+}
+
+uint32_t TimingWheel::bucket_for(
+        uint64_t tick) const
+{
+    // Events already due go on the bucket of the current tick
+    tick = std::max(tick, current_tick_);
+
+    // The level is given by the highest group of bits where the tick differs from the current one
+    uint64_t diff = tick ^ current_tick_;
+    uint32_t level = 0;
+    while (level < num_levels && 0 != (diff >> (bits_per_level * (level + 1))))
+    {
+        ++level;
+    }
+
+    if (num_levels == level)
+    {
+        // The top level has no level above, so its buckets are used modulo the wheel. The tick may differ on
+        // the bits above the wheel just because it is past a rotation of the top level.
+        level = num_levels - 1;
+        uint32_t shift = bits_per_level * level;
+        uint64_t top_index = current_tick_ >> shift;
+        if ((tick >> shift) - top_index >= slots_per_level)
+        {
+            // Beyond the range of the wheel: use the last bucket of the top level to be cascaded,
+            // where the event will be placed again
+            return level * slots_per_level + static_cast<uint32_t>((top_index - 1) & slot_mask);
+        }
+    }
+
+    return level * slots_per_level + static_cast<uint32_t>((tick >> (bits_per_level * level)) & slot_mask);
+}
+
+void TimingWheel::link(
+        TimedEventImpl* event,
+        uint32_t bucket)
+{
+    assert(no_bucket == event->wheel_bucket_);
+
+    event->wheel_bucket_ = bucket;
+    event->wheel_prev_ = nullptr;
+    event->wheel_next_ = heads_[bucket];
+    if (nullptr != event->wheel_next_)
+    {
+        event->wheel_next_->wheel_prev_ = event;
+    }
+    heads_[bucket] = event;
+
+    if (expired_list != bucket)
+    {
+        occupied_[bucket / slots_per_level] |= uint64_t(1) << (bucket % slots_per_level);
+    }
+    ++size_;
+}
+
+void TimingWheel::unlink(
+        TimedEventImpl* event)
+{
+    uint32_t bucket = event->wheel_bucket_;
+    if (no_bucket == bucket)
+    {
+        return;
+    }
+
+    if (nullptr != event->wheel_prev_)
+    {
+        event->wheel_prev_->wheel_next_ = event->wheel_next_;
+    }
+    else
+    {
+        heads_[bucket] = event->wheel_next_;
+    }
+    if (nullptr != event->wheel_next_)
+    {
+        event->wheel_next_->wheel_prev_ = event->wheel_prev_;
+    }
+
+    event->wheel_bucket_ = no_bucket;
+    event->wheel_prev_ = nullptr;
+    event->wheel_next_ = nullptr;
+
+    if (expired_list != bucket && nullptr == heads_[bucket])
+    {
+        occupied_[bucket / slots_per_level] &= ~(uint64_t(1) << (bucket % slots_per_level));
+    }
+    --size_;
+}
+
+void TimingWheel::collect(
+        time_point now)
+{
+    TimedEventImpl* event = heads_[current_tick_ & slot_mask];
+    while (nullptr != event)
+    {
+        TimedEventImpl* next = event->wheel_next_;
+        if (!event->is_waiting())
+        {
+            // Lazily cancelled
+            unlink(event);
+        }
+        else if (event->next_trigger_time() <= now)
+        {
+            unlink(event);
+            link(event, expired_list);
+        }
+        event = next;
+    }
+}
+
+void TimingWheel::cascade()
+{
+    for (uint32_t level = num_levels - 1; level > 0; --level)
+    {
+        uint32_t shift = bits_per_level * level;
+        if (0 != (current_tick_ & ((uint64_t(1) << shift) - 1)))
+        {
+            continue;
+        }
+
+        uint32_t bucket = level * slots_per_level + static_cast<uint32_t>((current_tick_ >> shift) & slot_mask);
+        TimedEventImpl* event = heads_[bucket];
+        while (nullptr != event)
+        {
+            TimedEventImpl* next = event->wheel_next_;
+            unlink(event);
+            if (event->is_waiting())
+            {
+                link(event, bucket_for(tick_of(event->next_trigger_time())));
+            }
+            event = next;
+        }
+    }
+}
+
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
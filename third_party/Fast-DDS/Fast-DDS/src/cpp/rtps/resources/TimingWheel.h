@@ -0,0 +1,158 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimingWheel.h
+ *
+ */
+
+#ifndef FASTDDS_RTPS_RESOURCES__TIMINGWHEEL_H
+#define FASTDDS_RTPS_RESOURCES__TIMINGWHEEL_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+class TimedEventImpl;
+
+/**
+ * Hierarchical timing wheel holding the active timers of a ResourceEvent.
+ *
+ * Each level has 64 buckets, and each bucket of a level spans a whole rotation of the level below. The first level
+ * has a resolution of one millisecond. Events are kept on intrusive lists, so scheduling, rescheduling and removing
+ * are constant time. Buckets are only used to group events: an event fires when its exact trigger time is reached.
+ *
+ * Events that are not waiting anymore are not removed eagerly: they are dropped when their bucket is reached.
+ *
+ * @warning Not thread safe. It should only be used from the execution thread of the ResourceEvent, or while that
+ * thread does not use it.
+ * @ingroup MANAGEMENT_MODULE
+ */
+class TimingWheel
+{
+public:
+
+    using time_point = std::chrono::steady_clock::time_point;
+
+    TimingWheel();
+
+    /**
+     * Links an event on the bucket of its next trigger time, unlinking it first if needed.
+     * @param event Event to schedule.
+     */
+    void schedule(
+            TimedEventImpl* event);
+
+    /**
+     * Unlinks an event from the wheel.
+     * @param event Event to remove.
+     * @return true when the event was on the wheel.
+     */
+    bool remove(
+            TimedEventImpl* event);
+
+    /**
+     * Advances the wheel up to a time, moving the waiting events due at that time to the expired list.
+     * @param now Current time.
+     */
+    void advance(
+            time_point now);
+
+    /**
+     * Takes the next event from the expired list.
+     * @return The expired event, or nullptr when the list is empty.
+     */
+    TimedEventImpl* pop_expired();
+
+    /**
+     * Computes when the wheel should be advanced next.
+     * @param limit Latest time to return.
+     * @return The earliest time an event may be due or a bucket should be cascaded, bounded by @c limit.
+     */
+    time_point next_expiration(
+            time_point limit) const;
+
+    //! @return Whether there are no events on the wheel.
+    bool empty() const
+    {
+        return 0 == size_;
+    }
+
+private:
+
+    static constexpr uint32_t bits_per_level = 6;
+    static constexpr uint32_t slots_per_level = 1u << bits_per_level;
+    static constexpr uint64_t slot_mask = slots_per_level - 1;
+    static constexpr uint32_t num_levels = 6;
+
+    //! Index of the list of expired events, after the buckets of all the levels.
+    static constexpr uint32_t expired_list = num_levels * slots_per_level;
+
+    //! Bucket of an event not linked on the wheel, as initialized by TimedEventImpl.
+    static constexpr uint32_t no_bucket = UINT32_MAX;
+
+    using tick_duration = std::chrono::milliseconds;
+
+    uint64_t tick_of(
+            time_point time) const;
+
+    time_point time_of(
+            uint64_t tick) const;
+
+    uint32_t bucket_for(
+            uint64_t tick) const;
+
+    void link(
+            TimedEventImpl* event,
+            uint32_t bucket);
+
+    void unlink(
+            TimedEventImpl* event);
+
+    //! Moves the events on the first level bucket of the current tick, dropping those not waiting anymore.
+    void collect(
+            time_point now);
+
+    //! Redistributes the buckets of the upper levels that start on the current tick.
+    void cascade();
+
+    //! Origin of the ticks.
+    time_point start_;
+
+    //! First tick not completely processed.
+    uint64_t current_tick_ = 0;
+
+    //! Heads of the bucket lists, followed by the head of the expired list.
+    TimedEventImpl* heads_[expired_list + 1];
+
+    //! Non-empty buckets of each level.
+    uint64_t occupied_[num_levels];
+
+    //! Number of events on the wheel.
+    size_t size_ = 0;
+};
+
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif //DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#endif //FASTDDS_RTPS_RESOURCES__TIMINGWHEEL_H
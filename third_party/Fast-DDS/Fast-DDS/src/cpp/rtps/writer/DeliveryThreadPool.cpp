@@ -0,0 +1,140 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeliveryThreadPool.cpp
+ */
+
+#include <rtps/writer/DeliveryThreadPool.hpp>
+
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+DeliveryThreadPool::DeliveryThreadPool(
+        uint32_t num_threads,
+        const ThreadSettings& thread_settings,
+        uint32_t participant_id,
+        const char* name_format)
+{
+    threads_.reserve(num_threads);
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads_.emplace_back(create_thread([this]()
+                {
+                    worker_loop();
+                }, thread_settings, name_format, participant_id, i));
+    }
+}
+
+DeliveryThreadPool::~DeliveryThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+
+    for (eprosima::thread& thread : threads_)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+}
+
+void DeliveryThreadPool::run(
+        size_t num_tasks,
+        const std::function<void(size_t)>& task)
+{
+    bool expected = false;
+    if (threads_.empty() || num_tasks < 2 || !busy_.compare_exchange_strong(expected, true))
+    {
+        for (size_t i = 0; i < num_tasks; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        task_ = &task;
+        num_tasks_ = num_tasks;
+        next_task_.store(0);
+        running_workers_ = threads_.size();
+        ++job_id_;
+    }
+    work_cv_.notify_all();
+
+    perform_tasks();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]()
+                {
+                    return 0 == running_workers_;
+                });
+        task_ = nullptr;
+    }
+
+    busy_.store(false);
+}
+
+void DeliveryThreadPool::worker_loop()
+{
+    uint64_t last_job_id = 0;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        work_cv_.wait(lock, [this, last_job_id]()
+                {
+                    return stop_ || job_id_ != last_job_id;
+                });
+
+        if (stop_)
+        {
+            break;
+        }
+
+        last_job_id = job_id_;
+
+        lock.unlock();
+        perform_tasks();
+        lock.lock();
+
+        if (0 == --running_workers_)
+        {
+            done_cv_.notify_one();
+        }
+    }
+}
+
+void DeliveryThreadPool::perform_tasks()
+{
+    size_t index = next_task_.fetch_add(1);
+    while (index < num_tasks_)
+    {
+        (*task_)(index);
+        index = next_task_.fetch_add(1);
+    }
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
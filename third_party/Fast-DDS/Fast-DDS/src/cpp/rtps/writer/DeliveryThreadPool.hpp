@@ -0,0 +1,116 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeliveryThreadPool.hpp
+ */
+
+#ifndef FASTDDS_RTPS_WRITER__DELIVERYTHREADPOOL_HPP
+#define FASTDDS_RTPS_WRITER__DELIVERYTHREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+#include <utils/thread.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Pool of threads shared by the writers of a participant to fan out the delivery of a sample to its local readers.
+ *
+ * Work is done in a fork-join fashion: the calling thread takes part on the work and @ref run does not return until
+ * all the tasks have been performed. This keeps the sample and the state of the reader proxies protected by the
+ * writer's mutex, and the order of the samples received by each reader.
+ * This barrier is an intentional limit: the writing thread waits for the slowest reader of every sample, so the pool
+ * shortens a write to the time of the slowest delivery instead of the sum of all of them, but never hides it.
+ *
+ * Only one job is run at a time. When the pool is already busy, e.g. because a reader listener called on a worker
+ * writes with another writer, the tasks are performed serially on the calling thread.
+ *
+ * @ingroup WRITER_MODULE
+ */
+class DeliveryThreadPool
+{
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param num_threads     Number of worker threads, not including the calling thread.
+     * @param thread_settings Settings to apply to the worker threads.
+     * @param participant_id  Identifier of the participant, used to name the worker threads.
+     * @param name_format     Format of the name of the worker threads, receiving the participant identifier and the
+     *                        index of the thread.
+     */
+    DeliveryThreadPool(
+            uint32_t num_threads,
+            const ThreadSettings& thread_settings,
+            uint32_t participant_id,
+            const char* name_format = "dds.dlv.%u.%u");
+
+    ~DeliveryThreadPool();
+
+    /**
+     * Perform a set of independent tasks, and wait for all of them to finish.
+     *
+     * @param num_tasks Number of tasks.
+     * @param task      Functor performing the task with the index received as argument.
+     *                  It will be called concurrently with different indexes.
+     */
+    void run(
+            size_t num_tasks,
+            const std::function<void(size_t)>& task);
+
+private:
+
+    void worker_loop();
+
+    void perform_tasks();
+
+    //! Set while a job is being run.
+    std::atomic<bool> busy_{false};
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+
+    //! Functor of the job being run.
+    const std::function<void(size_t)>* task_ = nullptr;
+    //! Number of tasks of the job being run.
+    size_t num_tasks_ = 0;
+    //! Index of the next task to perform.
+    std::atomic<size_t> next_task_{0};
+    //! Number of workers still working on the current job.
+    size_t running_workers_ = 0;
+    //! Identifier of the current job, so workers do not perform the same job twice.
+    uint64_t job_id_ = 0;
+
+    bool stop_ = false;
+
+    std::vector<eprosima::thread> threads_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_WRITER__DELIVERYTHREADPOOL_HPP
@@ -0,0 +1,284 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HeartbeatAggregator.cpp
+ */
+
+#include <rtps/writer/HeartbeatAggregator.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/LocatorList.hpp>
+
+#include <rtps/messages/RTPSMessageGroup.hpp>
+#include <rtps/participant/RTPSParticipantImpl.hpp>
+#include <rtps/resources/TimedEvent.h>
+#include <rtps/writer/ReaderProxy.hpp>
+#include <rtps/writer/StatefulWriter.hpp>
+#include <utils/TimeConversion.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+constexpr size_t HeartbeatAggregator::Destination::no_destination;
+
+static int64_t steady_now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+HeartbeatAggregator::HeartbeatAggregator(
+        RTPSParticipantImpl* participant,
+        const dds::Duration_t& tick_period)
+    : participant_(participant)
+{
+    tick_event_.reset(new TimedEvent(
+                participant->getEventResource(),
+                [this]() -> bool
+                {
+                    return on_tick();
+                },
+                TimeConv::Time_t2MilliSecondsDouble(tick_period)));
+}
+
+HeartbeatAggregator::~HeartbeatAggregator()
+{
+    tick_event_.reset();
+    assert(entries_.empty());
+}
+
+HeartbeatAggregator::Entry* HeartbeatAggregator::register_writer(
+        StatefulWriter* writer,
+        const dds::Duration_t& heartbeat_period)
+{
+    std::unique_ptr<Entry> entry(new Entry(writer));
+    entry->period_ns = TimeConv::Duration_t2MicroSecondsInt64(heartbeat_period) * 1000;
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    entries_.push_back(std::move(entry));
+    return entries_.back().get();
+}
+
+void HeartbeatAggregator::unregister_writer(
+        Entry* entry)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = std::find_if(entries_.begin(), entries_.end(), [entry](const std::unique_ptr<Entry>& e)
+                    {
+                        return e.get() == entry;
+                    });
+    if (it != entries_.end())
+    {
+        // Order is not relevant, so avoid moving the rest of the entries.
+        std::swap(*it, entries_.back());
+        entries_.pop_back();
+    }
+}
+
+void HeartbeatAggregator::restart(
+        Entry& entry)
+{
+    int64_t not_armed = 0;
+    if (entry.next_due_ns.compare_exchange_strong(not_armed, steady_now_ns() + entry.period_ns.load()))
+    {
+        // Does nothing if the shared event is already scheduled.
+        tick_event_->restart_timer();
+    }
+}
+
+void HeartbeatAggregator::cancel(
+        Entry& entry)
+{
+    entry.next_due_ns = 0;
+}
+
+void HeartbeatAggregator::update_period(
+        Entry& entry,
+        const dds::Duration_t& period)
+{
+    entry.period_ns = TimeConv::Duration_t2MicroSecondsInt64(period) * 1000;
+}
+
+bool HeartbeatAggregator::on_tick()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    int64_t now = steady_now_ns();
+    bool any_armed = false;
+
+    for (std::unique_ptr<Entry>& entry : entries_)
+    {
+        int64_t due = entry->next_due_ns.load();
+        if (0 == due)
+        {
+            continue;
+        }
+
+        // Disarm before calling the writer, which may arm it again while processing.
+        if (due > now || !entry->next_due_ns.compare_exchange_strong(due, 0))
+        {
+            any_armed = true;
+            continue;
+        }
+
+        if (entry->writer->send_periodic_heartbeat(*this))
+        {
+            int64_t not_armed = 0;
+            entry->next_due_ns.compare_exchange_strong(not_armed, now + entry->period_ns.load());
+        }
+
+        any_armed |= 0 != entry->next_due_ns.load();
+    }
+
+    send_pending_heartbeats();
+
+    return any_armed;
+}
+
+void HeartbeatAggregator::add_heartbeat(
+        Endpoint* writer,
+        ReaderProxy& reader,
+        const SequenceNumber_t& first_seq,
+        const SequenceNumber_t& last_seq,
+        Count_t count,
+        bool is_final)
+{
+    const LocatorSelectorEntry* locator_entry = reader.general_locator_selector_entry();
+    const ResourceLimitedVector<Locator_t>& locators =
+            locator_entry->unicast.empty() ? locator_entry->multicast : locator_entry->unicast;
+    const GUID_t& reader_guid = reader.guid();
+
+    // Look for a destination with the same participant and locators
+    Destination* destination = nullptr;
+    auto index_it = destination_index_.find(reader_guid.guidPrefix);
+    size_t index = (destination_index_.end() == index_it) ? Destination::no_destination : index_it->second;
+    size_t last_index = Destination::no_destination;
+    while (Destination::no_destination != index)
+    {
+        Destination& candidate = destinations_[index];
+        if (locators.size() == candidate.locators_.size() &&
+                std::equal(locators.begin(), locators.end(), candidate.locators_.begin()))
+        {
+            destination = &candidate;
+            break;
+        }
+        last_index = index;
+        index = candidate.next_same_prefix_;
+    }
+
+    if (nullptr == destination)
+    {
+        if (destinations_in_use_ == destinations_.size())
+        {
+            destinations_.emplace_back(participant_, reader_guid.guidPrefix);
+        }
+
+        index = destinations_in_use_++;
+        destination = &destinations_[index];
+        destination->prefix_ = reader_guid.guidPrefix;
+        destination->prefix_as_vector_.assign(1u, reader_guid.guidPrefix);
+        destination->locators_.assign(locators.begin(), locators.end());
+        destination->next_same_prefix_ = Destination::no_destination;
+
+        if (Destination::no_destination == last_index)
+        {
+            destination_index_[reader_guid.guidPrefix] = index;
+        }
+        else
+        {
+            destinations_[last_index].next_same_prefix_ = index;
+        }
+    }
+
+    destination->remote_guids_.push_back(reader_guid);
+
+    // Several readers of the same writer on the destination are addressed with a single submessage.
+    if (!destination->heartbeats_.empty() && destination->heartbeats_.back().writer == writer)
+    {
+        destination->heartbeats_.back().reader_guid.entityId = c_EntityId_Unknown;
+        return;
+    }
+
+    destination->heartbeats_.push_back({writer, reader_guid, first_seq, last_seq, count, is_final});
+}
+
+void HeartbeatAggregator::send_pending_heartbeats()
+{
+    for (size_t n = 0; n < destinations_in_use_; ++n)
+    {
+        Destination& destination = destinations_[n];
+        assert(!destination.heartbeats_.empty());
+
+        // Datagrams are reported as sent by the writer of their heartbeats. Builtin writers (discovery, statistics)
+        // are accounted separately, so each of them gets its own datagrams, and user writers share theirs.
+        size_t first = 0;
+        while (first < destination.heartbeats_.size())
+        {
+            const GUID_t& first_guid = destination.heartbeats_[first].writer->getGuid();
+            size_t end = first + 1;
+            while (end < destination.heartbeats_.size())
+            {
+                const GUID_t& guid = destination.heartbeats_[end].writer->getGuid();
+                if (first_guid.is_builtin() ? guid != first_guid : guid.is_builtin())
+                {
+                    break;
+                }
+                ++end;
+            }
+
+            destination.sender_guid_ = first_guid;
+            try
+            {
+                RTPSMessageGroup group(participant_, destination.heartbeats_[first].writer, &destination);
+                for (size_t i = first; i < end; ++i)
+                {
+                    const PendingHeartbeat& heartbeat = destination.heartbeats_[i];
+                    group.endpoint(heartbeat.writer);
+                    group.add_heartbeat(heartbeat.first_seq, heartbeat.last_seq, heartbeat.count,
+                            heartbeat.is_final, false, heartbeat.reader_guid);
+                }
+            }
+            catch (const RTPSMessageGroup::timeout&)
+            {
+                EPROSIMA_LOG_ERROR(RTPS_WRITER, "Max blocking time reached");
+            }
+
+            first = end;
+        }
+
+        destination.remote_guids_.clear();
+        destination.heartbeats_.clear();
+    }
+
+    destinations_in_use_ = 0;
+    destination_index_.clear();
+}
+
+bool HeartbeatAggregator::Destination::send(
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+        const uint32_t& total_bytes,
+        std::chrono::steady_clock::time_point max_blocking_time_point) const
+{
+    return participant_->sendSync(buffers, total_bytes, sender_guid_,
+                   Locators(locators_.begin()), Locators(locators_.end()), max_blocking_time_point);
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
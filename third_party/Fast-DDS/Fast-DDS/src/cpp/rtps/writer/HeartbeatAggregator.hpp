@@ -0,0 +1,272 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HeartbeatAggregator.hpp
+ */
+
+#ifndef FASTDDS_RTPS_WRITER__HEARTBEATAGGREGATOR_HPP
+#define FASTDDS_RTPS_WRITER__HEARTBEATAGGREGATOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/Locator.hpp>
+#include <fastdds/rtps/common/SequenceNumber.hpp>
+#include <fastdds/rtps/common/Time_t.hpp>
+#include <fastdds/rtps/common/Types.hpp>
+#include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+class Endpoint;
+class ReaderProxy;
+class RTPSParticipantImpl;
+class StatefulWriter;
+class TimedEvent;
+
+/**
+ * Participant-level scheduler of the periodic heartbeats of its StatefulWriters.
+ *
+ * Instead of arming one TimedEvent per writer, registered writers share a single periodic event. On each tick the
+ * heartbeats of every due writer are collected and those addressed to the same destination are packed on the same
+ * datagram, as several HEARTBEAT submessages preceded by INFO_DST.
+ *
+ * Arming and cancelling the heartbeat of a writer is lock-free, so it can be done while holding the writer's mutex.
+ * The writers are called from the tick with the internal mutex taken, so registration must not be done while holding
+ * the writer's mutex.
+ *
+ * @ingroup WRITER_MODULE
+ */
+class HeartbeatAggregator
+{
+public:
+
+    //! Scheduling information of a registered writer.
+    struct Entry
+    {
+        explicit Entry(
+                StatefulWriter* w)
+            : writer(w)
+        {
+        }
+
+        //! Writer to which this entry belongs.
+        StatefulWriter* const writer;
+        //! Heartbeat period of the writer, in nanoseconds.
+        std::atomic<int64_t> period_ns{0};
+        //! Steady clock time, in nanoseconds, when the next heartbeat is due. Zero when not armed.
+        std::atomic<int64_t> next_due_ns{0};
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param participant  Participant whose writers will be served by this object.
+     * @param tick_period  Period of the shared event checking which heartbeats are due.
+     */
+    HeartbeatAggregator(
+            RTPSParticipantImpl* participant,
+            const dds::Duration_t& tick_period);
+
+    ~HeartbeatAggregator();
+
+    /**
+     * Register a writer on this aggregator.
+     *
+     * @param writer            Writer to register.
+     * @param heartbeat_period  Heartbeat period of the writer.
+     *
+     * @return The entry to be used to manage the heartbeats of the writer.
+     */
+    Entry* register_writer(
+            StatefulWriter* writer,
+            const dds::Duration_t& heartbeat_period);
+
+    /**
+     * Unregister a writer from this aggregator.
+     * Blocks until any tick using the writer has finished.
+     *
+     * @param entry  Entry returned by @ref register_writer.
+     */
+    void unregister_writer(
+            Entry* entry);
+
+    /**
+     * Schedule the periodic heartbeat of a writer, if it was not already scheduled.
+     *
+     * @param entry  Entry of the writer.
+     */
+    void restart(
+            Entry& entry);
+
+    /**
+     * Cancel the periodic heartbeat of a writer.
+     *
+     * @param entry  Entry of the writer.
+     */
+    void cancel(
+            Entry& entry);
+
+    /**
+     * Update the heartbeat period of a writer.
+     * As with TimedEvent, the new period is used the next time the heartbeat is scheduled.
+     *
+     * @param entry   Entry of the writer.
+     * @param period  New heartbeat period.
+     */
+    void update_period(
+            Entry& entry,
+            const dds::Duration_t& period);
+
+    /**
+     * Add a heartbeat for a remote reader to the datagrams being built on the current tick.
+     * Only to be called by writers from @ref StatefulWriter::send_periodic_heartbeat(HeartbeatAggregator&).
+     *
+     * @param writer      Writer sending the heartbeat.
+     * @param reader      Proxy of the remote reader the heartbeat is addressed to.
+     * @param first_seq   First available sequence number.
+     * @param last_seq    Last available sequence number.
+     * @param count       Heartbeat count.
+     * @param is_final    Whether the final flag should be set.
+     */
+    void add_heartbeat(
+            Endpoint* writer,
+            ReaderProxy& reader,
+            const SequenceNumber_t& first_seq,
+            const SequenceNumber_t& last_seq,
+            Count_t count,
+            bool is_final);
+
+private:
+
+    struct PendingHeartbeat
+    {
+        Endpoint* writer;
+        GUID_t reader_guid;
+        SequenceNumber_t first_seq;
+        SequenceNumber_t last_seq;
+        Count_t count;
+        bool is_final;
+    };
+
+    /**
+     * Set of heartbeats addressed to the same locators of the same remote participant.
+     * It also acts as the sender of the datagram built with them.
+     */
+    class Destination : public RTPSMessageSenderInterface
+    {
+    public:
+
+        Destination(
+                RTPSParticipantImpl* participant,
+                const GuidPrefix_t& prefix)
+            : participant_(participant)
+            , prefix_(prefix)
+            , prefix_as_vector_(1u, prefix)
+        {
+        }
+
+        bool destinations_have_changed() const override
+        {
+            return false;
+        }
+
+        GuidPrefix_t destination_guid_prefix() const override
+        {
+            return prefix_;
+        }
+
+        const std::vector<GuidPrefix_t>& remote_participants() const override
+        {
+            return prefix_as_vector_;
+        }
+
+        const std::vector<GUID_t>& remote_guids() const override
+        {
+            return remote_guids_;
+        }
+
+        bool send(
+                const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+                const uint32_t& total_bytes,
+                std::chrono::steady_clock::time_point max_blocking_time_point) const override;
+
+        /*
+         * Do nothing.
+         * This object is only used from the tick, with the aggregator's mutex taken.
+         */
+        void lock() override
+        {
+        }
+
+        /*
+         * Do nothing.
+         * This object is only used from the tick, with the aggregator's mutex taken.
+         */
+        void unlock() override
+        {
+        }
+
+        RTPSParticipantImpl* participant_;
+        GuidPrefix_t prefix_;
+        std::vector<GuidPrefix_t> prefix_as_vector_;
+        std::vector<Locator_t> locators_;
+        std::vector<GUID_t> remote_guids_;
+        std::vector<PendingHeartbeat> heartbeats_;
+        //! Writer reported as the sender of the datagram being built.
+        GUID_t sender_guid_;
+        //! Index of the next destination for the same participant with different locators.
+        size_t next_same_prefix_ = no_destination;
+
+        static constexpr size_t no_destination = static_cast<size_t>(-1);
+    };
+
+    bool on_tick();
+
+    void send_pending_heartbeats();
+
+    RTPSParticipantImpl* participant_;
+
+    //! Protects the registered entries and the pending destinations.
+    std::mutex mutex_;
+
+    std::vector<std::unique_ptr<Entry>> entries_;
+
+    //! Destinations with heartbeats pending to be sent. Kept between ticks to reuse allocated memory.
+    std::vector<Destination> destinations_;
+
+    //! Number of destinations in use on the current tick.
+    size_t destinations_in_use_ = 0;
+
+    //! Index of the first destination used for each remote participant on the current tick.
+    std::map<GuidPrefix_t, size_t> destination_index_;
+
+    //! Shared periodic event. Declared last so it is destroyed first.
+    std::unique_ptr<TimedEvent> tick_event_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_WRITER__HEARTBEATAGGREGATOR_HPP
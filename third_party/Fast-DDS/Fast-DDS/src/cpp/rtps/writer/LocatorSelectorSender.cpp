@@ -14,6 +14,85 @@ bool LocatorSelectorSender::send(
     return writer_.send_nts(buffers, total_bytes, *this, max_blocking_time_point);
 }
 
+bool LocatorSelectorSender::restore_send_plan()
+{
+    for (const SendPlan& plan : send_plans_)
+    {
+        if (matches_enabled_entries(plan))
+        {
+            const ResourceLimitedVector<LocatorSelectorEntry*>& entries = locator_selector.entries();
+            for (size_t i = 0; i < entries.size(); ++i)
+            {
+                entries[i]->state.unicast.assign(plan.unicast[i].begin(), plan.unicast[i].end());
+                entries[i]->state.multicast.assign(plan.multicast[i].begin(), plan.multicast[i].end());
+            }
+            locator_selector.restore_selections(plan.selections);
+            all_remote_readers.assign(plan.remote_readers.begin(), plan.remote_readers.end());
+            all_remote_participants.assign(plan.remote_participants.begin(), plan.remote_participants.end());
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void LocatorSelectorSender::store_send_plan()
+{
+    SendPlan* plan_ptr = nullptr;
+    if (send_plans_.size() < max_send_plans_)
+    {
+        send_plans_.emplace_back();
+        plan_ptr = &send_plans_.back();
+    }
+    else
+    {
+        // Replace the oldest one
+        plan_ptr = &send_plans_[next_send_plan_];
+        next_send_plan_ = (next_send_plan_ + 1) % max_send_plans_;
+    }
+    SendPlan& plan = *plan_ptr;
+
+    const ResourceLimitedVector<LocatorSelectorEntry*>& entries = locator_selector.entries();
+    plan.enabled.resize(entries.size());
+    plan.unicast.resize(entries.size());
+    plan.multicast.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        plan.enabled[i] = entries[i]->enabled;
+        plan.unicast[i].assign(entries[i]->state.unicast.begin(), entries[i]->state.unicast.end());
+        plan.multicast[i].assign(entries[i]->state.multicast.begin(), entries[i]->state.multicast.end());
+    }
+    plan.selections.assign(locator_selector.selections().begin(), locator_selector.selections().end());
+    plan.remote_readers.assign(all_remote_readers.begin(), all_remote_readers.end());
+    plan.remote_participants.assign(all_remote_participants.begin(), all_remote_participants.end());
+}
+
+void LocatorSelectorSender::invalidate_send_plans()
+{
+    send_plans_.clear();
+    next_send_plan_ = 0;
+}
+
+bool LocatorSelectorSender::matches_enabled_entries(
+        const SendPlan& plan) const
+{
+    const ResourceLimitedVector<LocatorSelectorEntry*>& entries = locator_selector.entries();
+    if (plan.enabled.size() != entries.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        if (plan.enabled[i] != entries[i]->enabled)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
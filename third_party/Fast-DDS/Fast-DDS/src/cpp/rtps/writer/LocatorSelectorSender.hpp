@@ -124,6 +124,28 @@ public:
         return mutex_.try_lock_until(abs_time);
     }
 
+    /*!
+     * Restore the result of a previous locator selection done with the same enabled entries.
+     *
+     * On success, the selected locators and the destination GUIDs are the same as if the locators were selected
+     * again by the transports, and compute_selected_guids() were called.
+     *
+     * @return true if a send plan for the current enabled entries was found, false otherwise.
+     */
+    bool restore_send_plan();
+
+    /*!
+     * Store the result of the current locator selection, for the current enabled entries.
+     * Should be called after selecting the locators and computing the destination GUIDs.
+     */
+    void store_send_plan();
+
+    /*!
+     * Discard all stored send plans.
+     * Should be called whenever entries are added, removed or their locators change.
+     */
+    void invalidate_send_plans();
+
     fastdds::rtps::LocatorSelector locator_selector;
 
     ResourceLimitedVector<GUID_t> all_remote_readers;
@@ -132,9 +154,35 @@ public:
 
 private:
 
+    //! Result of a locator selection for a set of enabled entries.
+    struct SendPlan
+    {
+        //! Enabled flag of each entry.
+        std::vector<bool> enabled;
+        //! Indexes of the selected entries.
+        std::vector<size_t> selections;
+        //! Selected unicast locators of each entry.
+        std::vector<std::vector<size_t>> unicast;
+        //! Selected multicast locators of each entry.
+        std::vector<std::vector<size_t>> multicast;
+        std::vector<GUID_t> remote_readers;
+        std::vector<GuidPrefix_t> remote_participants;
+    };
+
+    //! Maximum number of send plans kept. Writers usually alternate among a few sets of destinations.
+    static constexpr size_t max_send_plans_ = 4;
+
+    bool matches_enabled_entries(
+            const SendPlan& plan) const;
+
     BaseWriter& writer_;
 
     RecursiveTimedMutex mutex_;
+
+    std::vector<SendPlan> send_plans_;
+
+    //! Slot to be replaced when storing a new plan with all slots in use.
+    size_t next_send_plan_ = 0;
 };
 
 } // namespace rtps
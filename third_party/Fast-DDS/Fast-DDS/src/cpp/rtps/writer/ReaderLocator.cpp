@@ -53,6 +53,7 @@ ReaderLocator::ReaderLocator(
     if (owner->is_datasharing_compatible())
     {
         datasharing_notifier_ = new DataSharingNotifier(
+            owner->getGuid(),
             owner->getAttributes().data_sharing_configuration().shm_directory());
     }
 }
@@ -170,6 +170,7 @@ void ReaderProxy::stop()
     disable_timers();
 
     changes_for_reader_.clear();
+    changes_head_ = 0;
     next_expected_acknack_count_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
@@ -228,7 +229,7 @@ void ReaderProxy::add_change(
         bool is_relevant)
 {
     assert(change.getSequenceNumber() > changes_low_mark_);
-    assert(changes_for_reader_.empty() ? true :
+    assert(changes_empty() ? true :
             change.getSequenceNumber() > changes_for_reader_.back().getSequenceNumber());
 
     // Irrelevant changes are not added to the collection
@@ -242,6 +243,12 @@ void ReaderProxy::add_change(
         return;
     }
 
+    // Reuse the room left by acknowledged changes before growing the collection
+    if (0 < changes_head_ && changes_for_reader_.size() == changes_for_reader_.capacity())
+    {
+        compact_changes();
+    }
+
     if (changes_for_reader_.push_back(change) == nullptr)
     {
         // This should never happen
@@ -254,13 +261,13 @@ void ReaderProxy::add_change(
 
 bool ReaderProxy::has_changes() const
 {
-    return !changes_for_reader_.empty();
+    return !changes_empty();
 }
 
 bool ReaderProxy::change_is_acked(
         const SequenceNumber_t& seq_num) const
 {
-    if (seq_num <= changes_low_mark_ || changes_for_reader_.empty())
+    if (seq_num <= changes_low_mark_ || changes_empty())
     {
         return true;
     }
@@ -283,7 +290,7 @@ bool ReaderProxy::change_is_unsent(
         const SequenceNumber_t& min_seq,
         bool& need_reactivate_periodic_heartbeat) const
 {
-    if (seq_num <= changes_low_mark_ || changes_for_reader_.empty())
+    if (seq_num <= changes_low_mark_ || changes_empty())
     {
         return false;
     }
@@ -307,7 +314,7 @@ bool ReaderProxy::change_is_unsent(
         {
             need_reactivate_periodic_heartbeat |= true;
             SequenceNumber_t prev =
-                    (changes_for_reader_.begin() != chit ?
+                    (changes_begin() != chit ?
                     std::prev(chit)->getSequenceNumber() :
                     changes_low_mark_
                     ) + 1;
@@ -351,7 +358,7 @@ void ReaderProxy::acked_changes_set(
             ++chit;
             ++future_low_mark;
         }
-        changes_for_reader_.erase(changes_for_reader_.begin(), chit);
+        erase_changes_front(chit);
     }
     else
     {
@@ -393,6 +400,11 @@ void ReaderProxy::acked_changes_set(
                             should_sort = true;
                             ChangeForReader_t cr(change);
                             cr.setStatus(UNACKNOWLEDGED);
+                            if (0 < changes_head_ && changes_for_reader_.size() == changes_for_reader_.capacity())
+                            {
+                                // Compaction invalidates iterators, but none is kept alive between iterations
+                                compact_changes();
+                            }
                             changes_for_reader_.push_back(cr);
                         }
                     }
@@ -400,7 +412,7 @@ void ReaderProxy::acked_changes_set(
                 // Keep changes sorted by sequence number
                 if (should_sort)
                 {
-                    std::sort(changes_for_reader_.begin(), changes_for_reader_.end(), ChangeForReaderCmp());
+                    std::sort(changes_begin(), changes_for_reader_.end(), ChangeForReaderCmp());
                 }
             }
             else if (!is_local_reader())
@@ -484,8 +496,8 @@ void ReaderProxy::from_unsent_to_status(
 
     if (ACKNOWLEDGED == status && seq_num == changes_low_mark_ + 1)
     {
-        assert(changes_for_reader_.begin() == it);
-        changes_for_reader_.erase(it);
+        assert(changes_begin() == it);
+        erase_changes_front(it + 1);
         acked_changes_set(seq_num + 1);
         return;
     }
@@ -545,8 +557,9 @@ uint32_t ReaderProxy::convert_status_on_all_changes(
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
     uint32_t changed = 0;
-    for (ChangeForReader_t& change : changes_for_reader_)
+    for (ChangeIterator it = changes_begin(); it != changes_for_reader_.end(); ++it)
     {
+        ChangeForReader_t& change = *it;
         if (change.getStatus() == previous)
         {
             ++changed;
@@ -566,7 +579,7 @@ void ReaderProxy::change_has_been_removed(
         const SequenceNumber_t& seq_num)
 {
     // Check sequence number is in the container, because it was not clean up.
-    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.begin()->getSequenceNumber())
+    if (changes_empty() || seq_num < changes_begin()->getSequenceNumber())
     {
         return;
     }
@@ -586,7 +599,15 @@ void ReaderProxy::change_has_been_removed(
     }
 
     // Element may not be in the container when marked as irrelevant.
-    changes_for_reader_.erase(chit);
+    if (changes_begin() == chit)
+    {
+        // Removing the oldest change is the usual case (KEEP_LAST), avoid moving the rest of the changes.
+        erase_changes_front(std::next(changes_begin()));
+    }
+    else
+    {
+        changes_for_reader_.erase(chit);
+    }
 
     // When removing the next-to-be-acknowledged, we should auto-acknowledge it.
     if ((changes_low_mark_ + 1) == seq_num)
@@ -603,9 +624,9 @@ bool ReaderProxy::has_unacknowledged(
         return true;
     }
 
-    for (const ChangeForReader_t& it : changes_for_reader_)
+    for (ChangeConstIterator it = changes_begin(); it != changes_for_reader_.end(); ++it)
     {
-        if (it.getStatus() == UNACKNOWLEDGED)
+        if (it->getStatus() == UNACKNOWLEDGED)
         {
             return true;
         }
@@ -668,9 +689,15 @@ ReaderProxy::ChangeIterator ReaderProxy::find_change(
         const SequenceNumber_t& seq_num,
         bool exact)
 {
-    ReaderProxy::ChangeIterator it;
+    ReaderProxy::ChangeIterator begin = changes_begin();
     ReaderProxy::ChangeIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    ReaderProxy::ChangeIterator it = begin + search_offset(seq_num);
+
+    // Direct hit when there are no holes between the first change and the one being looked for
+    if (it == end || it->getSequenceNumber() != seq_num)
+    {
+        it = std::lower_bound(begin, it == end ? end : it + 1, seq_num, change_less_than_sequence);
+    }
 
     return (!exact)
            ? it
@@ -682,15 +709,66 @@ ReaderProxy::ChangeIterator ReaderProxy::find_change(
 ReaderProxy::ChangeConstIterator ReaderProxy::find_change(
         const SequenceNumber_t& seq_num) const
 {
-    ReaderProxy::ChangeConstIterator it;
+    ReaderProxy::ChangeConstIterator begin = changes_begin();
     ReaderProxy::ChangeConstIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    ReaderProxy::ChangeConstIterator it = begin + search_offset(seq_num);
+
+    // Direct hit when there are no holes between the first change and the one being looked for
+    if (it == end || it->getSequenceNumber() != seq_num)
+    {
+        it = std::lower_bound(begin, it == end ? end : it + 1, seq_num, change_less_than_sequence);
+    }
 
     return it == end
            ? it
            : it->getSequenceNumber() == seq_num ? it : end;
 }
 
+size_t ReaderProxy::search_offset(
+        const SequenceNumber_t& seq_num) const
+{
+    size_t num_changes = changes_for_reader_.size() - changes_head_;
+    if (0 == num_changes)
+    {
+        return 0;
+    }
+
+    // Sequence numbers are strictly increasing, so a change is never further from the first one than the difference
+    // of their sequence numbers.
+    SequenceNumber_t first_seq = changes_begin()->getSequenceNumber();
+    if (seq_num <= first_seq)
+    {
+        return 0;
+    }
+
+    uint64_t distance = seq_num.to64long() - first_seq.to64long();
+    return distance < num_changes ? static_cast<size_t>(distance) : num_changes;
+}
+
+void ReaderProxy::erase_changes_front(
+        ChangeIterator last)
+{
+    changes_head_ = static_cast<size_t>(std::distance(changes_for_reader_.begin(), last));
+
+    // Acknowledged changes are only moved out once they outnumber the pending ones, so each erasure is O(1) amortized.
+    size_t num_changes = changes_for_reader_.size() - changes_head_;
+    if (0 == num_changes)
+    {
+        changes_for_reader_.clear();
+        changes_head_ = 0;
+    }
+    else if (changes_head_ >= num_changes)
+    {
+        compact_changes();
+    }
+}
+
+void ReaderProxy::compact_changes()
+{
+    changes_for_reader_.erase(changes_for_reader_.begin(), changes_begin());
+    changes_head_ = 0;
+}
+
 bool ReaderProxy::has_been_delivered(
         const SequenceNumber_t& seq_number,
         bool& found) const
@@ -434,8 +434,10 @@ private:
     bool disable_positive_acks_;
     //!Pointer to the associated StatefulWriter.
     StatefulWriter* writer_;
-    //!Set of the changes and its state.
+    //!Set of the changes and its state. Elements before changes_head_ are already acknowledged and pending removal.
     ResourceLimitedVector<ChangeForReader_t, std::true_type> changes_for_reader_;
+    //!Index on changes_for_reader_ of the first change not yet acknowledged.
+    size_t changes_head_ = 0;
     //! Timed Event to manage the delay to mark a change as UNACKED after sending it.
     TimedEvent* nack_supression_event_;
     TimedEvent* initial_heartbeat_event_;
@@ -499,6 +501,41 @@ private:
      */
     ChangeConstIterator find_change(
             const SequenceNumber_t& seq_num) const;
+
+    /**
+     * @brief Get the upper bound of the position of a change, relative to the first change.
+     * When there are no holes in the collection, it is the exact position of the change.
+     * @param seq_num Sequence number to find.
+     * @return Offset from changes_begin() where the search should end.
+     */
+    size_t search_offset(
+            const SequenceNumber_t& seq_num) const;
+
+    ChangeIterator changes_begin()
+    {
+        return changes_for_reader_.begin() + changes_head_;
+    }
+
+    ChangeConstIterator changes_begin() const
+    {
+        return changes_for_reader_.begin() + changes_head_;
+    }
+
+    bool changes_empty() const
+    {
+        return changes_for_reader_.size() == changes_head_;
+    }
+
+    /**
+     * @brief Remove the changes at the front of the collection, up to (but not including) the one pointed by last.
+     * Removed changes are only moved out of the collection from time to time.
+     * @param last Iterator to the first change to keep.
+     */
+    void erase_changes_front(
+            ChangeIterator last);
+
+    //! Move out of the collection the changes already removed from the front.
+    void compact_changes();
 };
 
 } /* namespace rtps */
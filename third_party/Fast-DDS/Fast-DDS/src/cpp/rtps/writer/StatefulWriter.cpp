@@ -52,6 +52,7 @@
 #include <rtps/resources/TimedEvent.h>
 #include <rtps/RTPSDomainImpl.hpp>
 #include <rtps/writer/BaseWriter.hpp>
+#include <rtps/writer/DeliveryThreadPool.hpp>
 #include <rtps/writer/ReaderProxy.hpp>
 #include <utils/TimeConversion.hpp>
 
@@ -214,13 +215,25 @@ void StatefulWriter::init(
     auto push_mode = PropertyPolicyHelper::find_property(att.endpoint.properties, "fastdds.push_mode");
     push_mode_ = !((nullptr != push_mode) && ("false" == *push_mode));
 
-    periodic_hb_event_ = new TimedEvent(
-        pimpl->getEventResource(),
-        [&]() -> bool
-        {
-            return send_periodic_heartbeat();
-        },
-        fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(times_.heartbeat_period));
+    // Builtin writers keep their own timer, as discovery traffic should not wait for the aggregator's tick.
+    hb_aggregator_ = m_guid.is_builtin() ? nullptr : pimpl->heartbeat_aggregator();
+    if (nullptr != hb_aggregator_)
+    {
+        hb_aggregator_entry_ = hb_aggregator_->register_writer(this, times_.heartbeat_period);
+    }
+    else
+    {
+        periodic_hb_event_ = new TimedEvent(
+            pimpl->getEventResource(),
+            [&]() -> bool
+            {
+                return send_periodic_heartbeat();
+            },
+            fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(times_.heartbeat_period));
+    }
+
+    // Builtin writers keep delivering serially, as their readers may write on other builtin writers.
+    delivery_pool_ = m_guid.is_builtin() ? nullptr : pimpl->delivery_thread_pool();
 
     nack_response_event_ = new TimedEvent(
         pimpl->getEventResource(),
@@ -307,6 +320,12 @@ void StatefulWriter::local_actions_on_writer_removed()
         periodic_hb_event_ = nullptr;
     }
 
+    if (hb_aggregator_entry_ != nullptr)
+    {
+        hb_aggregator_->unregister_writer(hb_aggregator_entry_);
+        hb_aggregator_entry_ = nullptr;
+    }
+
     // Delete all proxies in the pool
     for (ReaderProxy* remote_reader : matched_readers_pool_)
     {
@@ -393,7 +412,7 @@ void StatefulWriter::unsent_change_added_to_history(
         }
         else
         {
-            periodic_hb_event_->restart_timer(max_blocking_time);
+            restart_periodic_heartbeat(max_blocking_time);
         }
     }
     else
@@ -563,6 +582,12 @@ void StatefulWriter::send_heartbeat_to_all_readers()
 void StatefulWriter::deliver_sample_to_intraprocesses(
         CacheChange_t* change)
 {
+    if (nullptr != delivery_pool_ && 1 < matched_local_readers_.size())
+    {
+        deliver_sample_to_intraprocesses_in_parallel(change);
+        return;
+    }
+
     for (ReaderProxy* remoteReader : matched_local_readers_)
     {
         SequenceNumber_t gap_seq;
@@ -570,34 +595,130 @@ void StatefulWriter::deliver_sample_to_intraprocesses(
         bool dumb = false;
         if (remoteReader->change_is_unsent(change->sequenceNumber, dummy, gap_seq, get_seq_num_min(), dumb))
         {
-            // If there is a hole (removed from history or not relevants) between previous sample and this one,
-            // send it a personal GAP.
-            if (SequenceNumber_t::unknown() != gap_seq)
+            deliver_sample_to_intraprocess(change, remoteReader, gap_seq);
+        }
+    }
+}
+
+void StatefulWriter::deliver_sample_to_intraprocess(
+        CacheChange_t* change,
+        ReaderProxy* remoteReader,
+        const SequenceNumber_t& gap_seq)
+{
+    // If there is a hole (removed from history or not relevants) between previous sample and this one,
+    // send it a personal GAP.
+    if (SequenceNumber_t::unknown() != gap_seq)
+    {
+        intraprocess_gap(remoteReader, gap_seq, change->sequenceNumber);
+        remoteReader->acked_changes_set(change->sequenceNumber);
+    }
+    bool delivered = intraprocess_delivery(change, remoteReader);
+    if (!remoteReader->is_reliable())
+    {
+        remoteReader->acked_changes_set(change->sequenceNumber + 1);
+    }
+    else
+    {
+        intraprocess_heartbeat(remoteReader, false);
+        remoteReader->from_unsent_to_status(
+            change->sequenceNumber,
+            delivered ? ACKNOWLEDGED : UNACKNOWLEDGED,
+            false,
+            delivered);
+    }
+}
+
+void StatefulWriter::deliver_sample_to_intraprocesses_in_parallel(
+        CacheChange_t* change)
+{
+    // Only the reception on each local reader is done in parallel. Reader proxies and heartbeats, which may call
+    // back into this writer, are handled on this thread, which owns the writer's mutex.
+    parallel_deliveries_.clear();
+    SequenceNumber_t min_seq = get_seq_num_min();
+    for (ReaderProxy* remoteReader : matched_local_readers_)
+    {
+        SequenceNumber_t gap_seq;
+        FragmentNumber_t dummy = 0;
+        bool dumb = false;
+        if (remoteReader->change_is_unsent(change->sequenceNumber, dummy, gap_seq, min_seq, dumb))
+        {
+            bool may_call_user_listener = false;
             {
-                intraprocess_gap(remoteReader, gap_seq, change->sequenceNumber);
-                remoteReader->acked_changes_set(change->sequenceNumber);
+                LocalReaderPointer::Instance local_reader = remoteReader->local_reader();
+                may_call_user_listener = local_reader && local_reader->may_call_user_listener();
             }
-            bool delivered = intraprocess_delivery(change, remoteReader);
-            if (!remoteReader->is_reliable())
+
+            if (may_call_user_listener)
             {
-                remoteReader->acked_changes_set(change->sequenceNumber + 1);
+                // The listener may call back into this writer, whose mutex is held by this thread.
+                deliver_sample_to_intraprocess(change, remoteReader, gap_seq);
             }
             else
             {
-                intraprocess_heartbeat(remoteReader, false);
-                remoteReader->from_unsent_to_status(
-                    change->sequenceNumber,
-                    delivered ? ACKNOWLEDGED : UNACKNOWLEDGED,
-                    false,
-                    delivered);
+                parallel_deliveries_.push_back({remoteReader, gap_seq, false});
             }
         }
     }
+
+    if (parallel_deliveries_.size() < 2)
+    {
+        for (ParallelDelivery& delivery : parallel_deliveries_)
+        {
+            deliver_sample_to_intraprocess(change, delivery.reader, delivery.gap_seq);
+        }
+        return;
+    }
+
+    // Done once here, as intraprocess_delivery would modify the change from several threads.
+    if (change->write_params.related_sample_identity() != SampleIdentity::unknown())
+    {
+        change->write_params.sample_identity(change->write_params.related_sample_identity());
+    }
+
+    delivery_pool_->run(parallel_deliveries_.size(), [this, change](size_t index)
+            {
+                ParallelDelivery& delivery = parallel_deliveries_[index];
+                LocalReaderPointer::Instance local_reader = delivery.reader->local_reader();
+                if (local_reader)
+                {
+                    // If there is a hole (removed from history or not relevants) between previous sample and this
+                    // one, send it a personal GAP.
+                    if (SequenceNumber_t::unknown() != delivery.gap_seq)
+                    {
+                        local_reader->process_gap_msg(m_guid, delivery.gap_seq,
+                        SequenceNumberSet_t(change->sequenceNumber), c_VendorId_eProsima);
+                    }
+                    delivery.delivered = local_reader->process_data_msg(change);
+                }
+            });
+
+    for (ParallelDelivery& delivery : parallel_deliveries_)
+    {
+        if (SequenceNumber_t::unknown() != delivery.gap_seq)
+        {
+            delivery.reader->acked_changes_set(change->sequenceNumber);
+        }
+        if (!delivery.reader->is_reliable())
+        {
+            delivery.reader->acked_changes_set(change->sequenceNumber + 1);
+        }
+        else
+        {
+            intraprocess_heartbeat(delivery.reader, false);
+            delivery.reader->from_unsent_to_status(
+                change->sequenceNumber,
+                delivery.delivered ? ACKNOWLEDGED : UNACKNOWLEDGED,
+                false,
+                delivery.delivered);
+        }
+    }
 }
 
 void StatefulWriter::deliver_sample_to_datasharing(
         CacheChange_t* change)
 {
+    bool parallel = nullptr != delivery_pool_ && 1 < matched_datasharing_readers_.size();
+    parallel_notifications_.clear();
     for (ReaderProxy* remoteReader : matched_datasharing_readers_)
     {
         SequenceNumber_t gap_seq;
@@ -616,9 +737,26 @@ void StatefulWriter::deliver_sample_to_datasharing(
                     UNACKNOWLEDGED,
                     false);
             }
-            remoteReader->datasharing_notify();
+
+            if (parallel)
+            {
+                parallel_notifications_.push_back(remoteReader);
+            }
+            else
+            {
+                remoteReader->datasharing_notify();
+            }
         }
     }
+
+    if (!parallel_notifications_.empty())
+    {
+        // Only the notifications, which signal a different reader each, are done in parallel.
+        delivery_pool_->run(parallel_notifications_.size(), [this](size_t index)
+                {
+                    parallel_notifications_[index]->datasharing_notify();
+                });
+    }
 }
 
 DeliveryRetCode StatefulWriter::deliver_sample_to_network(
@@ -632,6 +770,7 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
     uint32_t n_fragments = change->getFragmentCount();
     FragmentNumber_t min_unsent_fragment = 0;
     bool need_reactivate_periodic_heartbeat = false;
+    bool is_async_selector = &locator_selector == &locator_selector_async_;
 
     while (DeliveryRetCode::DELIVERED == ret_code &&
             min_unsent_fragment != n_fragments + 1)
@@ -660,7 +799,10 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
                 }
 
                 (*remote_reader)->active(true);
-                locator_selector.locator_selector.enable((*remote_reader)->guid());
+                // Enable the entry directly, instead of looking for it by GUID on the selector.
+                (is_async_selector ?
+                (*remote_reader)->async_locator_selector_entry() :
+                (*remote_reader)->general_locator_selector_entry())->enabled = true;
                 should_be_sent = true;
                 inline_qos |= (*remote_reader)->expects_inline_qos();
 
@@ -709,8 +851,12 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
                 ((should_be_sent && !separate_sending_enabled_) || should_send_global_gap))
         {
             group.flush_and_reset();
-            network.select_locators(locator_selector.locator_selector);
-            compute_selected_guids(locator_selector);
+            if (!locator_selector.restore_send_plan())
+            {
+                network.select_locators(locator_selector.locator_selector);
+                compute_selected_guids(locator_selector);
+                locator_selector.store_send_plan();
+            }
         }
 
         if (should_send_global_gap) // Send GAP for all readers
@@ -915,7 +1061,7 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
 
     if (need_reactivate_periodic_heartbeat)
     {
-        periodic_hb_event_->restart_timer(max_blocking_time);
+        restart_periodic_heartbeat(max_blocking_time);
     }
 
     return ret_code;
@@ -928,6 +1074,8 @@ void StatefulWriter::update_reader_info(
         LocatorSelectorSender& locator_selector,
         bool create_sender_resources)
 {
+    // Entries or their locators have changed, so previous selections are no longer valid.
+    locator_selector.invalidate_send_plans();
     update_cached_info_nts(locator_selector);
     compute_selected_guids(locator_selector);
 
@@ -954,8 +1102,12 @@ void StatefulWriter::select_all_readers_nts(
     if (locator_selector.locator_selector.state_has_changed())
     {
         group.flush_and_reset();
-        mp_RTPSParticipant->network_factory().select_locators(locator_selector.locator_selector);
-        compute_selected_guids(locator_selector);
+        if (!locator_selector.restore_send_plan())
+        {
+            mp_RTPSParticipant->network_factory().select_locators(locator_selector.locator_selector);
+            compute_selected_guids(locator_selector);
+            locator_selector.store_send_plan();
+        }
     }
 }
 
@@ -1157,7 +1309,7 @@ bool StatefulWriter::matched_reader_add_edp(
 
                 // Always activate heartbeat period. We need a confirmation of the reader.
                 // The state has to be updated.
-                periodic_hb_event_->restart_timer(std::chrono::steady_clock::now() + std::chrono::hours(24));
+                restart_periodic_heartbeat(std::chrono::steady_clock::now() + std::chrono::hours(24));
             }
             catch (const RTPSMessageGroup::timeout&)
             {
@@ -1268,7 +1420,7 @@ bool StatefulWriter::matched_reader_remove(
 
     if (get_matched_readers_size() == 0)
     {
-        periodic_hb_event_->cancel_timer();
+        cancel_periodic_heartbeat();
     }
 
     if (rproxy != nullptr)
@@ -1642,7 +1794,14 @@ void StatefulWriter::update_times(
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     if (times_.heartbeat_period != times.heartbeat_period)
     {
-        periodic_hb_event_->update_interval(times.heartbeat_period);
+        if (nullptr != hb_aggregator_entry_)
+        {
+            hb_aggregator_->update_period(*hb_aggregator_entry_, times.heartbeat_period);
+        }
+        else
+        {
+            periodic_hb_event_->update_interval(times.heartbeat_period);
+        }
     }
     if (times_.nack_response_delay != times.nack_response_delay)
     {
@@ -1759,6 +1918,115 @@ bool StatefulWriter::send_periodic_heartbeat(
     return unacked_changes;
 }
 
+bool StatefulWriter::send_periodic_heartbeat(
+        HeartbeatAggregator& aggregator)
+{
+    std::lock_guard<RecursiveTimedMutex> guardW(mp_mutex);
+
+    SequenceNumber_t first_seq_to_check_acknowledge = get_seq_num_min();
+    if (SequenceNumber_t::unknown() == first_seq_to_check_acknowledge)
+    {
+        first_seq_to_check_acknowledge = history_->next_sequence_number() - 1;
+    }
+
+    bool unacked_changes = for_matched_readers(matched_local_readers_, matched_datasharing_readers_,
+                    matched_remote_readers_,
+                    [first_seq_to_check_acknowledge](ReaderProxy* reader)
+                    {
+                        return reader->has_unacknowledged(first_seq_to_check_acknowledge);
+                    }
+                    );
+
+    if (!unacked_changes)
+    {
+        return false;
+    }
+
+    // Personal heartbeats and GAPs for holes in history are not aggregated, so use the regular path for them.
+    if (separate_sending_enabled_ || has_holes_in_history_nts())
+    {
+        std::lock_guard<LocatorSelectorSender> guard_locator_selector_general(locator_selector_general_);
+        try
+        {
+            send_heartbeat_to_all_readers();
+        }
+        catch (const RTPSMessageGroup::timeout&)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_WRITER, "Max blocking time reached");
+        }
+        return true;
+    }
+
+    for (ReaderProxy* reader : matched_local_readers_)
+    {
+        intraprocess_heartbeat(reader);
+    }
+
+    for (ReaderProxy* reader : matched_datasharing_readers_)
+    {
+        reader->datasharing_notify();
+    }
+
+    SequenceNumber_t firstSeq;
+    SequenceNumber_t lastSeq;
+    if (there_are_remote_readers_ &&
+            get_heartbeat_range_nts_(matched_remote_readers_.size(), false, firstSeq, lastSeq))
+    {
+        increment_hb_count();
+        for (ReaderProxy* reader : matched_remote_readers_)
+        {
+            if (reader->is_reliable())
+            {
+                aggregator.add_heartbeat(this, *reader, firstSeq, lastSeq, heartbeat_count_, disable_positive_acks_);
+            }
+        }
+        // Update calculate of heartbeat piggyback.
+        currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_);
+
+        EPROSIMA_LOG_INFO(RTPS_WRITER,
+                getGuid().entityId << " Aggregating Heartbeat (" << firstSeq << " - " << lastSeq << ")" );
+    }
+
+    return true;
+}
+
+void StatefulWriter::restart_periodic_heartbeat()
+{
+    if (nullptr != hb_aggregator_entry_)
+    {
+        hb_aggregator_->restart(*hb_aggregator_entry_);
+    }
+    else
+    {
+        periodic_hb_event_->restart_timer();
+    }
+}
+
+void StatefulWriter::restart_periodic_heartbeat(
+        const std::chrono::steady_clock::time_point& max_blocking_time)
+{
+    if (nullptr != hb_aggregator_entry_)
+    {
+        hb_aggregator_->restart(*hb_aggregator_entry_);
+    }
+    else
+    {
+        periodic_hb_event_->restart_timer(max_blocking_time);
+    }
+}
+
+void StatefulWriter::cancel_periodic_heartbeat()
+{
+    if (nullptr != hb_aggregator_entry_)
+    {
+        hb_aggregator_->cancel(*hb_aggregator_entry_);
+    }
+    else
+    {
+        periodic_hb_event_->cancel_timer();
+    }
+}
+
 void StatefulWriter::send_heartbeat_to_nts(
         ReaderProxy& remoteReaderProxy,
         bool liveliness,
@@ -1807,19 +2075,19 @@ void StatefulWriter::send_heartbeat_to_nts(
     }
 }
 
-void StatefulWriter::send_heartbeat_nts_(
+bool StatefulWriter::get_heartbeat_range_nts_(
         size_t number_of_readers,
-        RTPSMessageGroup& message_group,
-        bool final,
-        bool liveliness)
+        bool liveliness,
+        SequenceNumber_t& firstSeq,
+        SequenceNumber_t& lastSeq)
 {
     if (!number_of_readers)
     {
-        return;
+        return false;
     }
 
-    SequenceNumber_t firstSeq = get_seq_num_min();
-    SequenceNumber_t lastSeq = get_seq_num_max();
+    firstSeq = get_seq_num_min();
+    lastSeq = get_seq_num_max();
 
     if (firstSeq == c_SequenceNumber_Unknown || lastSeq == c_SequenceNumber_Unknown)
     {
@@ -1832,7 +2100,7 @@ void StatefulWriter::send_heartbeat_nts_(
         }
         else
         {
-            return;
+            return false;
         }
     }
     else
@@ -1840,6 +2108,23 @@ void StatefulWriter::send_heartbeat_nts_(
         assert(firstSeq <= lastSeq);
     }
 
+    return true;
+}
+
+void StatefulWriter::send_heartbeat_nts_(
+        size_t number_of_readers,
+        RTPSMessageGroup& message_group,
+        bool final,
+        bool liveliness)
+{
+    SequenceNumber_t firstSeq;
+    SequenceNumber_t lastSeq;
+
+    if (!get_heartbeat_range_nts_(number_of_readers, liveliness, firstSeq, lastSeq))
+    {
+        return;
+    }
+
     increment_hb_count();
     message_group.add_heartbeat(firstSeq, lastSeq, heartbeat_count_, final, liveliness);
     // Update calculate of heartbeat piggyback.
@@ -1910,7 +2195,7 @@ void StatefulWriter::perform_nack_supression(
                 if (reader->guid() == reader_guid)
                 {
                     reader->perform_nack_supression();
-                    periodic_hb_event_->restart_timer();
+                    restart_periodic_heartbeat();
                     return true;
                 }
                 return false;
@@ -1956,7 +2241,7 @@ bool StatefulWriter::process_acknack(
                                     }
                                     else if (!final_flag)
                                     {
-                                        periodic_hb_event_->restart_timer();
+                                        restart_periodic_heartbeat();
                                     }
 
                                     gap_builder.flush();
@@ -1974,7 +2259,7 @@ bool StatefulWriter::process_acknack(
                                         {
                                             // Send heartbeat if requested
                                             send_heartbeat_to_nts(*remote_reader, false, true);
-                                            periodic_hb_event_->restart_timer();
+                                            restart_periodic_heartbeat();
                                         }
                                     }
 
@@ -2243,14 +2528,19 @@ bool StatefulWriter::get_connections(
 
 #endif // ifdef FASTDDS_STATISTICS
 
-void StatefulWriter::add_gaps_for_holes_in_history(
-        RTPSMessageGroup& group)
+bool StatefulWriter::has_holes_in_history_nts()
 {
     SequenceNumber_t firstSeq = get_seq_num_min();
     SequenceNumber_t lastSeq = get_seq_num_max();
 
-    if (SequenceNumber_t::unknown() != firstSeq &&
-            lastSeq.to64long() - firstSeq.to64long() + 1 != history_->getHistorySize())
+    return SequenceNumber_t::unknown() != firstSeq &&
+           lastSeq.to64long() - firstSeq.to64long() + 1 != history_->getHistorySize();
+}
+
+void StatefulWriter::add_gaps_for_holes_in_history(
+        RTPSMessageGroup& group)
+{
+    if (has_holes_in_history_nts())
     {
         RTPSGapBuilder gaps(group);
         // There are holes in the history.
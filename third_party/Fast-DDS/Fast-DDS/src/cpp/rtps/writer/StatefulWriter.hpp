@@ -21,6 +21,7 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <vector>
 
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/history/IChangePool.hpp>
@@ -30,11 +31,13 @@
 #include <fastdds/utils/collections/ResourceLimitedVector.hpp>
 
 #include <rtps/writer/BaseWriter.hpp>
+#include <rtps/writer/HeartbeatAggregator.hpp>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+class DeliveryThreadPool;
 class ReaderProxy;
 class TimedEvent;
 
@@ -319,6 +322,19 @@ public:
             bool final = false,
             bool liveliness = false);
 
+    /**
+     * @brief Sends a periodic heartbeat through the participant's heartbeat aggregator.
+     *
+     * Heartbeats for remote readers are added to the aggregator, which packs them with the ones of other writers
+     * addressed to the same destinations.
+     *
+     * @param aggregator  Aggregator collecting the heartbeats of the current tick.
+     *
+     * @return True if the periodic heartbeat should be scheduled again.
+     */
+    bool send_periodic_heartbeat(
+            HeartbeatAggregator& aggregator);
+
     /**
      * @brief Sends a heartbeat to a remote reader.
      *
@@ -376,6 +392,39 @@ private:
             bool final,
             bool liveliness = false);
 
+    /**
+     * Get the range of sequence numbers to announce on a heartbeat.
+     *
+     * @param number_of_readers  Number of readers the heartbeat is addressed to.
+     * @param liveliness         Whether the heartbeat is a liveliness one.
+     * @param [out] first_seq    First available sequence number.
+     * @param [out] last_seq     Last available sequence number.
+     *
+     * @return False when no heartbeat should be sent.
+     */
+    bool get_heartbeat_range_nts_(
+            size_t number_of_readers,
+            bool liveliness,
+            SequenceNumber_t& first_seq,
+            SequenceNumber_t& last_seq);
+
+    bool has_holes_in_history_nts();
+
+    /**
+     * Schedule the periodic heartbeat, either on its own timed event or on the participant's heartbeat aggregator.
+     */
+    void restart_periodic_heartbeat();
+
+    /**
+     * Schedule the periodic heartbeat, either on its own timed event or on the participant's heartbeat aggregator.
+     *
+     * @param max_blocking_time  Future time point until the method can be blocked.
+     */
+    void restart_periodic_heartbeat(
+            const std::chrono::steady_clock::time_point& max_blocking_time);
+
+    void cancel_periodic_heartbeat();
+
     void check_acked_status();
 
     /**
@@ -390,6 +439,28 @@ private:
     void deliver_sample_to_intraprocesses(
             CacheChange_t* change);
 
+    /**
+     * Deliver a sample to a single local reader on the calling thread.
+     *
+     * @param change        Sample to deliver.
+     * @param remoteReader  Proxy of the local reader.
+     * @param gap_seq       First sequence number of the hole before the sample, or unknown if there is none.
+     */
+    void deliver_sample_to_intraprocess(
+            CacheChange_t* change,
+            ReaderProxy* remoteReader,
+            const SequenceNumber_t& gap_seq);
+
+    /**
+     * Deliver a sample to the local readers, performing the reception on each of them in parallel.
+     * Readers which may call a user listener are delivered on the calling thread, as the listener could call back
+     * into this writer.
+     *
+     * @param change Sample to deliver.
+     */
+    void deliver_sample_to_intraprocesses_in_parallel(
+            CacheChange_t* change);
+
     void deliver_sample_to_datasharing(
             CacheChange_t* change);
 
@@ -414,9 +485,32 @@ private:
             RTPSParticipantImpl* pimpl,
             const WriterAttributes& att);
 
-    /// Timed Event to manage the periodic HB to the Reader.
+    /// Timed Event to manage the periodic HB to the Reader. Not used when heartbeats are aggregated.
     TimedEvent* periodic_hb_event_;
 
+    /// Participant's heartbeat aggregator, when it manages the periodic HB of this writer.
+    HeartbeatAggregator* hb_aggregator_ = nullptr;
+
+    /// Entry of this writer on the participant's heartbeat aggregator.
+    HeartbeatAggregator::Entry* hb_aggregator_entry_ = nullptr;
+
+    /// Participant's pool of threads used to deliver samples to several local readers in parallel, if enabled.
+    DeliveryThreadPool* delivery_pool_ = nullptr;
+
+    /// Pending delivery of a sample to a local reader, while delivering to several readers in parallel.
+    struct ParallelDelivery
+    {
+        ReaderProxy* reader;
+        SequenceNumber_t gap_seq;
+        bool delivered;
+    };
+
+    /// Scratch collection of deliveries, reused on every sample delivered in parallel.
+    std::vector<ParallelDelivery> parallel_deliveries_;
+
+    /// Scratch collection of datasharing readers to notify, reused on every sample notified in parallel.
+    std::vector<ReaderProxy*> parallel_notifications_;
+
     /// Timed Event to manage the Acknack response delay.
     TimedEvent* nack_response_event_;
 
@@ -0,0 +1,85 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Fnv1a.hpp
+ */
+
+#ifndef FASTDDS_UTILS__FNV1A_HPP
+#define FASTDDS_UTILS__FNV1A_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/Types.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * FNV-1a hash of a run of octets, 32 bits wide.
+ * The result only depends on the octets, so it can be shared between processes.
+ *
+ * @param data  Pointer to the first octet.
+ * @param size  Number of octets to hash.
+ * @param hash  Hash to continue from. Defaults to the FNV offset basis.
+ */
+inline uint32_t fnv1a_32(
+        const octet* data,
+        size_t size,
+        uint32_t hash = 2166136261u)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * FNV-1a hash of a run of octets, 64 bits wide.
+ *
+ * @param data  Pointer to the first octet.
+ * @param size  Number of octets to hash.
+ * @param hash  Hash to continue from. Defaults to the FNV offset basis.
+ */
+inline uint64_t fnv1a_64(
+        const octet* data,
+        size_t size,
+        uint64_t hash = 0xCBF29CE484222325ull)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/**
+ * FNV-1a hash of the 16 octets of a GUID, 32 bits wide.
+ */
+inline uint32_t fnv1a_32(
+        const GUID_t& guid)
+{
+    uint32_t hash = fnv1a_32(guid.guidPrefix.value, GuidPrefix_t::size);
+    return fnv1a_32(guid.entityId.value, EntityId_t::size, hash);
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_UTILS__FNV1A_HPP
@@ -0,0 +1,313 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HashIndexedMap.hpp
+ */
+
+#ifndef FASTDDS_UTILS_COLLECTIONS__HASHINDEXEDMAP_HPP
+#define FASTDDS_UTILS_COLLECTIONS__HASHINDEXEDMAP_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+
+/**
+ * An ordered map with an open addressing hash index on its keys.
+ *
+ * Elements are stored on a @c std::map, so they keep a stable address and ordered iteration, @c lower_bound and
+ * @c upper_bound are available. Lookups by key go through a flat hash table of iterators to the elements, using
+ * linear probing and backward shift deletion, so they do not walk the tree.
+ *
+ * Only the subset of the @c std::map interface used by the histories is provided.
+ *
+ * @tparam _Key   Key type.
+ * @tparam _Ty    Mapped type.
+ * @tparam _Hash  Hash functor for the keys.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <
+    typename _Key,
+    typename _Ty,
+    typename _Hash>
+class HashIndexedMap
+{
+    using map_type = std::map<_Key, _Ty>;
+
+public:
+
+    using key_type = typename map_type::key_type;
+    using mapped_type = typename map_type::mapped_type;
+    using value_type = typename map_type::value_type;
+    using size_type = typename map_type::size_type;
+    using iterator = typename map_type::iterator;
+    using const_iterator = typename map_type::const_iterator;
+
+    HashIndexedMap() = default;
+
+    HashIndexedMap(
+            const HashIndexedMap&) = delete;
+
+    HashIndexedMap& operator =(
+            const HashIndexedMap&) = delete;
+
+    iterator begin() noexcept
+    {
+        return map_.begin();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return map_.begin();
+    }
+
+    iterator end() noexcept
+    {
+        return map_.end();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return map_.end();
+    }
+
+    size_type size() const noexcept
+    {
+        return map_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return map_.empty();
+    }
+
+    iterator find(
+            const key_type& key)
+    {
+        size_t pos = find_slot(key, hasher_(key));
+        return slots_.empty() || !slots_[pos].used ? map_.end() : slots_[pos].it;
+    }
+
+    const_iterator find(
+            const key_type& key) const
+    {
+        size_t pos = find_slot(key, hasher_(key));
+        return slots_.empty() || !slots_[pos].used ? map_.end() : const_iterator(slots_[pos].it);
+    }
+
+    size_type count(
+            const key_type& key) const
+    {
+        return find(key) == end() ? 0u : 1u;
+    }
+
+    iterator lower_bound(
+            const key_type& key)
+    {
+        return map_.lower_bound(key);
+    }
+
+    iterator upper_bound(
+            const key_type& key)
+    {
+        return map_.upper_bound(key);
+    }
+
+    /**
+     * Constructs a new element with @c key and the mapped value constructed from @c args, if there is no element
+     * with @c key on the map.
+     *
+     * @return A pair with an iterator to the element with @c key and whether it was inserted.
+     */
+    template<typename ... Args>
+    std::pair<iterator, bool> emplace(
+            const key_type& key,
+            Args&&... args)
+    {
+        size_t hash = hasher_(key);
+        size_t pos = find_slot(key, hash);
+        if (!slots_.empty() && slots_[pos].used)
+        {
+            return {slots_[pos].it, false};
+        }
+
+        iterator it = map_.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                        std::forward_as_tuple(std::forward<Args>(args)...)).first;
+        add_to_index(hash, it);
+        return {it, true};
+    }
+
+    std::pair<iterator, bool> insert(
+            const value_type& value)
+    {
+        return emplace(value.first, value.second);
+    }
+
+    mapped_type& operator [](
+            const key_type& key)
+    {
+        return emplace(key).first->second;
+    }
+
+    iterator erase(
+            iterator it)
+    {
+        remove_from_index(it->first);
+        return map_.erase(it);
+    }
+
+    size_type erase(
+            const key_type& key)
+    {
+        iterator it = find(key);
+        if (it == map_.end())
+        {
+            return 0u;
+        }
+        erase(it);
+        return 1u;
+    }
+
+    void clear() noexcept
+    {
+        map_.clear();
+        slots_.clear();
+    }
+
+private:
+
+    struct Slot
+    {
+        size_t hash = 0;
+        iterator it {};
+        bool used = false;
+    };
+
+    //! Minimum number of slots of the index once an element is inserted.
+    static constexpr size_t min_slots = 16;
+
+    size_t mask() const
+    {
+        return slots_.size() - 1;
+    }
+
+    /**
+     * Returns the slot holding @c key, or the free slot where it should be inserted.
+     * Not valid when the index is empty.
+     */
+    size_t find_slot(
+            const key_type& key,
+            size_t hash) const
+    {
+        if (slots_.empty())
+        {
+            return 0;
+        }
+
+        size_t pos = hash & mask();
+        while (slots_[pos].used && !(slots_[pos].hash == hash && slots_[pos].it->first == key))
+        {
+            pos = (pos + 1) & mask();
+        }
+        return pos;
+    }
+
+    void add_to_index(
+            size_t hash,
+            iterator it)
+    {
+        // Keep the load factor under 3/4
+        if (4 * map_.size() > 3 * slots_.size())
+        {
+            rehash(slots_.empty() ? min_slots : 2 * slots_.size());
+        }
+        else
+        {
+            Slot& slot = slots_[find_slot(it->first, hash)];
+            slot.hash = hash;
+            slot.it = it;
+            slot.used = true;
+        }
+    }
+
+    void remove_from_index(
+            const key_type& key)
+    {
+        size_t pos = find_slot(key, hasher_(key));
+        assert(slots_[pos].used);
+
+        // Move back the elements of the cluster that would not be found after emptying the slot
+        size_t next = pos;
+        while (true)
+        {
+            next = (next + 1) & mask();
+            if (!slots_[next].used)
+            {
+                break;
+            }
+
+            size_t ideal = slots_[next].hash & mask();
+            bool in_range = pos <= next ?
+                    (pos < ideal && ideal <= next) :
+                    (pos < ideal || ideal <= next);
+            if (!in_range)
+            {
+                slots_[pos] = slots_[next];
+                pos = next;
+            }
+        }
+        slots_[pos].used = false;
+    }
+
+    //! Rebuilds the index with @c num_slots slots, which should be a power of two.
+    void rehash(
+            size_t num_slots)
+    {
+        slots_.assign(num_slots, Slot());
+        for (iterator it = map_.begin(); it != map_.end(); ++it)
+        {
+            size_t hash = hasher_(it->first);
+            size_t pos = hash & mask();
+            while (slots_[pos].used)
+            {
+                pos = (pos + 1) & mask();
+            }
+            slots_[pos].hash = hash;
+            slots_[pos].it = it;
+            slots_[pos].used = true;
+        }
+    }
+
+    map_type map_;
+    std::vector<Slot> slots_;
+    _Hash hasher_;
+};
+
+template <
+    typename _Key,
+    typename _Ty,
+    typename _Hash>
+constexpr size_t HashIndexedMap<_Key, _Ty, _Hash>::min_slots;
+
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif  // FASTDDS_UTILS_COLLECTIONS__HASHINDEXEDMAP_HPP
@@ -408,6 +408,7 @@ XMLP_ret XMLParser::getXMLDiscoverySettings(
             <xs:element name="EDP" type="EDPType" minOccurs="0"/>
             <xs:element name="leaseDuration" type="durationType" minOccurs="0"/>
             <xs:element name="leaseAnnouncement" type="durationType" minOccurs="0"/>
+            <xs:element name="fullAnnouncementPeriod" type="uint32Type" minOccurs="0"/>
             <xs:element name="simpleEDP" type="simpleEDPType" minOccurs="0"/>
             <xs:element name="clientAnnouncementPeriod" type="durationType" minOccurs="0"/>
             <xs:element name="discoveryServersList" type="DiscoveryServerList" minOccurs="0"/>
@@ -495,6 +496,14 @@ XMLP_ret XMLParser::getXMLDiscoverySettings(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, FULL_ANNOUNCEMENT_PERIOD) == 0)
+        {
+            // fullAnnouncementPeriod - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &settings.full_announcement_period, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, SIMPLE_EDP) == 0)
         {
             // simpleEDP
@@ -958,6 +967,7 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     <xs:enumeration value="ROUND_ROBIN" />
                     <xs:enumeration value="HIGH_PRIORITY" />
                     <xs:enumeration value="PRIORITY_WITH_RESERVATION" />
+                    <xs:enumeration value="EARLIEST_DEADLINE_FIRST" />
                 </xs:restriction>
             </xs:simpleType>
          */
@@ -1008,7 +1018,8 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                         FIFO, FlowControllerSchedulerPolicy::FIFO,
                         HIGH_PRIORITY, FlowControllerSchedulerPolicy::HIGH_PRIORITY,
                         ROUND_ROBIN, FlowControllerSchedulerPolicy::ROUND_ROBIN,
-                        PRIORITY_WITH_RESERVATION, FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION))
+                        PRIORITY_WITH_RESERVATION, FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION,
+                        EARLIEST_DEADLINE_FIRST, FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST))
                 {
                     EPROSIMA_LOG_ERROR(XMLPARSER, "Node '" << SCHEDULER << "' with bad content");
                     return XMLP_ret::XML_ERROR;
@@ -293,6 +293,7 @@ const char* FIFO = "FIFO";
 const char* HIGH_PRIORITY = "HIGH_PRIORITY";
 const char* ROUND_ROBIN = "ROUND_ROBIN";
 const char* PRIORITY_WITH_RESERVATION = "PRIORITY_WITH_RESERVATION";
+const char* EARLIEST_DEADLINE_FIRST = "EARLIEST_DEADLINE_FIRST";
 const char* PORT_BASE = "portBase";
 const char* DOMAIN_ID_GAIN = "domainIDGain";
 const char* PARTICIPANT_ID_GAIN = "participantIDGain";
@@ -318,6 +319,7 @@ const char* DOMAIN_ID = "domainId";
 const char* LEASEDURATION = "leaseDuration";
 const char* LEASE_ANNOUNCE = "leaseAnnouncement";
 const char* INITIAL_ANNOUNCEMENTS = "initialAnnouncements";
+const char* FULL_ANNOUNCEMENT_PERIOD = "fullAnnouncementPeriod";
 const char* AVOID_BUILTIN_MULTICAST = "avoid_builtin_multicast";
 const char* SIMPLE_EDP = "simpleEDP";
 const char* META_EXT_UNI_LOC_LIST = "metatraffic_external_unicast_locators";
@@ -304,6 +304,7 @@ extern const char* FIFO;
 extern const char* HIGH_PRIORITY;
 extern const char* ROUND_ROBIN;
 extern const char* PRIORITY_WITH_RESERVATION;
+extern const char* EARLIEST_DEADLINE_FIRST;
 extern const char* FLOW_CONTROLLER_NAME;
 extern const char* PERIOD_MILLISECS;
 extern const char* PORT_BASE;
@@ -331,6 +332,7 @@ extern const char* DOMAIN_ID;
 extern const char* LEASEDURATION;
 extern const char* LEASE_ANNOUNCE;
 extern const char* INITIAL_ANNOUNCEMENTS;
+extern const char* FULL_ANNOUNCEMENT_PERIOD;
 extern const char* AVOID_BUILTIN_MULTICAST;
 extern const char* SIMPLE_EDP;
 extern const char* META_EXT_UNI_LOC_LIST;